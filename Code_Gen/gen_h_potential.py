@@ -0,0 +1,823 @@
+#!/usr/bin/env python3
+#
+# This file is part of HFPx3D_VC.
+#
+# Created by agent on 10/19/2026.
+# Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+# Geo-Energy Laboratory, 2026.  All rights reserved.
+# See the LICENSE.TXT file for more details.
+#
+
+"""Generator of the contracted H-potential kernels (src/h_potential_contr.cpp)
+
+The reference (hand-written) coefficient functions s_ij_gen_h, s_ij_red_h
+and s_ij_lim_h in src/h_potential.cpp are parsed and evaluated symbolically:
+scalar temporaries (p0, p1, ...) are substituted, loops are unrolled, and
+every coefficient becomes an expression graph over the arguments
+(nu, eix, h, d). Equal sub-expressions are merged (hash-consing; the operands
+of + and * are ordered canonically, which is exact in floating point).
+
+The generated functions accumulate s += alpha * dot(coefficients, f)
+(or s += alpha * coefficients for the limit case) as straight-line code:
+- only structurally non-zero coefficients are emitted;
+- sub-expressions used more than once are computed once (CSE);
+- a block which is the complex conjugate of another one
+  (e.g. c_array(2, ...) = conj(c_array(1, ...))) is not computed:
+  with real f and alpha its contraction is the conjugate of the other one.
+
+The *_r variants are in real arithmetic: complex expressions are split
+into real and imaginary parts, and only the independent real quantities
+are accumulated (for the real stress combinations S11+S22 and S33,
+the coefficients of 1 and tau*conj(tau) are real, and those of conj(tau)
+and conj(tau)^2 are the conjugates of those of tau and tau^2).
+
+Usage (from the repository root):
+    python3 Code_Gen/gen_h_potential.py [src/h_potential.cpp] [output.cpp]
+"""
+
+import os
+import re
+import sys
+
+# ---------------------------------------------------------------- parsing
+
+TOKEN = re.compile(r'''
+    (?P<num>\d+\.\d*(?:[eE][-+]?\d+)?|\d+(?:[eE][-+]?\d+)?|\.\d+)
+  | (?P<name>static_cast<double>|[A-Za-z_]\w*(?:::[A-Za-z_]\w*)*)
+  | (?P<op><=|>=|==|\+\+|[-+*/(),?:<>\[\]=])
+  | (?P<ws>\s+)
+''', re.X)
+
+
+def tokenize(text):
+    out = []
+    pos = 0
+    while pos < len(text):
+        m = TOKEN.match(text, pos)
+        if not m:
+            raise SyntaxError('cannot tokenize: ' + text[pos:pos + 30])
+        pos = m.end()
+        if m.lastgroup != 'ws':
+            out.append((m.lastgroup, m.group(m.lastgroup)))
+    return out
+
+
+REAL_FUN = {'std::real', 'std::imag', 'std::abs', 'std::arg', 'std::fabs',
+            'std::atanh', 'std::atan', 'std::sqrt', 'std::log',
+            'double', 'static_cast<double>'}
+CPLX_FUN = {'std::conj', 'std::exp', 'std::polar'}
+
+
+class Graph:
+    """Hash-consed expression graph"""
+
+    def __init__(self, var_types):
+        self.nodes = []  # (op, args) ; args: tuple of ids or a string
+        self.types = []  # 'r' (double) or 'c' (complex)
+        self.index = {}
+        self.var_types = var_types
+        self.zero = self.num('0.0')
+
+    def add(self, op, args, typ):
+        if op in ('+', '*'):
+            args = tuple(sorted(args))
+        key = (op, args)
+        if key not in self.index:
+            self.index[key] = len(self.nodes)
+            self.nodes.append(key)
+            self.types.append(typ)
+        return self.index[key]
+
+    def num(self, text):
+        return self.add('num', text, 'r')
+
+    def var(self, name):
+        return self.add('var', name, self.var_types[name])
+
+    def is_zero(self, n):
+        op, args = self.nodes[n]
+        return op == 'num' and float(args) == 0.0
+
+    def is_one(self, n):
+        op, args = self.nodes[n]
+        return op == 'num' and float(args) == 1.0
+
+    def binary(self, op, a, b):
+        if op == '*' and (self.is_zero(a) or self.is_zero(b)):
+            return self.zero
+        if op == '*' and self.is_one(a):
+            return b
+        if op in ('*', '/') and self.is_one(b):
+            return a
+        if op in ('+', '-') and self.is_zero(b):
+            return a
+        if op == '+' and self.is_zero(a):
+            return b
+        if op == '-' and self.is_zero(a):
+            return self.unary('neg', b)
+        t = 'c' if 'c' in (self.types[a], self.types[b]) else 'r'
+        if op in ('<', '>', '<=', '>=', '=='):
+            t = 'r'
+        return self.add(op, (a, b), t)
+
+    def unary(self, op, a):
+        if self.is_zero(a):
+            return self.zero
+        return self.add(op, (a,), self.types[a])
+
+    def call(self, name, args):
+        if name == 'std::conj' and self.is_zero(args[0]):
+            return self.zero
+        if name in REAL_FUN:
+            t = 'r'
+        elif name in CPLX_FUN:
+            t = 'c'
+        else:
+            raise SyntaxError('unknown function ' + name)
+        return self.add('call:' + name, tuple(args), t)
+
+    def ternary(self, c, a, b):
+        t = 'c' if 'c' in (self.types[a], self.types[b]) else 'r'
+        return self.add('?:', (c, a, b), t)
+
+
+class Parser:
+    """Recursive descent parser of C++ expressions used in h_potential.cpp;
+    names are resolved through env (symbolic values), c_array reads
+    through the entries evaluated so far"""
+
+    def __init__(self, g, env, entries, tokens):
+        self.g = g
+        self.env = env
+        self.entries = entries
+        self.tk = tokens
+        self.p = 0
+
+    def peek(self):
+        return self.tk[self.p] if self.p < len(self.tk) else (None, None)
+
+    def take(self, val=None):
+        t = self.tk[self.p]
+        if val is not None and t[1] != val:
+            raise SyntaxError('expected %s, got %s' % (val, t[1]))
+        self.p += 1
+        return t
+
+    def expr(self):
+        c = self.cmp()
+        if self.peek()[1] == '?':
+            self.take('?')
+            a = self.expr()
+            self.take(':')
+            b = self.expr()
+            return self.g.ternary(c, a, b)
+        return c
+
+    def cmp(self):
+        a = self.add()
+        if self.peek()[1] in ('<', '>', '<=', '>=', '=='):
+            op = self.take()[1]
+            a = self.g.binary(op, a, self.add())
+        return a
+
+    def add(self):
+        a = self.mul()
+        while self.peek()[1] in ('+', '-'):
+            op = self.take()[1]
+            a = self.g.binary(op, a, self.mul())
+        return a
+
+    def mul(self):
+        a = self.unary()
+        while self.peek()[1] in ('*', '/'):
+            op = self.take()[1]
+            a = self.g.binary(op, a, self.unary())
+        return a
+
+    def unary(self):
+        if self.peek()[1] == '-':
+            self.take()
+            return self.g.unary('neg', self.unary())
+        if self.peek()[1] == '+':
+            self.take()
+            return self.unary()
+        return self.primary()
+
+    def int_arg(self):
+        return int(self.take()[1])
+
+    def primary(self):
+        kind, val = self.take()
+        if kind == 'num':
+            return self.g.num(val)
+        if val == '(':
+            e = self.expr()
+            self.take(')')
+            return e
+        if kind != 'name':
+            raise SyntaxError('unexpected ' + val)
+        if val == 'c_array':
+            self.take('(')
+            idx = [self.int_arg()]
+            while self.peek()[1] == ',':
+                self.take(',')
+                idx.append(self.int_arg())
+            self.take(')')
+            return self.entries.get(tuple(idx), self.g.zero)
+        if self.peek()[1] == '(':
+            self.take('(')
+            args = [self.expr()]
+            while self.peek()[1] == ',':
+                self.take(',')
+                args.append(self.expr())
+            self.take(')')
+            return self.g.call(val, args)
+        if self.peek()[1] == '[':
+            self.take('[')
+            i = self.int_arg()
+            self.take(']')
+            val = '%s[%d]' % (val, i)
+        if val == 'il::ii':
+            return self.g.var('il::ii')
+        if val not in self.env:
+            raise SyntaxError('unknown name ' + val)
+        return self.env[val]
+
+
+def function_body(src, name):
+    m = re.search(r'\b' + name + r'\s*\(', src)
+    i = src.index('{', m.end())
+    depth = 0
+    for k in range(i, len(src)):
+        if src[k] == '{':
+            depth += 1
+        elif src[k] == '}':
+            depth -= 1
+            if depth == 0:
+                return src[i + 1:k]
+    raise SyntaxError('unbalanced braces in ' + name)
+
+
+def statements(body):
+    """Splits a function body into statements; for loops with constant
+    bounds are unrolled (c_array.size(n) is replaced with its value)"""
+    body = re.sub(r'//[^\n]*', '', body)
+    body = re.sub(r'/\*.*?\*/', '', body, flags=re.S)
+    out = []
+    pos = 0
+    while True:
+        while pos < len(body) and body[pos].isspace():
+            pos += 1
+        if pos >= len(body):
+            return out
+        m = re.match(r'for\s*\(\s*int\s+(\w+)\s*=\s*(\d+)\s*;\s*\w+\s*<\s*'
+                     r'([^;]+);[^)]*\)\s*\{', body[pos:])
+        if m:
+            var, lo, hi = m.group(1), int(m.group(2)), m.group(3)
+            start = pos + m.end()
+            depth = 1
+            k = start
+            while depth > 0:
+                if body[k] == '{':
+                    depth += 1
+                elif body[k] == '}':
+                    depth -= 1
+                k += 1
+            inner = body[start:k - 1]
+            out.append(('for', var, lo, hi, inner))
+            pos = k
+            continue
+        k = body.index(';', pos)
+        out.append(('stmt', body[pos:k].strip()))
+        pos = k + 1
+
+
+DECL = re.compile(r'^(const\s+)?(double|std::complex<double>|'
+                  r'il::StaticArray\w*<std::complex<double>[\d\s,]*>)'
+                  r'\s+(.*)$', re.S)
+
+
+def split_top(text, sep=','):
+    parts, depth, cur = [], 0, ''
+    for ch in text:
+        if ch in '([{':
+            depth += 1
+        elif ch in ')]}':
+            depth -= 1
+        if ch == sep and depth == 0:
+            parts.append(cur)
+            cur = ''
+        else:
+            cur += ch
+    parts.append(cur)
+    return [p.strip() for p in parts]
+
+
+def evaluate(src, name, params, dims):
+    """Symbolic evaluation of a reference coefficient function:
+    returns the graph and the map of non-zero entries to nodes
+    (in the order of their first assignment)"""
+    var_types = dict(params)
+    var_types['il::ii'] = 'c'
+    g = Graph(var_types)
+    env = {p: g.var(p) for p in params}
+    names = {}  # node -> name of a variable defined once
+    n_def = {}
+    entries = {}
+    order = []
+
+    def size_of(expr):
+        m = re.match(r'c_array\.size\((\d)\)\s*(-\s*(\d+))?$', expr.strip())
+        if m:
+            return dims[int(m.group(1))] - int(m.group(3) or 0)
+        return int(expr)
+
+    def run(stmts, subst):
+        for st in stmts:
+            if st[0] == 'for':
+                _, var, lo, hi, inner = st
+                for v in range(lo, size_of(hi)):
+                    s2 = dict(subst)
+                    s2[var] = str(v)
+                    run(statements(inner), s2)
+                continue
+            text = st[1]
+            for v, val in subst.items():
+                text = re.sub(r'\b%s\b' % v, val, text)
+            if text.startswith('return'):
+                continue
+            m = DECL.match(text)
+            if m:
+                typ = 'r' if m.group(2) == 'double' else 'c'
+                if m.group(2).startswith('il::StaticArray') and \
+                        'c_array' in m.group(3):
+                    continue
+                for dcl in split_top(m.group(3)):
+                    dm = re.match(r'(\w+)\s*(\{\s*\})?\s*(=\s*(.*))?$',
+                                  dcl, re.S)
+                    vname = dm.group(1)
+                    var_types[vname] = typ
+                    if dm.group(4) is not None:
+                        assign(vname, dm.group(4))
+                continue
+            lhs, rhs = text.split('=', 1)
+            assign(lhs.strip(), rhs)
+
+    def assign(lhs, rhs):
+        node = Parser(g, env, entries, tokenize(rhs)).expr()
+        m = re.match(r'c_array\(([\d,\s]+)\)$', lhs)
+        if m:
+            idx = tuple(int(x) for x in m.group(1).split(','))
+            if idx not in entries:
+                order.append(idx)
+            entries[idx] = node
+            return
+        lhs = re.sub(r'\s+', '', lhs)
+        env[lhs] = node
+        n_def[lhs] = n_def.get(lhs, 0) + 1
+        if n_def[lhs] == 1 and node not in names and \
+                re.match(r'^[a-z]\w*$', lhs):
+            names[node] = lhs
+        elif n_def[lhs] > 1:
+            # scratch variable: not to be used as a name
+            for k, v in list(names.items()):
+                if v == lhs:
+                    del names[k]
+
+    run(statements(function_body(src, name)), {})
+    nz = [(i, entries[i]) for i in order if not g.is_zero(entries[i])]
+    return g, nz, names
+
+
+# ---------------------------------------------------------------- printing
+
+PREC = {'?:': 0, '<': 1, '>': 1, '<=': 1, '>=': 1, '==': 1,
+        '+': 2, '-': 2, '*': 3, '/': 3, 'neg': 4}
+
+
+class Emitter:
+    def __init__(self, g, names, roots):
+        self.g = g
+        self.names = dict(names)
+        self.lines = []
+        self.done = set()
+        self.temps = set()
+        # reference counts over the graph reachable from the roots
+        refs = {}
+        seen = set()
+        stack = list(roots)
+        for r in roots:
+            refs[r] = refs.get(r, 0) + 1
+        while stack:
+            n = stack.pop()
+            if n in seen:
+                continue
+            seen.add(n)
+            op, args = g.nodes[n]
+            if op in ('num', 'var'):
+                continue
+            for a in args:
+                refs[a] = refs.get(a, 0) + 1
+                stack.append(a)
+        for n, c in refs.items():
+            op, _ = g.nodes[n]
+            if c > 1 and op not in ('num', 'var') and self.has_var(n):
+                self.temps.add(n)
+        self.n_tmp = 0
+
+    def has_var(self, n):
+        op, args = self.g.nodes[n]
+        if op == 'var':
+            return args != 'il::ii'
+        if op == 'num':
+            return False
+        return any(self.has_var(a) for a in args)
+
+    def name_of(self, n):
+        if n not in self.names:
+            self.names[n] = 'g_%d' % self.n_tmp
+            self.n_tmp += 1
+        return self.names[n]
+
+    def ensure(self, n):
+        """emits the temporaries needed by node n (post-order)"""
+        op, args = self.g.nodes[n]
+        if op in ('num', 'var') or n in self.done:
+            return
+        for a in args:
+            self.ensure(a)
+        if n in self.temps:
+            self.done.add(n)
+            typ = 'double' if self.g.types[n] == 'r' else \
+                'std::complex<double>'
+            self.emit('const %s %s = %s;' %
+                      (typ, self.name_of(n), self.expr(n, top=True)))
+
+    def expr(self, n, top=False):
+        if not top and n in self.done:
+            return self.names[n]
+        op, args = self.g.nodes[n]
+        if op in ('num', 'var'):
+            return args
+        if op.startswith('call:'):
+            return '%s(%s)' % (op[5:], ', '.join(self.expr(a)
+                                                 for a in args))
+        if op == 'neg':
+            return '-' + self.wrap(args[0], PREC['neg'], False)
+        if op == '?:':
+            return '(%s) ? %s : %s' % (self.expr(args[0]),
+                                       self.wrap(args[1], 1, False),
+                                       self.wrap(args[2], 1, False))
+        p = PREC[op]
+        return '%s %s %s' % (self.wrap(args[0], p, False), op,
+                             self.wrap(args[1], p, True))
+
+    def wrap(self, n, prec, right):
+        s = self.expr(n)
+        if n in self.done:
+            return s
+        op, _ = self.g.nodes[n]
+        if op in PREC:
+            q = PREC[op]
+            # same precedence on the right: keep the evaluation order
+            if q < prec or (right and q == prec) or \
+                    (op == 'neg' and prec == PREC['neg']):
+                return '(' + s + ')'
+        elif op == 'num' and s.startswith('-'):
+            return '(' + s + ')'
+        return s
+
+    def emit(self, line, indent=8):
+        self.lines += wrap_line(' ' * indent + line, indent + 8)
+
+
+def wrap_line(line, cont, width=80):
+    """breaks a long line at spaces around operators"""
+    out = []
+    while len(line) > width:
+        cut = -1
+        for k in range(width - 1, cont + 10, -1):
+            if line[k] == ' ' and line[k + 1] in '+-*/' and \
+                    line[k + 2] == ' ':
+                cut = k
+                break
+        if cut < 0:
+            break
+        out.append(line[:cut])
+        line = ' ' * cont + line[cut + 1:]
+    out.append(line)
+    return out
+
+
+# ----------------------------------------------------- real arithmetic
+
+class Realifier:
+    """Splits complex-valued nodes into real and imaginary parts
+    (real-valued nodes of the same graph); complex operations which
+    are not expanded (complex division, exp, polar) are kept as
+    complex values of which std::real / std::imag are taken"""
+
+    def __init__(self, g):
+        self.g = g
+        self.memo = {}
+        self.one = g.num('1.0')
+
+    def opaque(self, n):
+        g = self.g
+        return g.call('std::real', [n]), g.call('std::imag', [n])
+
+    def __call__(self, n):
+        if n not in self.memo:
+            self.memo[n] = self.split(n)
+        return self.memo[n]
+
+    def split(self, n):
+        g = self.g
+        z = g.zero
+        op, args = g.nodes[n]
+        if op == 'num':
+            return n, z
+        if op == 'var':
+            if args == 'il::ii':
+                return z, self.one
+            if g.types[n] == 'r':
+                return n, z
+            return self.opaque(n)
+        if op in ('+', '-'):
+            (ar, ai), (br, bi) = self(args[0]), self(args[1])
+            return g.binary(op, ar, br), g.binary(op, ai, bi)
+        if op == '*':
+            (ar, ai), (br, bi) = self(args[0]), self(args[1])
+            return (g.binary('-', g.binary('*', ar, br),
+                             g.binary('*', ai, bi)),
+                    g.binary('+', g.binary('*', ar, bi),
+                             g.binary('*', ai, br)))
+        if op == '/':
+            (ar, ai), (br, bi) = self(args[0]), self(args[1])
+            if g.is_zero(bi):
+                return g.binary('/', ar, br), g.binary('/', ai, br)
+            return self.opaque(n)
+        if op == 'neg':
+            ar, ai = self(args[0])
+            return g.unary('neg', ar), g.unary('neg', ai)
+        if op == 'call:std::conj':
+            ar, ai = self(args[0])
+            return ar, g.unary('neg', ai)
+        if op == 'call:std::real':
+            return self(args[0])[0], z
+        if op == 'call:std::imag':
+            return self(args[0])[1], z
+        if g.types[n] == 'r':
+            # real-valued functions, comparisons, conditionals
+            return n, z
+        return self.opaque(n)
+
+
+# ---------------------------------------------------------------- kernels
+
+def conj_pairs(g, nz, by_group):
+    """groups (a, b, c) whose coefficients are the conjugates of those of
+    another group: returns {group: source group}"""
+    conj_of = {}
+    for grp, items in by_group.items():
+        for src_grp, src_items in by_group.items():
+            if src_grp == grp or src_grp in conj_of:
+                continue
+            if len(items) != len(src_items):
+                continue
+            ok = True
+            for (k, n), (k_s, n_s) in zip(items, src_items):
+                if k != k_s or g.nodes[n] != ('call:std::conj', (n_s,)):
+                    ok = False
+                    break
+            if ok:
+                conj_of[grp] = src_grp
+                break
+    return conj_of
+
+
+def signature(params):
+    """arguments of a kernel: two per line, as in h_potential.h"""
+    out = []
+    for k in range(0, len(params), 2):
+        out.append('             ' + ', '.join(
+            '%s %s' % tp for tp in params[k:k + 2]) + ',')
+    out[0] = '            (' + out[0][13:]
+    return out
+
+
+def make_contr_kernel(src, ref_name, fun_name, params, n_f, doc):
+    """contracted kernel: s(a, b, c) += alpha * sum_k c(a, b, c, k) * f[k]"""
+    dims = (6, 4, 3, n_f)
+    var_types = {p: ('r' if t == 'double' else 'c') for t, p in params}
+    g, nz, names = evaluate(src, ref_name, var_types, dims)
+    by_group = {}
+    for idx, n in nz:
+        by_group.setdefault(idx[:3], []).append((idx[3], n))
+    for grp in by_group:
+        by_group[grp].sort()
+    conj_of = conj_pairs(g, nz, by_group)
+    groups = sorted(by_group)
+    roots = [n for grp in groups if grp not in conj_of
+             for _, n in by_group[grp]]
+    em = Emitter(g, names, roots)
+
+    # hand-written part of the signature
+    em.lines = []
+    head = ['    void %s' % fun_name] + signature(params) + [
+            '             const il::StaticArray<double, %d> &f, '
+            'double alpha,' % n_f,
+            '             il::io_t, il::StaticArray3D<std::complex<double>,'
+            ' 6, 4, 3> &s) {']
+    body = []
+    n_nz = 0
+    for grp in groups:
+        if grp in conj_of:
+            continue
+        terms = []
+        for k, n in by_group[grp]:
+            em.ensure(n)
+            terms.append('f[%d] * %s' % (k, em.wrap(n, PREC['*'], True)))
+            n_nz += 1
+        t_name = 't_%d_%d_%d' % grp
+        em.emit('const std::complex<double> %s = %s;' %
+                (t_name, ' + '.join(terms)))
+        em.emit('s(%d, %d, %d) += alpha * %s;' % (grp + (t_name,)))
+    for grp in groups:
+        if grp in conj_of:
+            em.emit('s(%d, %d, %d) += alpha * std::conj(t_%d_%d_%d);' %
+                    (grp + conj_of[grp]))
+            n_nz += len(by_group[grp])
+    body = em.lines
+    info = ['        // %d non-zero coefficients (of %d), %d of them '
+            'by conjugation;' % (n_nz, 6 * 4 * 3 * n_f,
+                                 sum(len(by_group[gr]) for gr in conj_of)),
+            '        // %d common sub-expressions' % len(em.temps)]
+    return '\n'.join(doc + head + info + body + ['    }', ''])
+
+
+def make_lim_kernel(src, ref_name, fun_name, params, doc):
+    """limit case: s(a, b, c) += alpha * c(a, b, c)"""
+    dims = (6, 4, 3)
+    var_types = {p: ('r' if t == 'double' else 'c') for t, p in params}
+    g, nz, names = evaluate(src, ref_name, var_types, dims)
+    nz.sort()
+    em = Emitter(g, names, [n for _, n in nz])
+    head = ['    void %s' % fun_name] + signature(params) + [
+            '             double alpha,',
+            '             il::io_t, il::StaticArray3D<std::complex<double>,'
+            ' 6, 4, 3> &s) {']
+    em.lines = []
+    for idx, n in nz:
+        em.ensure(n)
+        em.emit('s(%d, %d, %d) += alpha * %s;' %
+                (idx + (em.wrap(n, PREC['*'], True),)))
+    info = ['        // %d non-zero coefficients (of %d); '
+            '%d common sub-expressions' % (len(nz), 6 * 4 * 3,
+                                           len(em.temps))]
+    return '\n'.join(doc + head + info + em.lines + ['    }', ''])
+
+
+# components of the monomial coefficients (1st index) which are real (0, 5)
+# or the conjugates of others (2, 4) for real stress combinations (2nd index
+# 0: S11+S22, 3: S33); only the independent real quantities are kept
+REAL_B = (0, 3)
+CONJ_A = (2, 4)
+REAL_A = (0, 5)
+
+
+def real_parts(a, b):
+    """parts (0: real, 1: imaginary) of coefficient (a, b, .) to be kept"""
+    if b in REAL_B and a in CONJ_A:
+        return ()
+    if b in REAL_B and a in REAL_A:
+        return (0,)
+    return (0, 1)
+
+
+def make_real_kernel(src, ref_name, fun_name, params, n_f, doc):
+    """real-arithmetic kernel: s_re + I * s_im += alpha * dot(c, f)
+    (or alpha * c for the limit case, n_f == 0) for the independent
+    real quantities only"""
+    dims = (6, 4, 3, n_f) if n_f else (6, 4, 3)
+    var_types = {p: ('r' if t == 'double' else 'c') for t, p in params}
+    g, nz, names = evaluate(src, ref_name, var_types, dims)
+    rl = Realifier(g)
+    by_group = {}
+    for idx, n in nz:
+        k = idx[3] if n_f else -1
+        by_group.setdefault(idx[:3], []).append((k, n))
+    groups = sorted(by_group)
+    for grp in groups:
+        by_group[grp].sort()
+    # (group, part) -> [(k, real node)]
+    out = []
+    for grp in groups:
+        for part in real_parts(grp[0], grp[1]):
+            terms = [(k, rl(n)[part]) for k, n in by_group[grp]]
+            terms = [(k, n) for k, n in terms if not g.is_zero(n)]
+            if terms:
+                out.append((grp, part, terms))
+    roots = [n for _, _, terms in out for _, n in terms]
+    em = Emitter(g, names, roots)
+    em.lines = []
+    if n_f:
+        head = ['    void %s' % fun_name] + signature(params) + [
+            '             const il::StaticArray<double, %d> &f, '
+            'double alpha,' % n_f]
+    else:
+        head = ['    void %s' % fun_name] + signature(params) + [
+            '             double alpha,']
+    head += ['             il::io_t, il::StaticArray3D<double, 6, 4, 3> &s_re,',
+             '             il::StaticArray3D<double, 6, 4, 3> &s_im) {']
+    n_re = 0
+    for grp, part, terms in out:
+        for _, n in terms:
+            em.ensure(n)
+        if n_f:
+            rhs = ' + '.join('f[%d] * %s' % (k, em.wrap(n, PREC['*'], True))
+                             for k, n in terms)
+            rhs = '(' + rhs + ')' if len(terms) > 1 else rhs
+        else:
+            rhs = em.wrap(terms[0][1], PREC['*'], True)
+        em.emit('%s(%d, %d, %d) += alpha * %s;' %
+                ((('s_re', 's_im')[part],) + grp + (rhs,)))
+        n_re += 1
+    info = ['        // %d real quantities; %d common sub-expressions' %
+            (n_re, len(em.temps))]
+    return '\n'.join(doc + head + info + em.lines + ['    }', ''])
+
+
+HEADER = '''//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// GENERATED by Code_Gen/gen_h_potential.py from the reference functions
+// in h_potential.cpp -- do not edit; re-generate after changing those.
+//
+// Contraction of the hypersingular kernel coefficients (see h_potential.h)
+// with the constituing functions: only non-zero coefficients,
+// common sub-expressions computed once, conjugate blocks not computed;
+// *_r: the same in real arithmetic for the independent real quantities.
+
+#include <complex>
+#include <il/math.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray3D.h>
+#include "h_potential.h"
+
+namespace hfp3d {
+'''
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    src_path = sys.argv[1] if len(sys.argv) > 1 else \
+        os.path.join(root, 'src', 'h_potential.cpp')
+    out_path = sys.argv[2] if len(sys.argv) > 2 else \
+        os.path.join(root, 'src', 'h_potential_contr.cpp')
+    src = open(src_path).read()
+    parts = [HEADER]
+    parts.append(make_contr_kernel(
+        src, 's_ij_gen_h', 's_ij_gen_h_contr',
+        [('double', 'nu'), ('std::complex<double>', 'eix'),
+         ('double', 'h'), ('std::complex<double>', 'd')], 9,
+        ['// General case: s += alpha * dot(s_ij_gen_h(nu, eix, h, d), f)',
+         '']))
+    parts.append(make_contr_kernel(
+        src, 's_ij_red_h', 's_ij_red_h_contr',
+        [('double', 'nu'), ('std::complex<double>', 'eix'),
+         ('double', 'h')], 5,
+        ['// Special case (reduced summation):',
+         '// s += alpha * dot(s_ij_red_h(nu, eix, h), f)', '']))
+    parts.append(make_lim_kernel(
+        src, 's_ij_lim_h', 's_ij_lim_h_contr',
+        [('double', 'nu'), ('std::complex<double>', 'eix'),
+         ('std::complex<double>', 'd')],
+        ['// Limit case (h==0): s += alpha * s_ij_lim_h(nu, eix, d)', '']))
+    parts.append(make_real_kernel(
+        src, 's_ij_gen_h', 's_ij_gen_h_contr_r',
+        [('double', 'nu'), ('std::complex<double>', 'eix'),
+         ('double', 'h'), ('std::complex<double>', 'd')], 9,
+        ['// Real-arithmetic versions: s_re + I * s_im += ... (see above)',
+         '// for the independent real quantities only (see h_potential.h)',
+         '']))
+    parts.append(make_real_kernel(
+        src, 's_ij_red_h', 's_ij_red_h_contr_r',
+        [('double', 'nu'), ('std::complex<double>', 'eix'),
+         ('double', 'h')], 5, []))
+    parts.append(make_real_kernel(
+        src, 's_ij_lim_h', 's_ij_lim_h_contr_r',
+        [('double', 'nu'), ('std::complex<double>', 'eix'),
+         ('std::complex<double>', 'd')], 0, []))
+    parts.append('}\n')
+    open(out_path, 'w').write('\n'.join(parts))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,411 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define HFPX3D_USE_MMAP
+#elif defined(_WIN32)
+#include <sys/types.h>
+#include <sys/stat.h>
+#endif
+#include "binary_io.h"
+
+namespace hfp3d {
+
+    // byte order mark
+    const std::uint32_t bin_bom = 0x01020304;
+
+    // sizes of file & record headers
+    const il::int_t bin_f_hdr_size = 64;
+    const il::int_t bin_r_hdr_size = 64;
+    const il::int_t bin_name_size = 32;
+
+    inline il::int_t bin_padded(il::int_t n_bytes) {
+        return ((n_bytes + bin_align - 1) / bin_align) * bin_align;
+    }
+
+    // size of an open file in bytes, 64-bit on all platforms
+    // (std::ftell returns a long, i.e. 32 bits on LLP64); -1 on failure
+    inline il::int_t bin_file_size(std::FILE *file) {
+#if defined(HFPX3D_USE_MMAP)
+        struct stat f_st;
+        if (::fstat(::fileno(file), &f_st) != 0) {
+            return -1;
+        }
+        return static_cast<il::int_t>(f_st.st_size);
+#elif defined(_WIN32)
+        struct _stat64 f_st;
+        if (::_fstat64(::_fileno(file), &f_st) != 0) {
+            return -1;
+        }
+        return static_cast<il::int_t>(f_st.st_size);
+#else
+        if (std::fseek(file, 0, SEEK_END) != 0) {
+            return -1;
+        }
+        il::int_t f_size = std::ftell(file);
+        std::fseek(file, 0, SEEK_SET);
+        return f_size;
+#endif
+    }
+
+/////// Bin_Writer ///////
+
+    Bin_Writer::Bin_Writer
+            (const std::string &f_path,
+             const std::string &kind,
+             std::uint32_t version) :
+            file_{nullptr}, n_rec_{0}, ok_{false} {
+        IL_EXPECT_FAST(kind.size() == 8);
+        file_ = std::fopen(f_path.c_str(), "wb");
+        if (file_ == nullptr) {
+            return;
+        }
+        char hdr[bin_f_hdr_size];
+        std::memset(hdr, 0, bin_f_hdr_size);
+        std::memcpy(hdr, kind.data(), 8);
+        std::memcpy(hdr + 8, &version, 4);
+        std::memcpy(hdr + 12, &bin_bom, 4);
+        std::memcpy(hdr + 16, &n_rec_, 8);
+        ok_ = (std::fwrite(hdr, 1, bin_f_hdr_size, file_) ==
+               static_cast<std::size_t>(bin_f_hdr_size));
+    }
+
+    Bin_Writer::~Bin_Writer() {
+        if (file_ != nullptr) {
+            close();
+        }
+    }
+
+    void Bin_Writer::add_rec_
+            (const std::string &name, Bin_Type_T type,
+             il::int_t n0, il::int_t n1) {
+// This function writes the header of a record
+        IL_EXPECT_FAST(name.size() < bin_name_size);
+        if (!ok_) return;
+        char hdr[bin_r_hdr_size];
+        std::memset(hdr, 0, bin_r_hdr_size);
+        std::memcpy(hdr, name.data(), name.size());
+        std::uint32_t t = static_cast<std::uint32_t>(type);
+        std::int64_t sz[3] = {n0, n1, n0 * n1 * 8};
+        std::memcpy(hdr + bin_name_size, &t, 4);
+        std::memcpy(hdr + bin_name_size + 8, sz, 24);
+        ok_ = (std::fwrite(hdr, 1, bin_r_hdr_size, file_) ==
+               static_cast<std::size_t>(bin_r_hdr_size));
+        ++n_rec_;
+    }
+
+    void Bin_Writer::add_pad_(il::int_t n_bytes) {
+// This function pads the data of n_bytes to the record alignment
+        if (!ok_) return;
+        il::int_t n_pad = bin_padded(n_bytes) - n_bytes;
+        char pad[bin_align];
+        std::memset(pad, 0, bin_align);
+        if (n_pad > 0) {
+            ok_ = (std::fwrite(pad, 1, n_pad, file_) ==
+                   static_cast<std::size_t>(n_pad));
+        }
+    }
+
+    void Bin_Writer::add(const std::string &name, double value) {
+        add_rec_(name, Bin_Type_T::f64, 1, 1);
+        if (!ok_) return;
+        ok_ = (std::fwrite(&value, 8, 1, file_) == 1);
+        add_pad_(8);
+    }
+
+    void Bin_Writer::add(const std::string &name, il::int_t value) {
+        add_rec_(name, Bin_Type_T::i64, 1, 1);
+        if (!ok_) return;
+        std::int64_t v = value;
+        ok_ = (std::fwrite(&v, 8, 1, file_) == 1);
+        add_pad_(8);
+    }
+
+    void Bin_Writer::add
+            (const std::string &name, const il::Array<double> &a) {
+        const il::int_t n = a.size();
+        add_rec_(name, Bin_Type_T::f64, n, 1);
+        if (!ok_) return;
+        if (n > 0) {
+            ok_ = (std::fwrite(a.data(), 8, n, file_) ==
+                   static_cast<std::size_t>(n));
+        }
+        add_pad_(8 * n);
+    }
+
+    void Bin_Writer::add
+            (const std::string &name, const il::Array<il::int_t> &a) {
+        static_assert(sizeof(il::int_t) == 8, "64-bit il::int_t expected");
+        const il::int_t n = a.size();
+        add_rec_(name, Bin_Type_T::i64, n, 1);
+        if (!ok_) return;
+        if (n > 0) {
+            ok_ = (std::fwrite(a.data(), 8, n, file_) ==
+                   static_cast<std::size_t>(n));
+        }
+        add_pad_(8 * n);
+    }
+
+    void Bin_Writer::add
+            (const std::string &name, const il::Array2D<double> &a) {
+        const il::int_t n0 = a.size(0);
+        const il::int_t n1 = a.size(1);
+        add_rec_(name, Bin_Type_T::f64, n0, n1);
+        if (!ok_) return;
+        // column by column (il::Array2D can be padded)
+        for (il::int_t j = 0; j < n1 && n0 > 0 && ok_; ++j) {
+            ok_ = (std::fwrite(&a(0, j), 8, n0, file_) ==
+                   static_cast<std::size_t>(n0));
+        }
+        add_pad_(8 * n0 * n1);
+    }
+
+    void Bin_Writer::add
+            (const std::string &name, const il::Array2D<il::int_t> &a) {
+        static_assert(sizeof(il::int_t) == 8, "64-bit il::int_t expected");
+        const il::int_t n0 = a.size(0);
+        const il::int_t n1 = a.size(1);
+        add_rec_(name, Bin_Type_T::i64, n0, n1);
+        if (!ok_) return;
+        for (il::int_t j = 0; j < n1 && n0 > 0 && ok_; ++j) {
+            ok_ = (std::fwrite(&a(0, j), 8, n0, file_) ==
+                   static_cast<std::size_t>(n0));
+        }
+        add_pad_(8 * n0 * n1);
+    }
+
+    bool Bin_Writer::close() {
+        if (file_ == nullptr) {
+            return false;
+        }
+        if (ok_) {
+            ok_ = (std::fseek(file_, 16, SEEK_SET) == 0) &&
+                  (std::fwrite(&n_rec_, 8, 1, file_) == 1);
+        }
+        ok_ = (std::fclose(file_) == 0) && ok_;
+        file_ = nullptr;
+        return ok_;
+    }
+
+/////// Bin_Reader ///////
+
+    Bin_Reader::Bin_Reader
+            (const std::string &f_path,
+             const std::string &kind,
+             bool use_mmap) :
+            data_{nullptr}, size_{0}, is_mapped_{false},
+            buffer_{}, version_{0}, ok_{false}, rec_map_{} {
+        IL_EXPECT_FAST(kind.size() == 8);
+#ifdef HFPX3D_USE_MMAP
+        if (use_mmap) {
+            int fd = ::open(f_path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                return;
+            }
+            struct stat f_st;
+            if (::fstat(fd, &f_st) == 0 && f_st.st_size > 0) {
+                void *p = ::mmap(nullptr, static_cast<std::size_t>
+                        (f_st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p != MAP_FAILED) {
+                    data_ = static_cast<const char *>(p);
+                    size_ = static_cast<il::int_t>(f_st.st_size);
+                    is_mapped_ = true;
+                }
+            }
+            ::close(fd);
+        }
+#endif
+        if (!is_mapped_) {
+            std::FILE *file = std::fopen(f_path.c_str(), "rb");
+            if (file == nullptr) {
+                return;
+            }
+            const il::int_t f_size = bin_file_size(file);
+            if (f_size > 0) {
+                buffer_.resize(f_size);
+                if (std::fread(buffer_.data(), 1,
+                               static_cast<std::size_t>(f_size), file) ==
+                    static_cast<std::size_t>(f_size)) {
+                    data_ = buffer_.data();
+                    size_ = f_size;
+                }
+            }
+            std::fclose(file);
+        }
+        if (data_ == nullptr || size_ < bin_f_hdr_size) {
+            return;
+        }
+
+        // file header
+        std::uint32_t bom;
+        std::uint64_t n_rec;
+        std::memcpy(&version_, data_ + 8, 4);
+        std::memcpy(&bom, data_ + 12, 4);
+        std::memcpy(&n_rec, data_ + 16, 8);
+        if (std::memcmp(data_, kind.data(), 8) != 0 || bom != bin_bom) {
+            return;
+        }
+
+        // record index
+        il::int_t pos = bin_f_hdr_size;
+        for (std::uint64_t r = 0; r < n_rec; ++r) {
+            if (pos + bin_r_hdr_size > size_) {
+                return;
+            }
+            const char *hdr = data_ + pos;
+            char name[bin_name_size];
+            std::memcpy(name, hdr, bin_name_size);
+            name[bin_name_size - 1] = '\0';
+            std::uint32_t t;
+            std::int64_t sz[3];
+            std::memcpy(&t, hdr + bin_name_size, 4);
+            std::memcpy(sz, hdr + bin_name_size + 8, 24);
+            pos += bin_r_hdr_size;
+            if (sz[0] < 0 || sz[1] < 0 || sz[2] != 8 * sz[0] * sz[1] ||
+                pos + sz[2] > size_) {
+                return;
+            }
+            Bin_Rec_T rec;
+            rec.type = static_cast<Bin_Type_T>(t);
+            rec.n0 = sz[0];
+            rec.n1 = sz[1];
+            rec.offset = pos;
+            rec_map_[std::string{name}] = rec;
+            pos += bin_padded(sz[2]);
+        }
+        ok_ = true;
+    }
+
+    Bin_Reader::~Bin_Reader() {
+#ifdef HFPX3D_USE_MMAP
+        if (is_mapped_) {
+            ::munmap(const_cast<char *>(data_),
+                     static_cast<std::size_t>(size_));
+        }
+#endif
+    }
+
+    const Bin_Rec_T *Bin_Reader::find_
+            (const std::string &name, Bin_Type_T type) const {
+        auto it = rec_map_.find(name);
+        if (!ok_ || it == rec_map_.end() || it->second.type != type) {
+            return nullptr;
+        }
+        return &(it->second);
+    }
+
+    const double *Bin_Reader::view_f64
+            (const std::string &name,
+             il::io_t, il::int_t &n0, il::int_t &n1) const {
+        const Bin_Rec_T *rec = find_(name, Bin_Type_T::f64);
+        if (rec == nullptr) {
+            n0 = 0;
+            n1 = 0;
+            return nullptr;
+        }
+        n0 = rec->n0;
+        n1 = rec->n1;
+        return reinterpret_cast<const double *>(data_ + rec->offset);
+    }
+
+    bool Bin_Reader::get
+            (const std::string &name, il::io_t, double &value) const {
+        const Bin_Rec_T *rec = find_(name, Bin_Type_T::f64);
+        if (rec == nullptr || rec->n0 * rec->n1 != 1) {
+            return false;
+        }
+        std::memcpy(&value, data_ + rec->offset, 8);
+        return true;
+    }
+
+    bool Bin_Reader::get
+            (const std::string &name, il::io_t, il::int_t &value) const {
+        const Bin_Rec_T *rec = find_(name, Bin_Type_T::i64);
+        if (rec == nullptr || rec->n0 * rec->n1 != 1) {
+            return false;
+        }
+        std::int64_t v;
+        std::memcpy(&v, data_ + rec->offset, 8);
+        value = v;
+        return true;
+    }
+
+    bool Bin_Reader::get
+            (const std::string &name,
+             il::io_t, il::Array<double> &a) const {
+        const Bin_Rec_T *rec = find_(name, Bin_Type_T::f64);
+        if (rec == nullptr) {
+            return false;
+        }
+        const il::int_t n = rec->n0 * rec->n1;
+        a.resize(n);
+        if (n > 0) {
+            std::memcpy(a.data(), data_ + rec->offset, 8 * n);
+        }
+        return true;
+    }
+
+    bool Bin_Reader::get
+            (const std::string &name,
+             il::io_t, il::Array<il::int_t> &a) const {
+        const Bin_Rec_T *rec = find_(name, Bin_Type_T::i64);
+        if (rec == nullptr) {
+            return false;
+        }
+        const il::int_t n = rec->n0 * rec->n1;
+        a.resize(n);
+        if (n > 0) {
+            std::memcpy(a.data(), data_ + rec->offset, 8 * n);
+        }
+        return true;
+    }
+
+    bool Bin_Reader::get
+            (const std::string &name,
+             il::io_t, il::Array2D<double> &a) const {
+        const Bin_Rec_T *rec = find_(name, Bin_Type_T::f64);
+        if (rec == nullptr) {
+            return false;
+        }
+        const il::int_t n0 = rec->n0;
+        const il::int_t n1 = rec->n1;
+        a = il::Array2D<double>{n0, n1};
+        for (il::int_t j = 0; j < n1 && n0 > 0; ++j) {
+            std::memcpy(&a(0, j), data_ + rec->offset + 8 * n0 * j, 8 * n0);
+        }
+        return true;
+    }
+
+    bool Bin_Reader::get
+            (const std::string &name,
+             il::io_t, il::Array2D<il::int_t> &a) const {
+        const Bin_Rec_T *rec = find_(name, Bin_Type_T::i64);
+        if (rec == nullptr) {
+            return false;
+        }
+        const il::int_t n0 = rec->n0;
+        const il::int_t n1 = rec->n1;
+        a = il::Array2D<il::int_t>{n0, n1};
+        for (il::int_t j = 0; j < n1 && n0 > 0; ++j) {
+            std::memcpy(&a(0, j), data_ + rec->offset + 8 * n0 * j, 8 * n0);
+        }
+        return true;
+    }
+
+}
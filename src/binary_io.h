@@ -0,0 +1,135 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Versioned binary container of named arrays
+// (64-byte aligned records; can be memory-mapped on reading)
+
+#ifndef INC_HFPX3D_BINARY_IO_H
+#define INC_HFPX3D_BINARY_IO_H
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <il/Array.h>
+#include <il/Array2D.h>
+
+namespace hfp3d {
+
+    // File layout (native byte order):
+    // header (64 bytes): 8-char kind tag; version (uint32);
+    // byte order mark (uint32); number of records (uint64);
+    // then records: header (64 bytes): name (up to 31 chars);
+    // data type (uint32); 0 (uint32); size(0), size(1),
+    // data size in bytes (int64 each); then data (column-major)
+    // padded to a multiple of 64 bytes
+
+    const il::int_t bin_align = 64;
+
+    // data types of records
+    enum class Bin_Type_T : std::uint32_t {
+        f64 = 0, // double
+        i64 = 1  // il::int_t (64-bit)
+    };
+
+    // record location in the file
+    struct Bin_Rec_T {
+        Bin_Type_T type = Bin_Type_T::f64;
+        il::int_t n0 = 0;
+        il::int_t n1 = 0;
+        // offset of the data from the beginning of the file
+        il::int_t offset = 0;
+    };
+
+    class Bin_Writer {
+    private:
+        std::FILE *file_;
+        std::uint64_t n_rec_;
+        bool ok_;
+
+        void add_rec_(const std::string &name, Bin_Type_T type,
+                      il::int_t n0, il::int_t n1);
+        void add_pad_(il::int_t n_bytes);
+
+    public:
+        // kind: 8-char tag of the file content
+        Bin_Writer(const std::string &f_path,
+                   const std::string &kind,
+                   std::uint32_t version);
+        ~Bin_Writer();
+        Bin_Writer(const Bin_Writer &) = delete;
+        Bin_Writer &operator=(const Bin_Writer &) = delete;
+
+        bool is_ok() const { return ok_; };
+
+        void add(const std::string &name, double value);
+        void add(const std::string &name, il::int_t value);
+        void add(const std::string &name, const il::Array<double> &a);
+        void add(const std::string &name, const il::Array<il::int_t> &a);
+        void add(const std::string &name, const il::Array2D<double> &a);
+        void add(const std::string &name, const il::Array2D<il::int_t> &a);
+
+        // writes the number of records and closes the file
+        bool close();
+    };
+
+    class Bin_Reader {
+    private:
+        // whole file contents (either memory-mapped or read)
+        const char *data_;
+        il::int_t size_;
+        bool is_mapped_;
+        il::Array<char> buffer_;
+        std::uint32_t version_;
+        bool ok_;
+        std::unordered_map<std::string, Bin_Rec_T> rec_map_;
+
+        const Bin_Rec_T *find_(const std::string &name,
+                               Bin_Type_T type) const;
+
+    public:
+        // kind: expected 8-char tag of the file content;
+        // use_mmap: map the file into memory instead of reading it
+        // (POSIX; the records are then viewed in place, see view_f64)
+        Bin_Reader(const std::string &f_path,
+                   const std::string &kind,
+                   bool use_mmap);
+        ~Bin_Reader();
+        Bin_Reader(const Bin_Reader &) = delete;
+        Bin_Reader &operator=(const Bin_Reader &) = delete;
+
+        bool is_ok() const { return ok_; };
+        std::uint32_t version() const { return version_; };
+        bool has(const std::string &name) const {
+            return rec_map_.count(name) > 0;
+        };
+
+        // pointer to the (column-major) data of a record, no copy,
+        // valid while the reader exists
+        // (nullptr if the record is missing or of another type)
+        const double *view_f64(const std::string &name,
+                               il::io_t, il::int_t &n0,
+                               il::int_t &n1) const;
+
+        // copying a record to an array (false if the record is missing)
+        bool get(const std::string &name, il::io_t, double &value) const;
+        bool get(const std::string &name, il::io_t, il::int_t &value) const;
+        bool get(const std::string &name,
+                 il::io_t, il::Array<double> &a) const;
+        bool get(const std::string &name,
+                 il::io_t, il::Array<il::int_t> &a) const;
+        bool get(const std::string &name,
+                 il::io_t, il::Array2D<double> &a) const;
+        bool get(const std::string &name,
+                 il::io_t, il::Array2D<il::int_t> &a) const;
+    };
+
+}
+
+#endif //INC_HFPX3D_BINARY_IO_H
@@ -0,0 +1,251 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <utility>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include <il/linear_algebra.h>
+#include "bordered_solver.h"
+
+namespace hfp3d {
+
+    // Solution at a given level in the internal numbering
+    il::Array<double> ext_lu_solve_lev
+            (const Ext_LU_T &ext_lu,
+             il::int_t lev,
+             const il::Array<double> &f) {
+// This function solves M_lev * x = f recursively:
+// x_0 = inv(M_{lev-1}) * f_0; y = inv(S_lev) * (f_1 - C_lev * x_0);
+// x = [x_0 - W_lev * y, y]
+        if (lev == 0) {
+            return ext_lu.lu_l[0].solve(f);
+        }
+        const il::int_t n_0 = ext_lu.n_lev[lev - 1];
+        const il::int_t n_a = ext_lu.n_lev[lev] - n_0;
+        const il::Array2D<double> &w_b = ext_lu.w_b[lev];
+        const il::Array2D<double> &c_b = ext_lu.c_b[lev];
+
+        il::Array<double> f_0{n_0};
+        for (il::int_t i = 0; i < n_0; ++i) {
+            f_0[i] = f[i];
+        }
+        il::Array<double> x_0 = ext_lu_solve_lev(ext_lu, lev - 1, f_0);
+
+        il::Array<double> f_1{n_a};
+        for (il::int_t j = 0; j < n_a; ++j) {
+            f_1[j] = f[n_0 + j];
+        }
+        for (il::int_t i = 0; i < n_0; ++i) {
+            for (il::int_t j = 0; j < n_a; ++j) {
+                f_1[j] -= c_b(j, i) * x_0[i];
+            }
+        }
+        il::Array<double> y = ext_lu.lu_l[lev].solve(f_1);
+
+        il::Array<double> x{n_0 + n_a};
+        for (il::int_t i = 0; i < n_0; ++i) {
+            x[i] = x_0[i];
+        }
+        for (il::int_t j = 0; j < n_a; ++j) {
+            for (il::int_t i = 0; i < n_0; ++i) {
+                x[i] -= w_b(i, j) * y[j];
+            }
+            x[n_0 + j] = y[j];
+        }
+        return x;
+    }
+
+    Ext_LU_T make_ext_lu
+            (const il::Array2D<double> &matrix) {
+// This function factorizes the original (level 0) matrix
+        IL_EXPECT_FAST(matrix.size(0) == matrix.size(1));
+        const il::int_t n = matrix.size(0);
+
+        Ext_LU_T ext_lu;
+        il::Status status{};
+        ext_lu.lu_l.emplace_back(matrix, il::io, status);
+        status.abort_on_error();
+        ext_lu.n_lev.push_back(n);
+        ext_lu.w_b.emplace_back();
+        ext_lu.c_b.emplace_back();
+        ext_lu.perm = il::Array<il::int_t>{n};
+        for (il::int_t i = 0; i < n; ++i) {
+            ext_lu.perm[i] = i;
+        }
+        return ext_lu;
+    }
+
+    void extend_ext_lu
+            (const il::Array2D<double> &matrix,
+             const il::Array<il::int_t> &old_2_new,
+             il::io_t, Ext_LU_T &ext_lu) {
+// This function adds a level to the factorization:
+// B, C, D blocks are taken from the new matrix (the leading block
+// is assumed to be the same as the previous matrix),
+// W = inv(M_prev) * B takes n_a solutions with the previous factors,
+// and only the n_a * n_a Schur complement is factorized
+        IL_EXPECT_FAST(matrix.size(0) == matrix.size(1));
+        const il::int_t n = matrix.size(0);
+        const il::int_t n_0 = ext_lu.n_lev.back();
+        IL_EXPECT_FAST(old_2_new.size() == n_0);
+        IL_EXPECT_FAST(n >= n_0);
+        const il::int_t n_a = n - n_0;
+        const il::int_t lev = static_cast<il::int_t>(ext_lu.n_lev.size());
+
+        // internal numbering: old rows, then the added ones
+        il::Array<il::int_t> perm{n};
+        il::Array<int> is_old{n, 0};
+        for (il::int_t i = 0; i < n_0; ++i) {
+            il::int_t i_n = old_2_new[ext_lu.perm[i]];
+            IL_EXPECT_FAST(i_n >= 0 && i_n < n && is_old[i_n] == 0);
+            perm[i] = i_n;
+            is_old[i_n] = 1;
+        }
+        il::int_t k = n_0;
+        for (il::int_t i = 0; i < n; ++i) {
+            if (is_old[i] == 0) {
+                perm[k] = i;
+                ++k;
+            }
+        }
+        ext_lu.perm = std::move(perm);
+        if (n_a == 0) {
+            return;
+        }
+
+        // W = inv(M_prev) * B (column by column) and C
+        il::Array2D<double> w_b{n_0, n_a};
+        il::Array2D<double> c_b{n_a, n_0};
+        il::Array<double> b_v{n_0};
+        for (il::int_t j = 0; j < n_a; ++j) {
+            il::int_t j_e = ext_lu.perm[n_0 + j];
+            for (il::int_t i = 0; i < n_0; ++i) {
+                il::int_t i_e = ext_lu.perm[i];
+                b_v[i] = matrix(i_e, j_e);
+                c_b(j, i) = matrix(j_e, i_e);
+            }
+            il::Array<double> w_v = ext_lu_solve_lev(ext_lu, lev - 1, b_v);
+            for (il::int_t i = 0; i < n_0; ++i) {
+                w_b(i, j) = w_v[i];
+            }
+        }
+
+        // Schur complement S = D - C * W
+        il::Array2D<double> s_m{n_a, n_a};
+        for (il::int_t j = 0; j < n_a; ++j) {
+            il::int_t j_e = ext_lu.perm[n_0 + j];
+            for (il::int_t i = 0; i < n_a; ++i) {
+                s_m(i, j) = matrix(ext_lu.perm[n_0 + i], j_e);
+            }
+        }
+        for (il::int_t j = 0; j < n_a; ++j) {
+            for (il::int_t l = 0; l < n_0; ++l) {
+                double w = w_b(l, j);
+                for (il::int_t i = 0; i < n_a; ++i) {
+                    s_m(i, j) -= c_b(i, l) * w;
+                }
+            }
+        }
+
+        il::Status status{};
+        ext_lu.lu_l.emplace_back(s_m, il::io, status);
+        status.abort_on_error();
+        ext_lu.n_lev.push_back(n);
+        ext_lu.w_b.push_back(std::move(w_b));
+        ext_lu.c_b.push_back(std::move(c_b));
+    }
+
+    il::Array<double> ext_lu_solve
+            (const Ext_LU_T &ext_lu,
+             const il::Array<double> &rhs) {
+// This function solves the current (extended) system
+        const il::int_t n = ext_lu.perm.size();
+        IL_EXPECT_FAST(rhs.size() == n);
+        il::Array<double> f{n};
+        for (il::int_t i = 0; i < n; ++i) {
+            f[i] = rhs[ext_lu.perm[i]];
+        }
+        il::Array<double> x_i = ext_lu_solve_lev
+                (ext_lu, static_cast<il::int_t>(ext_lu.n_lev.size()) - 1, f);
+        il::Array<double> x{n};
+        for (il::int_t i = 0; i < n; ++i) {
+            x[ext_lu.perm[i]] = x_i[i];
+        }
+        return x;
+    }
+
+/////// Volume Control system ///////
+
+    il::Array2D<double> VC_Solver::elastic_block_
+            (const il::Array2D<double> &vc_matrix) {
+        IL_EXPECT_FAST(vc_matrix.size(0) == vc_matrix.size(1));
+        const il::int_t n = vc_matrix.size(0) - 1;
+        IL_EXPECT_FAST(n > 0);
+        il::Array2D<double> a_m{n, n};
+        for (il::int_t j = 0; j < n; ++j) {
+            for (il::int_t i = 0; i < n; ++i) {
+                a_m(i, j) = vc_matrix(i, j);
+            }
+        }
+        return a_m;
+    }
+
+    VC_Solver::VC_Solver(const il::Array2D<double> &vc_matrix) :
+            n_dof_{vc_matrix.size(0) - 1},
+            status_{},
+            lu_a_{elastic_block_(vc_matrix), il::io, status_},
+            c_v_{}, y_v_{}, s_c_{0.0} {
+// The elastic block is factorized, and the DD response
+// to unit pressure is found; the VC row & column are kept apart
+        status_.abort_on_error();
+        const il::int_t n = n_dof_;
+        il::Array<double> b_v{n};
+        c_v_ = il::Array<double>{n};
+        for (il::int_t j = 0; j < n; ++j) {
+            b_v[j] = vc_matrix(j, n);
+            c_v_[j] = vc_matrix(n, j);
+        }
+        y_v_ = lu_a_.solve(b_v);
+        double c_y = 0.0;
+        for (il::int_t j = 0; j < n; ++j) {
+            c_y += c_v_[j] * y_v_[j];
+        }
+        s_c_ = vc_matrix(n, n) - c_y;
+        // singular if the volume does not depend on pressure
+        IL_EXPECT_FAST(s_c_ != 0.0);
+    }
+
+    il::Array<double> VC_Solver::solve
+            (const il::Array<double> &rhs) const {
+// 2 triangular solves (with the factors of A)
+// and O(n_dof) operations for the pressure
+        const il::int_t n = n_dof_;
+        IL_EXPECT_FAST(rhs.size() == n + 1);
+
+        il::Array<double> t_v{n};
+        for (il::int_t j = 0; j < n; ++j) {
+            t_v[j] = rhs[j];
+        }
+        il::Array<double> x_0 = lu_a_.solve(t_v);
+        double c_x = 0.0;
+        for (il::int_t j = 0; j < n; ++j) {
+            c_x += c_v_[j] * x_0[j];
+        }
+        double p = (rhs[n] - c_x) / s_c_;
+
+        il::Array<double> x{n + 1};
+        for (il::int_t j = 0; j < n; ++j) {
+            x[j] = x_0[j] - p * y_v_[j];
+        }
+        x[n] = p;
+        return x;
+    }
+
+}
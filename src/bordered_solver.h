@@ -0,0 +1,98 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Direct solvers for bordered (block) systems
+// re-using the factorization of the leading block
+
+#ifndef INC_HFPX3D_BORDERED_SOLVER_H
+#define INC_HFPX3D_BORDERED_SOLVER_H
+
+#include <vector>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include <il/linear_algebra.h>
+
+namespace hfp3d {
+
+    // LU factorization of a matrix extended by rows & columns
+    // (e.g. VC matrix of a growing mesh): at each level k >= 1
+    // M_k = [M_{k-1}, B_k; C_k, D_k] is factorized through
+    // W_k = inv(M_{k-1}) * B_k and the Schur complement
+    // S_k = D_k - C_k * W_k (the factors of M_{k-1} are kept)
+    struct Ext_LU_T {
+        // LU of M_0 (level 0) and of S_k (levels k >= 1)
+        std::vector<il::LU<il::Array2D<double>>> lu_l{};
+
+        // size of M_k
+        std::vector<il::int_t> n_lev{};
+
+        // W_k and C_k (empty at level 0)
+        std::vector<il::Array2D<double>> w_b{};
+        std::vector<il::Array2D<double>> c_b{};
+
+        // internal (level-wise) numbering to the numbering
+        // of the current matrix: perm[i_int] = i_ext
+        il::Array<il::int_t> perm{};
+    };
+
+    // Factorization of the original (level 0) matrix
+    Ext_LU_T make_ext_lu
+            (const il::Array2D<double> &matrix);
+
+    // Extension of the factorization to the new matrix, where
+    // old_2_new[i] is the index in the new matrix of the i-th row
+    // (column) of the previous one; rows (columns) of the new matrix
+    // not listed in old_2_new are the added ones
+    void extend_ext_lu
+            (const il::Array2D<double> &matrix,
+             const il::Array<il::int_t> &old_2_new,
+             il::io_t, Ext_LU_T &ext_lu);
+
+    // Solution of M * x = rhs (in the numbering of the current matrix)
+    il::Array<double> ext_lu_solve
+            (const Ext_LU_T &ext_lu,
+             const il::Array<double> &rhs);
+
+    // Volume Control system [A, b; c, d] (see make_3dbem_matrix_vc)
+    // with the elastic block A factorized once:
+    // y = inv(A) * b, s = d - c * y (scalar Schur complement)
+    class VC_Solver {
+    private:
+        // number of DD DoF (size of A)
+        il::int_t n_dof_;
+        il::Status status_;
+        // LU factors of A
+        il::LU<il::Array2D<double>> lu_a_;
+        // volume vs DD row (c)
+        il::Array<double> c_v_;
+        // response of DD to unit pressure (y = inv(A) * b)
+        il::Array<double> y_v_;
+        // Schur complement (d - c * y)
+        double s_c_;
+
+        static il::Array2D<double> elastic_block_
+                (const il::Array2D<double> &vc_matrix);
+
+    public:
+        // factorization of the VC matrix ((n_dof + 1) * (n_dof + 1))
+        explicit VC_Solver(const il::Array2D<double> &vc_matrix);
+
+        il::int_t n_dof() const { return n_dof_; };
+
+        // solution for tractions (rhs[0 .. n_dof)) and volume
+        // (rhs[n_dof]) by back-substitution: x_0 = inv(A) * t;
+        // p = (v - c * x_0) / s; DD = x_0 - p * y;
+        // the pressure is the last entry of the result
+        il::Array<double> solve(const il::Array<double> &rhs) const;
+    };
+
+}
+
+#endif //INC_HFPX3D_BORDERED_SOLVER_H
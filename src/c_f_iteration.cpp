@@ -52,10 +52,11 @@ namespace hfp3d {
         IL_EXPECT_FAST(orig_ndof > 0 && orig_ndof <= full_ndof);
         IL_EXPECT_FAST(orig_ndof == orig_vc_sys.matrix.size(0));
 
-        // make sure elastic_traction_a = il::dot(orig_vc_sys.matrix, dd_a);
-        elastic_traction_a = il::dot(orig_vc_sys.matrix, dd_a);
-
         il::Array<double> dd_a = convert_DD_array_to_vector(m_data);
+
+        // make sure elastic_traction_a = il::dot(orig_vc_sys.matrix, dd_a);
+        // (DD vanish outside the fractured & active elements)
+        elastic_traction_a = dot_nonzero_dd(orig_vc_sys.matrix, dd_a);
         
         // current volume
         il::Array<double> v_int{orig_ndof, 0.0};
@@ -244,7 +245,13 @@ namespace hfp3d {
                     (orig_vc_sys.matrix, orig_dof_hndl,
                      dof_hndl, delta_t, delta_v);
         } else {
-            // growing mesh
+            // growing mesh (not implemented here): the original system
+            // is to be extended before truncation, i.e. after
+            // grow_mesh_at_tip (new elements at m_data.tip_set)
+            // orig_dof_h -> extend_dof_h_crack,
+            // orig_vc_sys.matrix -> extend_3dbem_matrix_vc
+            // (only the rows & columns of new elements are calculated),
+            // and the factorization -> extend_ext_lu (bordered_solver.h)
         }
 
         il::Status status{};
@@ -364,7 +371,7 @@ namespace hfp3d {
         }
 
         // adding calculated increments to the elastic traction
-        elastic_traction_a = il::dot(orig_vc_sys.matrix, dd_a);
+        elastic_traction_a = dot_nonzero_dd(orig_vc_sys.matrix, dd_a);
 
         // output (norm of delta_dd + delta_p; norm of delta_t)
         double res = il::norm(trc_dd_v, il::Norm::L1) +
@@ -0,0 +1,215 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <utility>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include "binary_io.h"
+#include "checkpoint.h"
+
+namespace hfp3d {
+
+    // 8-char tag of checkpoint files
+    const std::string ckpt_kind = "HFPXCKPT";
+
+    Checkpoint_Data_T make_checkpoint_data
+            (const Mesh_Geom_T &mesh,
+             const Mesh_Data_T &m_data,
+             const Frac_State_T &f_state,
+             const il::Array2D<double> &matrix) {
+// This function copies the mesh, solution data, fault state
+// and the matrix to a snapshot
+        Checkpoint_Data_T ckpt_d;
+        ckpt_d.nods = mesh.nods;
+        ckpt_d.conn = mesh.conn;
+        ckpt_d.vert_wts = mesh.vert_wts;
+        ckpt_d.time = m_data.time;
+        ckpt_d.ae_set = m_data.ae_set;
+        ckpt_d.fe_set = m_data.fe_set;
+        ckpt_d.tip_set = m_data.tip_set;
+        ckpt_d.dof_h_dd = m_data.dof_h_dd;
+        ckpt_d.dof_h_pp = m_data.dof_h_pp;
+        ckpt_d.dd = m_data.dd;
+        ckpt_d.pp = m_data.pp;
+        ckpt_d.f_state = f_state;
+        ckpt_d.matrix = matrix;
+        return ckpt_d;
+    }
+
+    void set_from_checkpoint
+            (Checkpoint_Data_T &ckpt_d,
+             il::io_t,
+             Mesh_Geom_T &mesh,
+             Mesh_Data_T &m_data,
+             Frac_State_T &f_state,
+             il::Array2D<double> &matrix) {
+// This function moves the snapshot data to the state
+// and rebuilds the mesh adjacency
+        mesh.nods = std::move(ckpt_d.nods);
+        mesh.conn = std::move(ckpt_d.conn);
+        mesh.vert_wts = std::move(ckpt_d.vert_wts);
+        mesh.topo = make_mesh_topo(mesh.conn, mesh.nods.size(1));
+        m_data.mesh = &mesh;
+        m_data.time = ckpt_d.time;
+        m_data.ae_set = std::move(ckpt_d.ae_set);
+        m_data.fe_set = std::move(ckpt_d.fe_set);
+        m_data.tip_set = std::move(ckpt_d.tip_set);
+        m_data.dof_h_dd = std::move(ckpt_d.dof_h_dd);
+        m_data.dof_h_pp = std::move(ckpt_d.dof_h_pp);
+        m_data.dd = std::move(ckpt_d.dd);
+        m_data.pp = std::move(ckpt_d.pp);
+        f_state = std::move(ckpt_d.f_state);
+        matrix = std::move(ckpt_d.matrix);
+    }
+
+    bool save_checkpoint
+            (const std::string &f_path,
+             const Checkpoint_Data_T &ckpt_d) {
+// This function writes the snapshot as named records
+// (the reading side tolerates missing optional records,
+// which is how the format is to evolve between versions)
+        Bin_Writer b_w{f_path, ckpt_kind, ckpt_version};
+        b_w.add("nods", ckpt_d.nods);
+        b_w.add("conn", ckpt_d.conn);
+        if (ckpt_d.vert_wts.size() > 0) {
+            b_w.add("vert_wts", ckpt_d.vert_wts);
+        }
+        b_w.add("time", ckpt_d.time);
+        b_w.add("ae_set", ckpt_d.ae_set);
+        b_w.add("fe_set", ckpt_d.fe_set);
+        b_w.add("tip_set", ckpt_d.tip_set);
+        b_w.add("dof_h_dd.n_dof", ckpt_d.dof_h_dd.n_dof);
+        b_w.add("dof_h_dd.dof_h", ckpt_d.dof_h_dd.dof_h);
+        b_w.add("dof_h_pp.n_dof", ckpt_d.dof_h_pp.n_dof);
+        b_w.add("dof_h_pp.dof_h", ckpt_d.dof_h_pp.dof_h);
+        b_w.add("dd", ckpt_d.dd);
+        b_w.add("pp", ckpt_d.pp);
+        b_w.add("mr_open", ckpt_d.f_state.mr_open);
+        b_w.add("mr_slip", ckpt_d.f_state.mr_slip);
+        b_w.add("friction_coef", ckpt_d.f_state.friction_coef);
+        b_w.add("slip_cohesion", ckpt_d.f_state.slip_cohesion);
+        b_w.add("open_cohesion", ckpt_d.f_state.open_cohesion);
+        if (ckpt_d.matrix.size(0) > 0) {
+            b_w.add("matrix", ckpt_d.matrix);
+        }
+        return b_w.close();
+    }
+
+    namespace {
+
+        // reading the snapshot records except for the matrix
+        bool load_ckpt_records
+                (const Bin_Reader &b_r,
+                 il::io_t, Checkpoint_Data_T &ckpt_d) {
+// The mesh, time, DoF handles and DD are required,
+// other records are optional (empty if missing)
+            if (!b_r.is_ok() || b_r.version() > ckpt_version) {
+                return false;
+            }
+            bool ok = b_r.get("nods", il::io, ckpt_d.nods) &&
+                      b_r.get("conn", il::io, ckpt_d.conn) &&
+                      b_r.get("time", il::io, ckpt_d.time) &&
+                      b_r.get("dof_h_dd.n_dof", il::io,
+                              ckpt_d.dof_h_dd.n_dof) &&
+                      b_r.get("dof_h_dd.dof_h", il::io,
+                              ckpt_d.dof_h_dd.dof_h) &&
+                      b_r.get("dd", il::io, ckpt_d.dd);
+            if (!ok) {
+                return false;
+            }
+            b_r.get("vert_wts", il::io, ckpt_d.vert_wts);
+            b_r.get("ae_set", il::io, ckpt_d.ae_set);
+            b_r.get("fe_set", il::io, ckpt_d.fe_set);
+            b_r.get("tip_set", il::io, ckpt_d.tip_set);
+            b_r.get("dof_h_pp.n_dof", il::io, ckpt_d.dof_h_pp.n_dof);
+            b_r.get("dof_h_pp.dof_h", il::io, ckpt_d.dof_h_pp.dof_h);
+            b_r.get("pp", il::io, ckpt_d.pp);
+            b_r.get("mr_open", il::io, ckpt_d.f_state.mr_open);
+            b_r.get("mr_slip", il::io, ckpt_d.f_state.mr_slip);
+            b_r.get("friction_coef", il::io, ckpt_d.f_state.friction_coef);
+            b_r.get("slip_cohesion", il::io, ckpt_d.f_state.slip_cohesion);
+            b_r.get("open_cohesion", il::io, ckpt_d.f_state.open_cohesion);
+            return true;
+        }
+
+    }
+
+    bool load_checkpoint
+            (const std::string &f_path,
+             bool use_mmap,
+             il::io_t, Checkpoint_Data_T &ckpt_d) {
+// This function reads the snapshot; the matrix is copied
+// from its record in the file contents (mapped or read)
+        Bin_Reader b_r{f_path, ckpt_kind, use_mmap};
+        if (!load_ckpt_records(b_r, il::io, ckpt_d)) {
+            return false;
+        }
+        il::int_t n0, n1;
+        const double *m_v = b_r.view_f64("matrix", il::io, n0, n1);
+        ckpt_d.matrix = il::Array2D<double>{n0, n1};
+        for (il::int_t j = 0; j < n1 && n0 > 0; ++j) {
+            std::memcpy(&ckpt_d.matrix(0, j), m_v + n0 * j,
+                        sizeof(double) * static_cast<std::size_t>(n0));
+        }
+        return true;
+    }
+
+/////// Checkpoint_Reader ///////
+
+    Checkpoint_Reader::Checkpoint_Reader(const std::string &f_path) :
+            b_r_{f_path, ckpt_kind, true} {}
+
+    bool Checkpoint_Reader::is_ok() const {
+        return b_r_.is_ok() && b_r_.version() <= ckpt_version;
+    }
+
+    bool Checkpoint_Reader::load
+            (il::io_t, Checkpoint_Data_T &ckpt_d) const {
+        return load_ckpt_records(b_r_, il::io, ckpt_d);
+    }
+
+    const double *Checkpoint_Reader::matrix_view
+            (il::io_t, il::int_t &n0, il::int_t &n1) const {
+        return b_r_.view_f64("matrix", il::io, n0, n1);
+    }
+
+/////// Checkpoint_Writer ///////
+
+    void Checkpoint_Writer::save
+            (const std::string &f_path,
+             const Mesh_Geom_T &mesh,
+             const Mesh_Data_T &m_data,
+             const Frac_State_T &f_state,
+             const il::Array2D<double> &matrix) {
+        wait();
+        ckpt_d_ = make_checkpoint_data(mesh, m_data, f_state, matrix);
+        f_path_ = f_path;
+        thread_ = std::thread{[this]() {
+            // writing to a temporary file first, so that a crash
+            // during the write does not spoil the previous checkpoint
+            std::string t_path = f_path_ + ".tmp";
+            ok_ = save_checkpoint(t_path, ckpt_d_) &&
+                  (std::rename(t_path.c_str(), f_path_.c_str()) == 0);
+        }};
+    }
+
+    bool Checkpoint_Writer::wait() {
+        if (thread_.joinable()) {
+            thread_.join();
+            // releasing the snapshot
+            ckpt_d_ = Checkpoint_Data_T{};
+        }
+        return ok_;
+    }
+
+}
@@ -0,0 +1,135 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Checkpoint/restart of the solution state (see binary_io.h for the format)
+
+#ifndef INC_HFPX3D_CHECKPOINT_H
+#define INC_HFPX3D_CHECKPOINT_H
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include "mesh_utilities.h"
+#include "cohesion_friction.h"
+#include "binary_io.h"
+
+namespace hfp3d {
+
+    // current version of the checkpoint file format
+    const std::uint32_t ckpt_version = 1;
+
+    // snapshot of the solution state
+    struct Checkpoint_Data_T {
+        // mesh geometry (can change as the fracture grows)
+        il::Array2D<double> nods{};
+        il::Array2D<il::int_t> conn{};
+        il::Array<double> vert_wts{};
+
+        // solution data (see Mesh_Data_T)
+        double time = 0;
+        il::Array<il::int_t> ae_set{};
+        il::Array<il::int_t> fe_set{};
+        il::Array2D<il::int_t> tip_set{};
+        DoF_Handle_T dof_h_dd{};
+        DoF_Handle_T dof_h_pp{};
+        il::Array2D<double> dd{};
+        il::Array<double> pp{};
+
+        // fault state
+        Frac_State_T f_state{};
+
+        // assembled (e.g. VC) matrix; empty if not saved
+        il::Array2D<double> matrix{};
+    };
+
+    // Copying the state to a snapshot
+    // (an empty matrix is not saved)
+    Checkpoint_Data_T make_checkpoint_data
+            (const Mesh_Geom_T &mesh,
+             const Mesh_Data_T &m_data,
+             const Frac_State_T &f_state,
+             const il::Array2D<double> &matrix);
+
+    // Moving a snapshot back to the state
+    // (m_data.mesh is linked to mesh)
+    void set_from_checkpoint
+            (Checkpoint_Data_T &ckpt_d,
+             il::io_t,
+             Mesh_Geom_T &mesh,
+             Mesh_Data_T &m_data,
+             Frac_State_T &f_state,
+             il::Array2D<double> &matrix);
+
+    // Writing a snapshot to a file (false on failure)
+    bool save_checkpoint
+            (const std::string &f_path,
+             const Checkpoint_Data_T &ckpt_d);
+
+    // Reading a snapshot from a file
+    // (use_mmap: map the file into memory instead of reading it;
+    // the matrix is then copied once, from the mapping);
+    // false on failure or a newer format version
+    bool load_checkpoint
+            (const std::string &f_path,
+             bool use_mmap,
+             il::io_t, Checkpoint_Data_T &ckpt_d);
+
+    // Restart without copying the matrix: the file is memory-mapped,
+    // load() reads the snapshot except for the matrix, which is viewed
+    // in place (column-major) while the reader exists
+    class Checkpoint_Reader {
+    private:
+        Bin_Reader b_r_;
+
+    public:
+        explicit Checkpoint_Reader(const std::string &f_path);
+
+        // false on failure or a newer format version
+        bool is_ok() const;
+
+        // the snapshot without the matrix (false on failure)
+        bool load(il::io_t, Checkpoint_Data_T &ckpt_d) const;
+
+        // the matrix (nullptr and 0 x 0 if not saved)
+        const double *matrix_view(il::io_t, il::int_t &n0,
+                                  il::int_t &n1) const;
+    };
+
+    // Asynchronous checkpoint writer: save() takes a snapshot
+    // and writes it on a separate thread, so that only the copying
+    // of the state is done in the calling (time-stepping) thread
+    class Checkpoint_Writer {
+    private:
+        std::thread thread_;
+        Checkpoint_Data_T ckpt_d_;
+        std::string f_path_;
+        bool ok_;
+
+    public:
+        Checkpoint_Writer() : thread_{}, ckpt_d_{}, f_path_{}, ok_{true} {};
+        ~Checkpoint_Writer() { wait(); };
+        Checkpoint_Writer(const Checkpoint_Writer &) = delete;
+        Checkpoint_Writer &operator=(const Checkpoint_Writer &) = delete;
+
+        // waits for the previous write, then starts a new one
+        void save(const std::string &f_path,
+                  const Mesh_Geom_T &mesh,
+                  const Mesh_Data_T &m_data,
+                  const Frac_State_T &f_state,
+                  const il::Array2D<double> &matrix);
+
+        // waits for the current write; false if it has failed
+        bool wait();
+    };
+
+}
+
+#endif //INC_HFPX3D_CHECKPOINT_H
@@ -17,6 +17,7 @@
 #include <il/StaticArray3D.h>
 #include <il/StaticArray4D.h>
 #include "elasticity_kernel_integration.h"
+#include "fast_math.h"
 #include "h_potential.h"
 //#include "t_potential.h"
 
@@ -64,6 +65,40 @@ namespace hfp3d {
         return c;
     }
 
+    void s_integral_gen_contr
+            (const int kernel_id,
+             double nu, std::complex<double> eix,
+             double h, std::complex<double> d,
+             const il::StaticArray<double, 9> &f, double alpha,
+             il::io_t, il::StaticArray3D<std::complex<double>, 6, 4, 3> &s) {
+        switch (kernel_id) {
+            case 1:
+                s_ij_gen_h_contr(nu, eix, h, d, f, alpha, il::io, s);
+                break;
+            case 0:
+                // s_ij_gen_t_contr(nu, eix, h, d, f, alpha, il::io, s);
+                break;
+            default:break;
+        }
+    }
+
+    void s_integral_red_contr
+            (const int kernel_id,
+             double nu, std::complex<double> eix,
+             double h,
+             const il::StaticArray<double, 5> &f, double alpha,
+             il::io_t, il::StaticArray3D<std::complex<double>, 6, 4, 3> &s) {
+        switch (kernel_id) {
+            case 1:
+                s_ij_red_h_contr(nu, eix, h, f, alpha, il::io, s);
+                break;
+            case 0:
+                // s_ij_red_t_contr(nu, eix, h, f, alpha, il::io, s);
+                break;
+            default:break;
+        }
+    }
+
     il::StaticArray3D<std::complex<double>, 6, 4, 3> s_integral_lim
             (const int kernel_id,
              double nu, std::complex<double> eix,
@@ -81,6 +116,78 @@ namespace hfp3d {
         return c;
     }
 
+    void s_integral_lim_contr
+            (const int kernel_id,
+             double nu, std::complex<double> eix,
+             std::complex<double> d,
+             double alpha,
+             il::io_t, il::StaticArray3D<std::complex<double>, 6, 4, 3> &s) {
+        switch (kernel_id) {
+            case 1:
+                s_ij_lim_h_contr(nu, eix, d, alpha, il::io, s);
+                break;
+            case 0:
+                // s_ij_lim_t_contr(nu, eix, sgnh, d, alpha, il::io, s);
+                break;
+            default:break;
+        }
+    }
+
+    void s_integral_gen_contr_r
+            (const int kernel_id,
+             double nu, std::complex<double> eix,
+             double h, std::complex<double> d,
+             const il::StaticArray<double, 9> &f, double alpha,
+             il::io_t, il::StaticArray3D<double, 6, 4, 3> &s_re,
+             il::StaticArray3D<double, 6, 4, 3> &s_im) {
+        switch (kernel_id) {
+            case 1:
+                s_ij_gen_h_contr_r(nu, eix, h, d, f, alpha,
+                                   il::io, s_re, s_im);
+                break;
+            case 0:
+                // s_ij_gen_t_contr_r(...);
+                break;
+            default:break;
+        }
+    }
+
+    void s_integral_red_contr_r
+            (const int kernel_id,
+             double nu, std::complex<double> eix,
+             double h,
+             const il::StaticArray<double, 5> &f, double alpha,
+             il::io_t, il::StaticArray3D<double, 6, 4, 3> &s_re,
+             il::StaticArray3D<double, 6, 4, 3> &s_im) {
+        switch (kernel_id) {
+            case 1:
+                s_ij_red_h_contr_r(nu, eix, h, f, alpha, il::io, s_re, s_im);
+                break;
+            case 0:
+                // s_ij_red_t_contr_r(...);
+                break;
+            default:break;
+        }
+    }
+
+    void s_integral_lim_contr_r
+            (const int kernel_id,
+             double nu, std::complex<double> eix,
+             std::complex<double> d,
+             double alpha,
+             il::io_t, il::StaticArray3D<double, 6, 4, 3> &s_re,
+             il::StaticArray3D<double, 6, 4, 3> &s_im) {
+        switch (kernel_id) {
+            case 1:
+                s_ij_lim_h_contr_r(nu, eix, d, alpha, il::io, s_re, s_im);
+                break;
+            case 0:
+                // s_ij_lim_t_contr_r(...);
+                break;
+            default:break;
+        }
+    }
+
 
 // Constituing functions for the integrals
 // of any kernel of the elasticity equation
@@ -152,4 +259,137 @@ namespace hfp3d {
         return fun_list;
     }
 
-}
\ No newline at end of file
+// Trigonometry-free variants of the above (real-valued)
+
+    il::StaticArray<double, 9> integral_cst_fun_r
+            (double h, double abs_d, double a, std::complex<double> eix) {
+
+        double d2 = abs_d * abs_d, a2 = a * a,
+                r = std::sqrt(h * h + a2 + d2),
+                r2 = r * r, r3 = r2 * r, r5 = r3 * r2,
+                ar = a / r, ar2 = ar * ar,
+                hr = std::fabs(h / r),
+                b = 1.0 / (r2 - a2), b2 = b * b, b3 = b2 * b;
+        double cos_x = std::real(eix), sin_x = std::imag(eix),
+                g0_x = std::atan((hr - 1.0) * sin_x * cos_x /
+                                 (cos_x * cos_x + hr * sin_x * sin_x)),
+                f0 = std::atanh(ar),
+                f1 = -0.5 * ar * b, f2 = 0.25 * (3.0 - ar2) * ar * b2,
+                f3 = -0.125 * (15.0 - 10.0 * ar2 + 3.0 * ar2 * ar2) * ar * b3;
+
+        il::StaticArray<double, 9> fun_list;
+        fun_list[0] = r;
+        fun_list[1] = 1.0 / r;
+        fun_list[2] = 1.0 / r3;
+        fun_list[3] = 1.0 / r5;
+        fun_list[4] = g0_x;
+        fun_list[5] = f0;
+        fun_list[6] = f1;
+        fun_list[7] = f2;
+        fun_list[8] = f3;
+
+        return fun_list;
+    }
+
+    il::StaticArray<double, 5> integral_cst_fun_red_r
+            (double h, double abs_d, double a) {
+
+        double h2 = h * h, h4 = h2 * h2, h6 = h4 * h2,
+                d2 = abs_d * abs_d, a2 = a * a,
+                ro = std::sqrt(a2 + d2),
+                r = std::sqrt(h2 + a2 + d2),
+                rr = ro / r, rr2 = rr * rr, rr4 = rr2 * rr2,
+                f0 = std::atanh(rr), f1 = -0.5 * rr / h2, f2 =
+                0.25 * (3.0 - rr2) * rr / h4,
+                f3 = -0.125 * (15.0 - 10.0 * rr2 + 3.0 * rr4) * rr / h6;
+
+        il::StaticArray<double, 5> fun_list;
+        fun_list[0] = 1.0;
+        fun_list[1] = f0;
+        fun_list[2] = f1;
+        fun_list[3] = f2;
+        fun_list[4] = f3;
+
+        return fun_list;
+    }
+
+// Batched versions (vectorized atan and atanh)
+
+    void integral_cst_fun_batch
+            (const il::Array<double> &h,
+             const il::Array<double> &abs_d,
+             const il::Array<double> &a,
+             const il::Array<std::complex<double>> &eix,
+             il::io_t, il::Array2D<double> &fun_list,
+             il::Array<double> &g_arg, il::Array<double> &f_arg) {
+        const il::int_t n = h.size();
+        IL_EXPECT_FAST(abs_d.size() == n);
+        IL_EXPECT_FAST(a.size() == n);
+        IL_EXPECT_FAST(eix.size() == n);
+        IL_EXPECT_FAST(fun_list.size(0) == n);
+        IL_EXPECT_FAST(fun_list.size(1) == 9);
+
+        // arguments of atan and atanh
+        g_arg.resize(n);
+        f_arg.resize(n);
+        for (il::int_t j = 0; j < n; ++j) {
+            double d2 = abs_d[j] * abs_d[j], a2 = a[j] * a[j],
+                    r = std::sqrt(h[j] * h[j] + a2 + d2),
+                    r2 = r * r, r3 = r2 * r, r5 = r3 * r2,
+                    ar = a[j] / r, ar2 = ar * ar,
+                    hr = std::fabs(h[j] / r),
+                    b = 1.0 / (r2 - a2), b2 = b * b, b3 = b2 * b;
+            double cos_x = std::real(eix[j]), sin_x = std::imag(eix[j]);
+            g_arg[j] = (hr - 1.0) * sin_x * cos_x /
+                       (cos_x * cos_x + hr * sin_x * sin_x);
+            f_arg[j] = ar;
+            fun_list(j, 0) = r;
+            fun_list(j, 1) = 1.0 / r;
+            fun_list(j, 2) = 1.0 / r3;
+            fun_list(j, 3) = 1.0 / r5;
+            fun_list(j, 6) = -0.5 * ar * b;
+            fun_list(j, 7) = 0.25 * (3.0 - ar2) * ar * b2;
+            fun_list(j, 8) = -0.125 * (15.0 - 10.0 * ar2 + 3.0 * ar2 * ar2) *
+                             ar * b3;
+        }
+        fast_atan(g_arg, il::io, g_arg);
+        fast_atanh(f_arg, il::io, f_arg);
+        for (il::int_t j = 0; j < n; ++j) {
+            fun_list(j, 4) = g_arg[j];
+            fun_list(j, 5) = f_arg[j];
+        }
+    }
+
+    void integral_cst_fun_red_batch
+            (const il::Array<double> &h,
+             const il::Array<double> &abs_d,
+             const il::Array<double> &a,
+             il::io_t, il::Array2D<double> &fun_list,
+             il::Array<double> &f_arg) {
+        const il::int_t n = h.size();
+        IL_EXPECT_FAST(abs_d.size() == n);
+        IL_EXPECT_FAST(a.size() == n);
+        IL_EXPECT_FAST(fun_list.size(0) == n);
+        IL_EXPECT_FAST(fun_list.size(1) == 5);
+
+        f_arg.resize(n);
+        for (il::int_t j = 0; j < n; ++j) {
+            double h2 = h[j] * h[j], h4 = h2 * h2, h6 = h4 * h2,
+                    d2 = abs_d[j] * abs_d[j], a2 = a[j] * a[j],
+                    ro = std::sqrt(a2 + d2),
+                    r = std::sqrt(h2 + a2 + d2),
+                    rr = ro / r, rr2 = rr * rr, rr4 = rr2 * rr2;
+            f_arg[j] = rr;
+            fun_list(j, 0) = 1.0;
+            fun_list(j, 2) = -0.5 * rr / h2;
+            fun_list(j, 3) = 0.25 * (3.0 - rr2) * rr / h4;
+            fun_list(j, 4) = -0.125 * (15.0 - 10.0 * rr2 + 3.0 * rr4) *
+                             rr / h6;
+        }
+        fast_atanh(f_arg, il::io, f_arg);
+        for (il::int_t j = 0; j < n; ++j) {
+            fun_list(j, 1) = f_arg[j];
+        }
+    }
+
+}
@@ -11,6 +11,8 @@
 #define INC_HFPX3D_ELAST_KER_INT_H
 
 #include <complex>
+#include <il/Array.h>
+#include <il/Array2D.h>
 #include <il/StaticArray.h>
 #include <il/StaticArray3D.h>
 #include <il/StaticArray4D.h>
@@ -39,11 +41,64 @@ namespace hfp3d {
                  double nu, std::complex<double> eix,
                  double h);
 
+// The same contracted with (real-valued) constituing functions f
+// and accumulated: s += alpha * dot(s_integral_gen(...), f)
+// without forming the coefficient matrices
+
+    void s_integral_gen_contr
+                (const int kernel_id,
+                 double nu, std::complex<double> eix,
+                 double h, std::complex<double> d,
+                 const il::StaticArray<double, 9> &f, double alpha,
+                 il::io_t, il::StaticArray3D<std::complex<double>, 6, 4, 3> &s);
+
+    void s_integral_red_contr
+                (const int kernel_id,
+                 double nu, std::complex<double> eix,
+                 double h,
+                 const il::StaticArray<double, 5> &f, double alpha,
+                 il::io_t, il::StaticArray3D<std::complex<double>, 6, 4, 3> &s);
+
     il::StaticArray3D<std::complex<double>, 6, 4, 3> s_integral_lim
                 (const int ker,
                  double nu, std::complex<double> eix,
                  std::complex<double> d);
 
+    // s += alpha * s_integral_lim(...)
+    void s_integral_lim_contr
+                (const int kernel_id,
+                 double nu, std::complex<double> eix,
+                 std::complex<double> d,
+                 double alpha,
+                 il::io_t, il::StaticArray3D<std::complex<double>, 6, 4, 3> &s);
+
+// Real-arithmetic versions (independent real quantities only,
+// see s_ij_gen_h_contr_r in h_potential.h)
+
+    void s_integral_gen_contr_r
+                (const int kernel_id,
+                 double nu, std::complex<double> eix,
+                 double h, std::complex<double> d,
+                 const il::StaticArray<double, 9> &f, double alpha,
+                 il::io_t, il::StaticArray3D<double, 6, 4, 3> &s_re,
+                 il::StaticArray3D<double, 6, 4, 3> &s_im);
+
+    void s_integral_red_contr_r
+                (const int kernel_id,
+                 double nu, std::complex<double> eix,
+                 double h,
+                 const il::StaticArray<double, 5> &f, double alpha,
+                 il::io_t, il::StaticArray3D<double, 6, 4, 3> &s_re,
+                 il::StaticArray3D<double, 6, 4, 3> &s_im);
+
+    void s_integral_lim_contr_r
+                (const int kernel_id,
+                 double nu, std::complex<double> eix,
+                 std::complex<double> d,
+                 double alpha,
+                 il::io_t, il::StaticArray3D<double, 6, 4, 3> &s_re,
+                 il::StaticArray3D<double, 6, 4, 3> &s_im);
+
 
 // Constituing functions for the integrals
 // of any kernel of the elasticity equation
@@ -64,6 +119,38 @@ namespace hfp3d {
     il::StaticArray<std::complex<double>, 5> integral_cst_fun_red
             (double h, std::complex<double> d, double a);
 
+// Trigonometry-free (real-valued) variants: the angle x is not used;
+// g0 - x = atan(hr * tan(x)) - x (|x| < pi/2) is evaluated as
+// atan((hr - 1) * sin(x) * cos(x) / (cos(x)^2 + hr * sin(x)^2))
+// abs_d = std::abs(d)
+
+    il::StaticArray<double, 9> integral_cst_fun_r
+            (double h, double abs_d, double a, std::complex<double> eix);
+
+    il::StaticArray<double, 5> integral_cst_fun_red_r
+            (double h, double abs_d, double a);
+
+// Batched versions of the above for n sets of arguments
+// (e.g. all collocation points of many target elements vs one edge end);
+// column k of fun_list (n*9 or n*5) holds the k-th function.
+// atan and atanh are evaluated by vectorized approximations (fast_math.h);
+// g_arg and f_arg are scratch arrays (resized to n), kept by the caller
+
+    void integral_cst_fun_batch
+            (const il::Array<double> &h,
+             const il::Array<double> &abs_d,
+             const il::Array<double> &a,
+             const il::Array<std::complex<double>> &eix,
+             il::io_t, il::Array2D<double> &fun_list,
+             il::Array<double> &g_arg, il::Array<double> &f_arg);
+
+    void integral_cst_fun_red_batch
+            (const il::Array<double> &h,
+             const il::Array<double> &abs_d,
+             const il::Array<double> &a,
+             il::io_t, il::Array2D<double> &fun_list,
+             il::Array<double> &f_arg);
+
 }
 
 #endif //INC_HFPX3D_ELAST_KER_INT_H
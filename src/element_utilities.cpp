@@ -358,6 +358,226 @@ namespace hfp3d {
         return shift_2_z;
     }
 
+    il::StaticArray2D<std::complex<double>, 6, 6> shift_el_sfm
+            (const il::StaticArray2D<std::complex<double>, 6, 6> &sfm,
+             std::complex<double> z) {
+        // shape functions (rows of sfm: coefficients of the monomials
+        // 1, tau, conj(tau), tau^2, conj(tau)^2, tau*conj(tau))
+        // re-expanded at the point z (tau -> tau + z);
+        // the same as il::dot(sfm, shift_el_sfm(z)) in ~1/4 of operations
+        std::complex<double> zc = std::conj(z);
+        il::StaticArray2D<std::complex<double>, 6, 6> sfm_z;
+        for (int j = 0; j < 6; ++j) {
+            std::complex<double> s1 = sfm(j, 1), s2 = sfm(j, 2),
+                    s3 = sfm(j, 3), s4 = sfm(j, 4), s5 = sfm(j, 5);
+            sfm_z(j, 0) = sfm(j, 0) + z * (s1 + z * s3 + zc * s5) +
+                          zc * (s2 + zc * s4);
+            sfm_z(j, 1) = s1 + 2.0 * z * s3 + zc * s5;
+            sfm_z(j, 2) = s2 + 2.0 * zc * s4 + z * s5;
+            sfm_z(j, 3) = s3;
+            sfm_z(j, 4) = s4;
+            sfm_z(j, 5) = s5;
+        }
+        return sfm_z;
+    }
+
+// Reference-element SF data
+
+    il::StaticArray<double, 6> el_p2_sf_at_bc
+            (const il::StaticArray<double, 3> &bc,
+             const il::StaticArray<double, 3> &vert_wts) {
+// This function calculates the values of nodal shape functions
+// (see make_el_sfm_nonuniform) at a point with barycentric coordinates bc.
+// The edge node across the v-th vertex has barycentric coordinates
+// a[m] = w[m] / (w[m] + w[l]), a[l] = w[l] / (w[m] + w[l]);
+// its SF is L[m]*L[l] / (a[m]*a[l]), and the SF of the v-th vertex
+// is L[v] minus the SF of the 2 adjacent edge nodes times a[v] there
+// (L[v]*(2*L[v]-1) and 4*L[m]*L[l] for equal weights)
+        il::StaticArray<double, 6> sf;
+        for (int v = 0; v < 3; ++v) {
+            int m = (v + 1) % 3;
+            int l = (m + 1) % 3;
+            double a_m = vert_wts[m] / (vert_wts[m] + vert_wts[l]);
+            sf[v + 3] = bc[m] * bc[l] / (a_m * (1.0 - a_m));
+        }
+        for (int v = 0; v < 3; ++v) {
+            sf[v] = bc[v];
+            for (int u = 1; u < 3; ++u) {
+                // the edge across the vertex (v + u) % 3
+                int e = (v + u) % 3;
+                int o = (v + 3 - u) % 3;
+                double a_v = vert_wts[v] / (vert_wts[v] + vert_wts[o]);
+                sf[v] -= a_v * sf[e + 3];
+            }
+        }
+        return sf;
+    }
+
+    il::StaticArray<il::StaticArray<double, 6>, 6> el_p2_sf_cp_ref
+            (double beta) {
+// This function calculates the values of nodal shape functions
+// (see make_el_sfm_uniform) at collocation points (see el_cp_uniform)
+// from barycentric coordinates of the latter: L[v] for the v-th vertex;
+// the SF are L[v]*(2*L[v]-1) at the vertices
+// and 4*L[m]*L[l] at the middle of the edge across the v-th vertex;
+// does not depend on the element's geometry
+        il::StaticArray<il::StaticArray<double, 6>, 6> sf_cp;
+        for (int n = 0; n < 6; ++n) {
+            // barycentric coordinates of n-th CP
+            il::StaticArray<double, 3> bc{beta / 3.0};
+            if (n < 3) {
+                bc[n] += 1.0 - beta;
+            } else {
+                bc[(n + 1) % 3] += 0.5 * (1.0 - beta);
+                bc[(n + 2) % 3] += 0.5 * (1.0 - beta);
+            }
+            for (int v = 0; v < 3; ++v) {
+                int m = (v + 1) % 3;
+                int l = (m + 1) % 3;
+                (sf_cp[n])[v] = bc[v] * (2.0 * bc[v] - 1.0);
+                (sf_cp[n])[v + 3] = 4.0 * bc[m] * bc[l];
+            }
+        }
+        return sf_cp;
+    }
+
+    il::StaticArray<il::StaticArray<double, 6>, 6> el_p2_sf_cp_ref
+            (double beta,
+             const il::StaticArray<double, 3> &vert_wts) {
+// The same for non-trivial edge partitioning (see el_cp_nonuniform)
+        il::StaticArray<il::StaticArray<double, 6>, 6> sf_cp;
+        for (int n = 0; n < 6; ++n) {
+            // barycentric coordinates of n-th CP
+            il::StaticArray<double, 3> bc{beta / 3.0};
+            if (n < 3) {
+                bc[n] += 1.0 - beta;
+            } else {
+                int m = (n + 1) % 3;
+                int l = (n + 2) % 3;
+                double w_ml = vert_wts[m] + vert_wts[l];
+                bc[m] += (1.0 - beta) * vert_wts[m] / w_ml;
+                bc[l] += (1.0 - beta) * vert_wts[l] / w_ml;
+            }
+            sf_cp[n] = el_p2_sf_at_bc(bc, vert_wts);
+        }
+        return sf_cp;
+    }
+
+    il::StaticArray<double, 6> el_p2_sf_integral_ref() {
+// This function returns the integrals of nodal shape functions
+// (see make_el_sfm_uniform) over an element of unit area:
+// zero for vertex nodes, 1/3 for edge nodes
+        il::StaticArray<double, 6> sf_int{0.0};
+        for (int v = 3; v < 6; ++v) {
+            sf_int[v] = 1.0 / 3.0;
+        }
+        return sf_int;
+    }
+
+    il::StaticArray<double, 6> el_p2_sf_integral_ref
+            (const il::StaticArray<double, 3> &vert_wts) {
+// The same for non-trivial edge partitioning (see el_p2_sf_at_bc):
+// the integrals of L[v] and L[m]*L[l] are 1/3 and 1/12
+        il::StaticArray<double, 6> sf_int;
+        for (int v = 0; v < 3; ++v) {
+            int m = (v + 1) % 3;
+            int l = (m + 1) % 3;
+            double a_m = vert_wts[m] / (vert_wts[m] + vert_wts[l]);
+            sf_int[v + 3] = 1.0 / (12.0 * a_m * (1.0 - a_m));
+        }
+        for (int v = 0; v < 3; ++v) {
+            sf_int[v] = 1.0 / 3.0;
+            for (int u = 1; u < 3; ++u) {
+                int e = (v + u) % 3;
+                int o = (v + 3 - u) % 3;
+                double a_v = vert_wts[v] / (vert_wts[v] + vert_wts[o]);
+                sf_int[v] -= a_v * sf_int[e + 3];
+            }
+        }
+        return sf_int;
+    }
+
+    double el_area(const il::StaticArray2D<double, 3, 3> &el_vert) {
+// This function calculates the area of a triangular element
+        il::StaticArray<double, 3> a, b;
+        for (int j = 0; j < 3; ++j) {
+            a[j] = el_vert(j, 1) - el_vert(j, 0);
+            b[j] = el_vert(j, 2) - el_vert(j, 0);
+        }
+        return 0.5 * l2norm(il::cross(a, b));
+    }
+
+// Elements of order p = 0, 1, 2
+
+    template <int p>
+    il::StaticArray2D<double, 6, El_Order_T<p>::nnpe> el_sf_p_at_p2_nodes
+            (const il::StaticArray<double, 3> &vert_wts) {
+// The SF of a lower order element at the 2nd order nodes:
+// p = 0: 1 at all nodes;
+// p = 1: L[v] (1 at the v-th vertex, w[v] / (w[v] + w[o])
+// at the node of the edge (v, o), 0 at the other nodes);
+// p = 2: identity
+        const int nnpe = El_Order_T<p>::nnpe;
+        il::StaticArray2D<double, 6, nnpe> sf_p2{0.0};
+        for (int n = 0; n < 6; ++n) {
+            for (int m = 0; m < nnpe; ++m) {
+                if (p == 0) {
+                    sf_p2(n, m) = 1.0;
+                } else if (p == 1) {
+                    if (n < 3) {
+                        sf_p2(n, m) = (n == m) ? 1.0 : 0.0;
+                    } else {
+                        // the edge across the vertex n - 3
+                        int o = 3 - (n - 3) - m;
+                        sf_p2(n, m) = (n - 3 == m) ? 0.0 :
+                                      vert_wts[m] / (vert_wts[m] + vert_wts[o]);
+                    }
+                } else {
+                    sf_p2(n, m) = (n == m) ? 1.0 : 0.0;
+                }
+            }
+        }
+        return sf_p2;
+    }
+
+    template <int p>
+    il::StaticArray<il::StaticArray<double, 3>, El_Order_T<p>::nnpe> el_cp_p
+            (const Element_Struct_T &ele_s) {
+        const int nnpe = El_Order_T<p>::nnpe;
+        il::StaticArray<il::StaticArray<double, 3>, nnpe> cp_crd;
+        if (p == 0) {
+            for (int k = 0; k < 3; ++k) {
+                cp_crd[0][k] = (ele_s.vert(k, 0) + ele_s.vert(k, 1) +
+                                ele_s.vert(k, 2)) / 3.0;
+            }
+        } else if (p == 1) {
+            // barycentric coordinates (2/3, 1/6, 1/6), i.e. beta = 1/2
+            il::StaticArray<il::StaticArray<double, 3>, 6> cp_p2 =
+                    el_cp_uniform(ele_s.vert, 0.5);
+            for (int n = 0; n < nnpe; ++n) {
+                cp_crd[n] = cp_p2[n];
+            }
+        } else {
+            for (int n = 0; n < nnpe; ++n) {
+                cp_crd[n] = ele_s.cp_crd[n];
+            }
+        }
+        return cp_crd;
+    }
+
+    template il::StaticArray2D<double, 6, 1> el_sf_p_at_p2_nodes<0>
+            (const il::StaticArray<double, 3> &vert_wts);
+    template il::StaticArray2D<double, 6, 3> el_sf_p_at_p2_nodes<1>
+            (const il::StaticArray<double, 3> &vert_wts);
+    template il::StaticArray2D<double, 6, 6> el_sf_p_at_p2_nodes<2>
+            (const il::StaticArray<double, 3> &vert_wts);
+    template il::StaticArray<il::StaticArray<double, 3>, 1> el_cp_p<0>
+            (const Element_Struct_T &ele_s);
+    template il::StaticArray<il::StaticArray<double, 3>, 3> el_cp_p<1>
+            (const Element_Struct_T &ele_s);
+    template il::StaticArray<il::StaticArray<double, 3>, 6> el_cp_p<2>
+            (const Element_Struct_T &ele_s);
+
 // Collocation points
 
     il::StaticArray<il::StaticArray<double, 3>, 6> el_cp_uniform
@@ -431,7 +651,6 @@ namespace hfp3d {
 
     Element_Struct_T set_ele_struct
             (il::StaticArray2D<double, 3, 3> &el_vert,
-             //il::StaticArray<double, 3> &vert_wts,
              double beta) {
 // This function defines the whole set of element properties:
 // vertex coordinates, rotational tensor, collocation points,
@@ -443,38 +662,42 @@ namespace hfp3d {
             for (il::int_t k = 0; k < 3; ++k) {
                 ele_s.vert(k, j) = el_vert(k, j);
             }
-            // set vert_wts[j]
+            ele_s.vert_wts[j] = 1.0;
         }
 
         // Basis (shape) functions and rotation tensor of the el-t
         ele_s.sf_m = make_el_sfm_uniform(ele_s.vert, il::io, ele_s.r_tensor);
-        //ele_s.sf_m = make_el_sfm_nonuniform
-        // (ele_s.r_tensor, ele_s.el_vert, ele_s.vert_wts);
 
         // Collocation points' coordinates
         ele_s.cp_crd = el_cp_uniform(ele_s.vert, beta);
-        //ele_s.cp_crd = el_cp_nonuniform(ele_s.vert, ele_s.vert_wts, beta);
 
-        // values of nodal SF at CP
-        for (int n = 0; n < 6; ++n) {
-            // position of CP
-            HZ hz = make_el_pt_hz
-                    (ele_s.vert, ele_s.cp_crd[n], ele_s.r_tensor);
-            std::complex<double> tau = hz.z;
-            il::StaticArray<std::complex<double>, 6> tau_v {0.0};
-            tau_v[0] = 1.0;
-            tau_v[1] = tau;
-            tau_v[2] = std::conj(tau);
-            tau_v[3] = tau_v[1] * tau_v[1];
-            tau_v[4] = tau_v[2] * tau_v[2];
-            tau_v[5] = tau_v[1] * tau_v[2];
-            il::StaticArray<std::complex<double>, 6> sf_cp_c =
-                    il::dot(ele_s.sf_m, tau_v);
-            for (int k = 0; k < 6; ++k) {
-                (ele_s.sf_cp[n])[k] = std::real(sf_cp_c[k]);
+        // values of nodal SF at CP (same for all elements)
+        ele_s.sf_cp = el_p2_sf_cp_ref(beta);
+
+        return ele_s;
+    }
+
+    Element_Struct_T set_ele_struct
+            (il::StaticArray2D<double, 3, 3> &el_vert,
+             const il::StaticArray<double, 3> &vert_wts,
+             double beta) {
+// The same with the edge nodes defined by vertices' weights
+        Element_Struct_T ele_s;
+
+        for (il::int_t j = 0; j < 3; ++j) {
+            for (il::int_t k = 0; k < 3; ++k) {
+                ele_s.vert(k, j) = el_vert(k, j);
             }
+            IL_EXPECT_FAST(vert_wts[j] > 0.0);
+            ele_s.vert_wts[j] = vert_wts[j];
         }
 
+        ele_s.sf_m = make_el_sfm_nonuniform
+                (ele_s.vert, ele_s.vert_wts, il::io, ele_s.r_tensor);
+        ele_s.cp_crd = el_cp_nonuniform(ele_s.vert, ele_s.vert_wts, beta);
+        // (same for all elements with the same weights)
+        ele_s.sf_cp = el_p2_sf_cp_ref(beta, ele_s.vert_wts);
+
         return ele_s;
     }
 
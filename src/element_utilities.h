@@ -27,8 +27,10 @@ namespace hfp3d {
     struct Element_Struct_T {
         // vertices' coordinates
         il::StaticArray2D<double, 3, 3> vert;
-        // vertices' "weights" (defining the positions of edge nodes)
-        //il::StaticArray<double, 3> vert_wts;
+        // vertices' "weights" (defining the positions of edge nodes:
+        // the node across the v-th vertex divides the edge (m, l)
+        // as vert_wts[l] : vert_wts[m], see el_cp_nonuniform)
+        il::StaticArray<double, 3> vert_wts;
         // rotation tensor (reference coordinates to el-t local coordinates)
         il::StaticArray2D<double, 3, 3> r_tensor;
         // collocation points' coordinates
@@ -79,6 +81,59 @@ namespace hfp3d {
     il::StaticArray2D<std::complex<double>, 6, 6> shift_el_sfm
             (std::complex<double> z);
 
+    // dot(sfm, shift_el_sfm(z)) as a polynomial translation
+    il::StaticArray2D<std::complex<double>, 6, 6> shift_el_sfm
+            (const il::StaticArray2D<std::complex<double>, 6, 6> &sfm,
+             std::complex<double> z);
+
+// Reference-element (geometry-independent) SF data
+// for trivial (middle) edge partitioning,
+// or for the one defined by vertices' weights
+
+    // values of nodal SF at a point with barycentric coordinates bc
+    il::StaticArray<double, 6> el_p2_sf_at_bc
+            (const il::StaticArray<double, 3> &bc,
+             const il::StaticArray<double, 3> &vert_wts);
+
+    // values of nodal SF at CP (sf_cp[n][k]: k-th SF at n-th CP)
+    il::StaticArray<il::StaticArray<double, 6>, 6> el_p2_sf_cp_ref
+            (double beta);
+    il::StaticArray<il::StaticArray<double, 6>, 6> el_p2_sf_cp_ref
+            (double beta,
+             const il::StaticArray<double, 3> &vert_wts);
+
+    // integrals of nodal SF over an element of unit area
+    il::StaticArray<double, 6> el_p2_sf_integral_ref();
+    il::StaticArray<double, 6> el_p2_sf_integral_ref
+            (const il::StaticArray<double, 3> &vert_wts);
+
+    double el_area(const il::StaticArray2D<double, 3, 3> &el_vert);
+
+// Elements of order p = 0, 1, 2 (piecewise constant, linear, quadratic DD)
+
+    // nodes of an element of order p: the centroid (p = 0),
+    // the vertices (p = 1), the vertices & mid-edge nodes (p = 2)
+    template <int p>
+    struct El_Order_T {
+        static const int nnpe = (p + 1) * (p + 2) / 2;
+        static const int ndpe = 3 * nnpe;
+    };
+
+    // values of nodal SF of order p at the nodes of the 2nd order element
+    // (the 2nd order interpolation of the SF of order p is exact)
+    template <int p>
+    il::StaticArray2D<double, 6, El_Order_T<p>::nnpe> el_sf_p_at_p2_nodes
+            (const il::StaticArray<double, 3> &vert_wts);
+
+    // CP of an element of order p: the centroid (p = 0);
+    // the points with barycentric coordinates (2/3, 1/6, 1/6)
+    // (3-point Gauss rule) near the vertices (p = 1), as the CP
+    // close to the element's edges (small beta) spoil the accuracy;
+    // the CP of ele_s (p = 2)
+    template <int p>
+    il::StaticArray<il::StaticArray<double, 3>, El_Order_T<p>::nnpe> el_cp_p
+            (const Element_Struct_T &ele_s);
+
 // Collocation points
 
     il::StaticArray<il::StaticArray<double, 3>, 6> el_cp_uniform
@@ -93,7 +148,10 @@ namespace hfp3d {
     // vertex coordinates, rotational tensor, collocation points,
     // coefficients of nodal shape functions, and their values for each CP
     Element_Struct_T set_ele_struct(il::StaticArray2D<double, 3, 3> &el_vert,
-                        //il::StaticArray<double, 3> %vert_wts,
+                        double beta);
+    // the same with non-trivial edge partitioning
+    Element_Struct_T set_ele_struct(il::StaticArray2D<double, 3, 3> &el_vert,
+                        const il::StaticArray<double, 3> &vert_wts,
                         double beta);
 
 // Integration over one element
@@ -0,0 +1,184 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <il/Array.h>
+#include "fast_math.h"
+
+namespace hfp3d {
+
+    namespace {
+
+        // Coefficients: Cephes Math Library (S. L. Moshier),
+        // atan.c, atanh.c, log.c
+
+        const double atan_p[5] = {
+                -8.750608600031904122785E-1, -1.615753718733365076637E1,
+                -7.500855792314704667340E1, -1.228866684490136173410E2,
+                -6.485021904942025371773E1};
+        const double atan_q[5] = {
+                2.485846490142306297962E1, 1.650270098316988542046E2,
+                4.328810604912902668951E2, 4.853903996359136964868E2,
+                1.945506571482613964425E2};
+
+        const double atanh_p[5] = {
+                -8.54074331929669305196E-1, 1.20426861384072379242E1,
+                -4.61252884198732692637E1, 6.54566728676544377376E1,
+                -3.09092539379866942570E1};
+        const double atanh_q[5] = {
+                -1.95638849376911654834E1, 1.08938092147140262656E2,
+                -2.49839401325893582852E2, 2.52006675691344555838E2,
+                -9.27277618139601130017E1};
+
+        const double log_p[6] = {
+                1.01875663804580931796E-4, 4.97494994976747001425E-1,
+                4.70579119878881725854E0, 1.44989225341610930846E1,
+                1.79368678507819816313E1, 7.70838733755885391666E0};
+        const double log_q[5] = {
+                1.12873587189167450590E1, 4.52279145837532221105E1,
+                8.29875266912776603211E1, 7.11544750618563894466E1,
+                2.31251620126765340583E1};
+
+        // Selections are done on the bits: a comparison (or a ?: of
+        // computed values) lets GCC branch on it, and the loops with
+        // floating-point operations in branches are not vectorized
+        // (with the default -ftrapping-math) unless masked vector
+        // instructions (AVX-512) are available
+
+        // all-ones mask if a > c, 0 otherwise (the sign bit of c - a)
+        inline std::uint64_t gt_mask(double a, double c) {
+            double d = c - a;
+            std::uint64_t u;
+            std::memcpy(&u, &d, sizeof(u));
+            return std::uint64_t{0} - (u >> 63);
+        }
+
+        // a where the mask is set, b otherwise
+        inline double select(std::uint64_t mask, double a, double b) {
+            std::uint64_t u_a, u_b;
+            std::memcpy(&u_a, &a, sizeof(u_a));
+            std::memcpy(&u_b, &b, sizeof(u_b));
+            u_a = (u_a & mask) | (u_b & ~mask);
+            double r;
+            std::memcpy(&r, &u_a, sizeof(r));
+            return r;
+        }
+
+        // atan(x) without branches
+        inline double atan_k(double x) {
+            const double t3p8 = 2.41421356237309504880,
+                    more_bits = 6.123233995736765886130E-17;
+            double ax = std::fabs(x);
+            std::uint64_t big = gt_mask(ax, t3p8), mid = gt_mask(ax, 0.66);
+            // argument reduction to |x| <= 0.66
+            double num = select(big, -1.0, select(mid, ax - 1.0, ax)),
+                    den = select(big, ax, select(mid, ax + 1.0, 1.0)),
+                    xr = num / den,
+                    y0 = select(big, M_PI_2, select(mid, M_PI_4, 0.0)),
+                    mb = select(big, more_bits,
+                                select(mid, 0.5 * more_bits, 0.0));
+            double z = xr * xr;
+            double p = (((atan_p[0] * z + atan_p[1]) * z + atan_p[2]) * z +
+                        atan_p[3]) * z + atan_p[4];
+            double q = ((((z + atan_q[0]) * z + atan_q[1]) * z +
+                         atan_q[2]) * z + atan_q[3]) * z + atan_q[4];
+            double y = y0 + (xr * (z * p / q) + xr + mb);
+            return std::copysign(y, x);
+        }
+
+        // log(x) for normalized positive x without branches
+        inline double log_k(double x) {
+            const double sqrth = 0.70710678118654752440;
+            std::uint64_t u;
+            std::memcpy(&u, &x, sizeof(u));
+            // x = m * 2^e, 0.5 <= m < 1;
+            // the exponent is converted to double as (2^52 + bits) - 2^52
+            // (SSE2 has no vector int64 -> double conversion)
+            std::uint64_t u_e = ((u >> 52) & 0x7ff) | 0x4330000000000000ULL;
+            double e;
+            std::memcpy(&e, &u_e, sizeof(e));
+            e -= 4503599627370496.0 + 1022.0;
+            u = (u & 0x000fffffffffffffULL) | 0x3fe0000000000000ULL;
+            double m;
+            std::memcpy(&m, &u, sizeof(m));
+            std::uint64_t lo = gt_mask(sqrth, m);
+            e = select(lo, e - 1.0, e);
+            double xr = select(lo, m + m - 1.0, m - 1.0);
+            double z = xr * xr;
+            double p = ((((log_p[0] * xr + log_p[1]) * xr + log_p[2]) * xr +
+                         log_p[3]) * xr + log_p[4]) * xr + log_p[5];
+            double q = ((((xr + log_q[0]) * xr + log_q[1]) * xr +
+                         log_q[2]) * xr + log_q[3]) * xr + log_q[4];
+            double y = xr * (z * p / q);
+            y = y - e * 2.121944400546905827679E-4;
+            y = y - 0.5 * z;
+            return (xr + y) + e * 0.693359375;
+        }
+
+        // atanh(x) for |x| < 1 without branches
+        inline double atanh_k(double x) {
+            double ax = std::fabs(x);
+            std::uint64_t small = gt_mask(0.5, ax);
+            // |x| < 0.5: x + x^3 * p(x^2) / q(x^2),
+            // otherwise: 0.5 * log((1 + |x|) / (1 - |x|));
+            // one division of the selected operands
+            double z = x * x;
+            double p = (((atanh_p[0] * z + atanh_p[1]) * z + atanh_p[2]) * z +
+                        atanh_p[3]) * z + atanh_p[4];
+            double q = ((((z + atanh_q[0]) * z + atanh_q[1]) * z +
+                         atanh_q[2]) * z + atanh_q[3]) * z + atanh_q[4];
+            double rt = select(small, p, 1.0 + ax) /
+                        select(small, q, 1.0 - ax);
+            double y_s = x + x * z * rt;
+            // (log_k(rt) is finite, and discarded, for |x| < 0.5)
+            double y_l = std::copysign(0.5 * log_k(rt), x);
+            return select(small, y_s, y_l);
+        }
+
+    }
+
+    void fast_atan
+            (const il::Array<double> &x,
+             il::io_t, il::Array<double> &y) {
+        IL_EXPECT_FAST(y.size() == x.size());
+        const il::int_t n = x.size();
+        const double *px = x.data();
+        double *py = y.data();
+        for (il::int_t j = 0; j < n; ++j) {
+            py[j] = atan_k(px[j]);
+        }
+    }
+
+    void fast_atanh
+            (const il::Array<double> &x,
+             il::io_t, il::Array<double> &y) {
+        IL_EXPECT_FAST(y.size() == x.size());
+        const il::int_t n = x.size();
+        const double *px = x.data();
+        double *py = y.data();
+        for (il::int_t j = 0; j < n; ++j) {
+            py[j] = atanh_k(px[j]);
+        }
+    }
+
+    void fast_log
+            (const il::Array<double> &x,
+             il::io_t, il::Array<double> &y) {
+        IL_EXPECT_FAST(y.size() == x.size());
+        const il::int_t n = x.size();
+        const double *px = x.data();
+        double *py = y.data();
+        for (il::int_t j = 0; j < n; ++j) {
+            py[j] = log_k(px[j]);
+        }
+    }
+
+}
@@ -0,0 +1,43 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Array-in/array-out elementary functions for batches of arguments.
+// Branch-free rational approximations (Cephes) with argument reduction
+// done by bitwise selection, so that the loops are vectorized
+// by the compiler (GCC: -O3, baseline SSE2 is enough);
+// accuracy is within a few ulp of the std:: functions.
+
+#ifndef INC_HFPX3D_FAST_MATH_H
+#define INC_HFPX3D_FAST_MATH_H
+
+#include <il/Array.h>
+
+namespace hfp3d {
+
+// y[i] = atan(x[i]) (y may be the same array as x)
+
+    void fast_atan
+            (const il::Array<double> &x,
+             il::io_t, il::Array<double> &y);
+
+// y[i] = atanh(x[i]), |x[i]| < 1
+
+    void fast_atanh
+            (const il::Array<double> &x,
+             il::io_t, il::Array<double> &y);
+
+// y[i] = log(x[i]), x[i] > 0 (normalized)
+
+    void fast_log
+            (const il::Array<double> &x,
+             il::io_t, il::Array<double> &y);
+
+}
+
+#endif //INC_HFPX3D_FAST_MATH_H
@@ -12,7 +12,11 @@
 #ifndef INC_HFPX3D_H_POTENTIAL_H
 #define INC_HFPX3D_H_POTENTIAL_H
 
+// The *_contr functions are generated (h_potential_contr.cpp)
+// by Code_Gen/gen_h_potential.py from the reference ones (h_potential.cpp)
+
 #include <complex>
+#include <il/StaticArray.h>
 #include <il/StaticArray3D.h>
 #include <il/StaticArray4D.h>
 
@@ -26,9 +30,58 @@ namespace hfp3d {
             (double nu, std::complex<double> eix,
              double h);
 
+    // s += alpha * dot(s_ij_gen_h(nu, eix, h, d), f)
+    void s_ij_gen_h_contr
+            (double nu, std::complex<double> eix,
+             double h, std::complex<double> d,
+             const il::StaticArray<double, 9> &f, double alpha,
+             il::io_t, il::StaticArray3D<std::complex<double>, 6, 4, 3> &s);
+
+    // s += alpha * dot(s_ij_red_h(nu, eix, h), f)
+    void s_ij_red_h_contr
+            (double nu, std::complex<double> eix,
+             double h,
+             const il::StaticArray<double, 5> &f, double alpha,
+             il::io_t, il::StaticArray3D<std::complex<double>, 6, 4, 3> &s);
+
     il::StaticArray3D<std::complex<double>, 6, 4, 3> s_ij_lim_h
             (double nu, std::complex<double> eix,
              std::complex<double> d);
 
+    // s += alpha * s_ij_lim_h(nu, eix, d)
+    void s_ij_lim_h_contr
+            (double nu, std::complex<double> eix,
+             std::complex<double> d,
+             double alpha,
+             il::io_t, il::StaticArray3D<std::complex<double>, 6, 4, 3> &s);
+
+    // Real-arithmetic versions of the above: s_re + I * s_im += ...
+    // Only the independent real quantities are accumulated:
+    // for the real stress combinations (2nd index 0: S11+S22, 3: S33)
+    // the coefficients of the monomials 1 and tau*conj(tau) (1st index 0, 5)
+    // are real (s_im not set) and those of conj(tau) and conj(tau)^2 (2, 4)
+    // are the conjugates of those of tau and tau^2 (1, 3) (not set)
+
+    void s_ij_gen_h_contr_r
+            (double nu, std::complex<double> eix,
+             double h, std::complex<double> d,
+             const il::StaticArray<double, 9> &f, double alpha,
+             il::io_t, il::StaticArray3D<double, 6, 4, 3> &s_re,
+             il::StaticArray3D<double, 6, 4, 3> &s_im);
+
+    void s_ij_red_h_contr_r
+            (double nu, std::complex<double> eix,
+             double h,
+             const il::StaticArray<double, 5> &f, double alpha,
+             il::io_t, il::StaticArray3D<double, 6, 4, 3> &s_re,
+             il::StaticArray3D<double, 6, 4, 3> &s_im);
+
+    void s_ij_lim_h_contr_r
+            (double nu, std::complex<double> eix,
+             std::complex<double> d,
+             double alpha,
+             il::io_t, il::StaticArray3D<double, 6, 4, 3> &s_re,
+             il::StaticArray3D<double, 6, 4, 3> &s_im);
+
 }
 #endif //INC_HFPX3D_H_POTENTIAL_H
@@ -0,0 +1,3593 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// GENERATED by Code_Gen/gen_h_potential.py from the reference functions
+// in h_potential.cpp -- do not edit; re-generate after changing those.
+//
+// Contraction of the hypersingular kernel coefficients (see h_potential.h)
+// with the constituing functions: only non-zero coefficients,
+// common sub-expressions computed once, conjugate blocks not computed;
+// *_r: the same in real arithmetic for the independent real quantities.
+
+#include <complex>
+#include <il/math.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray3D.h>
+#include "h_potential.h"
+
+namespace hfp3d {
+
+// General case: s += alpha * dot(s_ij_gen_h(nu, eix, h, d), f)
+
+    void s_ij_gen_h_contr
+            (double nu, std::complex<double> eix,
+             double h, std::complex<double> d,
+             const il::StaticArray<double, 9> &f, double alpha,
+             il::io_t, il::StaticArray3D<std::complex<double>, 6, 4, 3> &s) {
+        // 445 non-zero coefficients (of 648), 79 of them by conjugation;
+        // 418 common sub-expressions
+        const double d_sin_p = std::imag(d);
+        const double g_0 = h * 0.1875;
+        const double h2 = h * h;
+        const double g_1 = 3.0 * h2;
+        const double d_cos_p = std::real(d);
+        const double cos_x = std::real(eix);
+        const double tan_x = std::imag(eix) / cos_x;
+        const double d_1 = std::abs(d);
+        const double d_2 = d_1 * d_1;
+        const double g_2 = tan_x * d_2;
+        const std::complex<double> e = std::polar(1.0, std::arg(d));
+        const double cos_p = std::real(e);
+        const double g_3 = nu * 2.0;
+        const double c_7_2nu = g_3 + 7.0;
+        const double g_4 = h * c_7_2nu;
+        const double c_d_3h = d_2 + g_1;
+        const double g_5 = h * 3.0;
+        const double g_6 = c_d_3h * g_5;
+        const double c_d_h = h2 + d_2;
+        const double c_d_m3h = d_2 - g_1;
+        const double g_7 = c_d_h * (c_d_m3h * (h * -0.5));
+        const std::complex<double> t_0_0_0 = f[2] * (h * d_sin_p) + f[3]
+                * (-g_0 * (d_sin_p * g_1 + d_cos_p * g_2)) + f[6] * (cos_p
+                * g_4) + f[7] * (cos_p * g_6) + f[8] * (cos_p * g_7);
+        s(0, 0, 0) += alpha * t_0_0_0;
+        const double g_8 = -h;
+        const double sin_p = std::imag(e);
+        const std::complex<double> t_0_0_1 = f[2] * (d_cos_p * g_8) + f[3]
+                * (g_0 * (d_cos_p * g_1 - d_sin_p * g_2)) + f[6] * (sin_p
+                * g_4) + f[7] * (sin_p * g_6) + f[8] * (sin_p * g_7);
+        s(0, 0, 1) += alpha * t_0_0_1;
+        const double c_1_2nu = 1.0 + g_3;
+        const double g_9 = h2 * -2.0;
+        const std::complex<double> t_0_0_2 = f[6] * (d_1 * -c_1_2nu) + f[7]
+                * (d_1 * g_9);
+        s(0, 0, 2) += alpha * t_0_0_2;
+        const std::complex<double> e_2 = e * e;
+        const std::complex<double> tcos_x = eix * cos_x;
+        const std::complex<double> g_10 = e_2 * (0.5 + tcos_x * 0.75);
+        const std::complex<double> g_11 = h * d;
+        const double g_12 = d_2 * 0.09375;
+        const double g_13 = tan_x * g_12;
+        const double g_14 = tan_x * 0.28125;
+        const std::complex<double> g_15 = il::ii * h2;
+        const std::complex<double> g_16 = 0.28125 + tcos_x * 0.375;
+        const std::complex<double> g_17 = e * 0.5;
+        const std::complex<double> g_18 = h * g_17;
+        const double g_19 = nu * 4.0;
+        const double c_9_m4nu = 9.0 - g_19;
+        const std::complex<double> g_20 = 3.0 * e_2;
+        const double g_21 = h * 1.5;
+        const std::complex<double> g_22 = e * g_21;
+        const double g_23 = 3.0 * d_2;
+        const std::complex<double> g_24 = e_2 * (h2 + g_23);
+        const double g_25 = h * 0.25;
+        const std::complex<double> g_26 = c_d_h * (e * g_25);
+        const double g_27 = 5.0 * d_2;
+        const double g_28 = h2 + g_27;
+        const std::complex<double> g_29 = e_2 * g_28;
+        const std::complex<double> t_0_1_0 = f[2] * (h * (d * il::ii) * (-0.5
+                + g_10)) + f[3] * (g_11 * (h2 * (il::ii * 0.28125) - g_13 + e_2
+                * (d_2 * (il::ii * -0.75 + g_14) - g_15 * g_16))) + f[6]
+                * (g_18 * (c_9_m4nu + -g_20)) + f[7] * (g_22 * (c_d_3h - g_24))
+                + f[8] * (-g_26 * (c_d_m3h + g_29));
+        s(0, 1, 0) += alpha * t_0_1_0;
+        const std::complex<double> g_30 = -d;
+        const std::complex<double> g_31 = tan_x * (il::ii * 0.28125);
+        const double g_32 = -c_d_m3h;
+        const std::complex<double> t_0_1_1 = f[2] * (g_11 * (0.5 + g_10))
+                + f[3] * (h * g_30 * (h2 * 0.28125 + tan_x * (d_2 * (il::ii
+                * 0.09375)) + e_2 * (d_2 * (0.75 + g_31) + h2 * g_16))) + f[6]
+                * (il::ii * g_18 * (c_9_m4nu + g_20)) + f[7] * (il::ii * g_22
+                * (c_d_3h + g_24)) + f[8] * (il::ii * g_26 * (g_29 + g_32));
+        s(0, 1, 1) += alpha * t_0_1_1;
+        const double c_1_m2nu = 1.0 - g_3;
+        const std::complex<double> g_33 = c_1_m2nu * -il::ii;
+        const double g_34 = -c_1_m2nu;
+        const std::complex<double> t_0_1_2 = f[1] * (tcos_x * (e_2 * g_33))
+                + f[2] * (tcos_x * (e_2 * g_15)) + f[6] * (d * (e * g_34))
+                + f[7] * (d * (e * g_9));
+        s(0, 1, 2) += alpha * t_0_1_2;
+        const std::complex<double> g_35 = tcos_x * (e_2 * (nu * -0.5));
+        const std::complex<double> g_36 = e_2 * 0.5;
+        const std::complex<double> g_37 = tcos_x * (h2 * g_36);
+        const double c_2_mnu = 2.0 - nu;
+        const std::complex<double> g_38 = e * (nu * d);
+        const double g_39 = -h2;
+        const std::complex<double> t_0_2_0 = f[1] * (il::ii * g_35) + f[2]
+                * (il::ii * g_37) + f[6] * (-0.5 * (c_2_mnu * d_1 + g_38))
+                + f[7] * (d_1 * g_39 * (1.0 + e_2));
+        s(0, 2, 0) += alpha * t_0_2_0;
+        const std::complex<double> t_0_2_1 = f[1] * g_35 + f[2] * g_37 + f[6]
+                * (il::ii * 0.5 * (g_38 + d_1 * -c_2_mnu)) + f[7] * (d_1 * g_15
+                * (e_2 - 1.0));
+        s(0, 2, 1) += alpha * t_0_2_1;
+        const double h3 = h * h2;
+        const std::complex<double> t_0_2_2 = f[6] * (h * -e) + f[7] * (e * (h3
+                * -2.0));
+        s(0, 2, 2) += alpha * t_0_2_2;
+        const double g_40 = h * -2.0;
+        const double g_41 = h3 * -4.0;
+        const std::complex<double> t_0_3_0 = f[6] * (cos_p * g_40) + f[7]
+                * (cos_p * g_41);
+        s(0, 3, 0) += alpha * t_0_3_0;
+        const std::complex<double> t_0_3_1 = f[6] * (sin_p * g_40) + f[7]
+                * (sin_p * g_41);
+        s(0, 3, 1) += alpha * t_0_3_1;
+        const double g_42 = 4.0 * h2;
+        const std::complex<double> t_0_3_2 = f[6] * (d_1 * -2.0) + f[7] * (d_1
+                * g_42);
+        s(0, 3, 2) += alpha * t_0_3_2;
+        const double g_43 = nu * 5.0;
+        const std::complex<double> g_44 = tcos_x * (e_2 * (h * ((g_43 + 11.0)
+                * 0.2)));
+        const double g_45 = tan_x * (d_2 * ((7.0 + g_43) / 60.0));
+        const std::complex<double> g_46 = d_2 * (7.0 + tan_x * (2.0 * il::ii))
+                + tcos_x * (h2 * 16.0);
+        const std::complex<double> g_47 = e_2 * (0.1 * g_46);
+        const double g_48 = h2 * 0.11875;
+        const double g_49 = d_2 * -0.05625 + g_48;
+        const double g_50 = tan_x * (d_2 * g_49);
+        const double d2h2 = h2 * d_2;
+        const std::complex<double> g_51 = tan_x * (il::ii * 0.11875);
+        const std::complex<double> g_52 = d2h2 * (0.4 + g_51);
+        const double d_4 = d_2 * d_2;
+        const double h4 = h2 * h2;
+        const double g_53 = h4 * 0.4;
+        const std::complex<double> g_54 = g_52 + tan_x * (d_4 * (il::ii
+                * 0.09375)) + tcos_x * g_53;
+        const std::complex<double> g_55 = e_2 * g_54;
+        const double sgh = (h < 0) ? -1.0 : double(h > 0);
+        const double c_1_nu = nu + 1.0;
+        const double g_56 = c_7_2nu * 0.5;
+        const std::complex<double> g_57 = e * (d * g_56);
+        const double c_2_nu = nu + 2.0;
+        const double g_58 = d_1 * (0.3 + c_2_nu * (4.0 / 3.0));
+        const std::complex<double> g_59 = e * (d * 1.5);
+        const std::complex<double> g_60 = c_d_3h * g_59;
+        const double g_61 = d_2 * (c_1_2nu * (1.0 / 6.0));
+        const double g_62 = d_1 * (g_61 + h2 * (43.0 / 30.0 + c_2_nu / 3.0));
+        const double g_63 = h * c_d_h;
+        const double g_64 = d_2 * (d_1 * 0.15) - h2 * (d_1 * (1.9 / 6.0));
+        const std::complex<double> g_65 = e * (d * 0.25);
+        const std::complex<double> g_66 = c_d_m3h * g_65;
+        const std::complex<double> t_1_0_0 = f[1] * (il::ii * g_44) + f[2] * (h
+                * -(g_45 + il::ii * g_47)) + f[3] * (h * (g_50 + il::ii
+                * g_55)) + f[4] * (sgh * -c_1_nu) + f[6] * (h * (g_57 + g_58))
+                + f[7] * (h * (g_60 + g_62)) + f[8] * (-g_63 * (g_64 + g_66));
+        s(1, 0, 0) += alpha * t_1_0_0;
+        const std::complex<double> t_1_0_1 = f[1] * g_44 + f[2] * (h * -(g_47
+                + il::ii * g_45)) + f[3] * (h * (g_55 + il::ii * g_50)) + f[4]
+                * (sgh * (c_1_nu * -il::ii)) + f[6] * (h * (il::ii * (g_58
+                + -g_57))) + f[7] * (h * (il::ii * (g_62 + -g_60))) + f[8]
+                * (il::ii * g_63 * (g_66 + -g_64));
+        s(1, 0, 1) += alpha * t_1_0_1;
+        const double g_67 = c_1_2nu * 0.5;
+        const double g_68 = h2 * (2.0 * c_2_nu);
+        const double g_69 = 2.0 * h4;
+        const std::complex<double> t_1_0_2 = f[5] * (e * g_67) + f[6] * (e
+                * g_68) + f[7] * (e * g_69);
+        s(1, 0, 2) += alpha * t_1_0_2;
+        const std::complex<double> g_70 = tcos_x * (h * (e_2 * 0.4));
+        const double c_8_m5nu = 8.0 - g_43;
+        const std::complex<double> g_71 = 8.0 * e_2 * (tcos_x + -1.0);
+        const std::complex<double> g_72 = h * e_2;
+        const std::complex<double> g_73 = 2.0 * e_2;
+        const std::complex<double> c_tcos_n1 = tcos_x * (tcos_x - 1.0);
+        const std::complex<double> g_74 = tcos_x * 0.4;
+        const double g_75 = tan_x * 0.11875;
+        const std::complex<double> g_76 = h4 * (il::ii * 0.4);
+        const double g_77 = 3.0 * d_4;
+        const std::complex<double> g_78 = c_tcos_n1 * g_76;
+        const std::complex<double> g_79 = 2.0 + tcos_x;
+        const std::complex<double> g_80 = d2h2 * (g_75 - il::ii * 0.4 * g_79);
+        const std::complex<double> g_81 = d * e;
+        const std::complex<double> g_82 = h * g_81;
+        const std::complex<double> g_83 = e_2 * 4.5;
+        const double g_84 = c_9_m4nu * 0.5;
+        const double g_85 = h2 * 4.5;
+        const double g_86 = d_2 * 1.5 + g_85;
+        const std::complex<double> g_87 = e_2 * (g_85 + d_2 * 7.5);
+        const std::complex<double> g_88 = c_d_h * (0.25 * g_82);
+        const double g_89 = 7.0 * d_2;
+        const double g_90 = g_1 + g_89;
+        const std::complex<double> g_91 = e_2 * g_90;
+        const std::complex<double> t_1_1_0 = f[1] * (il::ii * g_70 * (c_8_m5nu
+                + g_71)) + f[2] * (g_72 * (d_2 * (il::ii * -0.7 + tan_x * 0.2)
+                - tcos_x * (h2 * (il::ii * 1.6)) - g_73 * (c_tcos_n1 * (h2
+                * (il::ii * 0.8)) + d_2 * (tan_x * 0.1 - il::ii * (0.7
+                + g_74))))) + f[3] * (g_72 * (d2h2 * (il::ii * 0.4 - g_75)
+                - tan_x * (d_4 * 0.09375) + tcos_x * g_76 + e_2 * (g_77
+                * (il::ii * -0.4 + tan_x * 0.18125) + g_78 + g_80))) + f[6]
+                * (-g_82 * (g_83 - g_84)) + f[7] * (g_82 * (g_86 - g_87))
+                + f[8] * (-g_88 * (c_d_m3h + g_91));
+        s(1, 1, 0) += alpha * t_1_1_0;
+        const std::complex<double> g_92 = 0.4 + tan_x * (il::ii * 0.18125);
+        const std::complex<double> g_93 = c_tcos_n1 * g_53;
+        const std::complex<double> g_94 = 0.4 * g_79;
+        const std::complex<double> g_95 = il::ii * g_82;
+        const std::complex<double> t_1_1_1 = f[1] * (g_70 * (g_71 + -c_8_m5nu))
+                + f[2] * (g_72 * (d_2 * (0.7 + tan_x * (il::ii * 0.2)) + tcos_x
+                * (h2 * 1.6) + g_73 * (c_tcos_n1 * (h2 * -0.8) + d_2 * (g_74
+                + (0.7 + tan_x * (il::ii * 0.1)))))) + f[3] * (-g_72 * (g_54
+                + e_2 * (g_77 * g_92 - g_93 + d2h2 * (g_51 + g_94)))) + f[6]
+                * (g_95 * (g_83 + g_84)) + f[7] * (g_95 * (g_86 + g_87)) + f[8]
+                * (il::ii * g_88 * (g_32 + g_91));
+        s(1, 1, 1) += alpha * t_1_1_1;
+        const std::complex<double> g_96 = tcos_x + 0.625;
+        const std::complex<double> g_97 = d * e_2;
+        const std::complex<double> g_98 = 4.0 * tcos_x;
+        const std::complex<double> c_3_4tcos = 3.0 + g_98;
+        const std::complex<double> e_3 = e * e_2;
+        const std::complex<double> g_99 = -e_3;
+        const double g_100 = 2.0 * c_2_mnu;
+        const std::complex<double> g_101 = e_3 * -0.25;
+        const double g_102 = 5.0 * d_4;
+        const double c_7_m2nu = 7.0 - g_3;
+        const double g_103 = 6.0 * d2h2;
+        const double c_13_m2nu = 13.0 - g_3;
+        const std::complex<double> g_104 = e_3 * -0.5;
+        const std::complex<double> t_1_1_2 = f[1] * (e_2 * (d * g_33) * g_96)
+                + f[2] * (g_97 * (c_1_m2nu * -d_2 * (il::ii * -0.5 + tan_x
+                * 0.1875) + g_15 * (1.1875 + tcos_x * 1.75 - c_3_4tcos * (nu
+                * 0.125)))) + f[3] * (h2 * (e_2 * (d * -il::ii)) * (d_2 * (1.5
+                + tan_x * (il::ii * 0.5625)) + c_3_4tcos * (h2 * 0.1875)))
+                + f[5] * (e_3 * (c_1_m2nu * -0.5)) + f[6] * (g_99 * (h2 * g_100
+                + d_2 * (3.0 * c_1_m2nu))) + f[7] * (g_101 * (c_1_m2nu * g_102
+                + c_7_m2nu * g_103 + c_13_m2nu * h4)) + f[8] * (g_28 * (c_d_h
+                * (h2 * g_104)));
+        s(1, 1, 2) += alpha * t_1_1_2;
+        const std::complex<double> c_5_8tcos = 5.0 + 8.0 * tcos_x;
+        const std::complex<double> g_105 = c_5_8tcos * (nu * (e_2 * (d
+                * -0.0625)));
+        const std::complex<double> c_8_3i_tan = 8.0 + tan_x * (3.0 * il::ii);
+        const double g_106 = nu * 0.03125;
+        const double c_6_nu = nu + 6.0;
+        const std::complex<double> g_107 = g_97 * (c_8_3i_tan * (d_2 * g_106)
+                + h2 * (0.5 + nu * 0.09375 + tcos_x * (c_6_nu * 0.125)));
+        const std::complex<double> g_108 = c_8_3i_tan * d_2;
+        const std::complex<double> g_109 = g_108 + c_3_4tcos * h2;
+        const std::complex<double> g_110 = h2 * (e_2 * (d * -0.09375)) * g_109;
+        const std::complex<double> g_111 = nu * e_2;
+        const double c_5_mnu = 5.0 - nu;
+        const double g_112 = c_5_mnu * h2;
+        const double g_113 = nu * 3.0;
+        const double c_3_nu = nu + 3.0;
+        const std::complex<double> g_114 = e_2 * (d_2 * g_113 + c_3_nu * h2);
+        const double c_12_nu = nu + 12.0;
+        const std::complex<double> g_115 = e_2 * (d_4 * (nu * 0.625) + d2h2
+                * (c_6_nu * 0.75) + h4 * (c_12_nu * 0.125));
+        const std::complex<double> g_116 = g_28 * (c_d_h * (h2 * g_101));
+        const std::complex<double> t_1_2_0 = f[1] * (il::ii * g_105) + f[2]
+                * (il::ii * g_107) + f[3] * (il::ii * g_110) + f[5] * (e * 0.25
+                * (c_2_mnu - g_111)) + f[6] * (g_17 * (g_112 - g_114)) + f[7]
+                * (e * (h4 - g_115)) + f[8] * g_116;
+        s(1, 2, 0) += alpha * t_1_2_0;
+        const std::complex<double> t_1_2_1 = f[1] * g_105 + f[2] * g_107 + f[3]
+                * g_110 + f[5] * (e * (il::ii * 0.25) * (c_2_mnu + g_111))
+                + f[6] * (e * (il::ii * 0.5) * (g_112 + g_114)) + f[7]
+                * (il::ii * e * (h4 + g_115)) + f[8] * (-il::ii * g_116);
+        s(1, 2, 1) += alpha * t_1_2_1;
+        const std::complex<double> g_117 = e_2 * -il::ii;
+        const std::complex<double> g_118 = il::ii * e_2;
+        const std::complex<double> g_119 = e * g_30;
+        const std::complex<double> t_1_2_2 = f[1] * (tcos_x * (h * g_117))
+                + f[2] * (tcos_x * (h3 * g_118)) + f[6] * (h * g_119) + f[7]
+                * (h3 * (e * (d * -2.0)));
+        s(1, 2, 2) += alpha * t_1_2_2;
+        const std::complex<double> g_120 = -e_2;
+        const std::complex<double> g_121 = tcos_x * (h * g_120);
+        const double g_122 = d_2 * (tan_x * (1.0 / 12.0));
+        const std::complex<double> g_123 = h2 * e_2;
+        const std::complex<double> g_124 = tcos_x * g_123;
+        const double g_125 = tan_x * (h3 * (d_2 * -0.25));
+        const double g_126 = d_1 * (10.0 / 3.0);
+        const double g_127 = h * d_1;
+        const double g_128 = d_2 + 11.0 * h2;
+        const double g_129 = g_128 / 3.0;
+        const std::complex<double> g_130 = h2 * g_73;
+        const double g_131 = c_d_h * (d_1 * (h3 * (-2.0 / 3.0)));
+        const std::complex<double> t_1_3_0 = f[1] * (il::ii * g_121) + f[2]
+                * (h * (g_122 + il::ii * g_124)) + f[3] * g_125 + f[6] * (h
+                * (g_119 - g_126)) + f[7] * (g_127 * -(g_129 + g_130)) + f[8]
+                * g_131;
+        s(1, 3, 0) += alpha * t_1_3_0;
+        const std::complex<double> t_1_3_1 = f[1] * g_121 + f[2] * (h * (g_124
+                + il::ii * g_122)) + f[3] * (il::ii * g_125) + f[6] * (h
+                * (il::ii * (g_81 - g_126))) + f[7] * (g_127 * (-il::ii
+                * (g_129 - g_130))) + f[8] * (il::ii * g_131);
+        s(1, 3, 1) += alpha * t_1_3_1;
+        const double g_132 = h2 * -4.0;
+        const double g_133 = h4 * -4.0;
+        const std::complex<double> t_1_3_2 = f[5] * e + f[6] * (e * g_132)
+                + f[7] * (e * g_133);
+        s(1, 3, 2) += alpha * t_1_3_2;
+        const std::complex<double> g_134 = h * -il::ii;
+        const std::complex<double> g_135 = g_46 * (e_2 * 0.1);
+        const std::complex<double> g_136 = tan_x * (d_2 * ((6.0 - g_43)
+                * il::ii / 30.0));
+        const double g_137 = g_2 * g_49;
+        const std::complex<double> g_138 = e_2 * (g_2 * (g_48 + g_12) - h2
+                * (il::ii * 0.4) * (d_2 + tcos_x * h2));
+        const double c_1_mnu = 1.0 - nu;
+        const double g_139 = sgh * (c_1_mnu * -2.0);
+        const std::complex<double> g_140 = h * (e * (d * 4.5));
+        const double g_141 = g_127 * (4.3 - nu * (8.0 / 3.0));
+        const std::complex<double> g_142 = c_d_3h * (h * g_59);
+        const double c_3_m4nu = 3.0 - g_19;
+        const double g_143 = h * (d_1 * (1.0 / 3.0)) * (h2 * (g_100 + 3.3)
+                + d_2 * (c_3_m4nu * 0.5));
+        const double g_144 = c_d_h * g_127;
+        const double g_145 = h2 * (0.95 / 3.0);
+        const double g_146 = d_2 * 0.15 - g_145;
+        const std::complex<double> g_147 = e_2 * 0.25;
+        const std::complex<double> g_148 = c_d_m3h * g_147;
+        const std::complex<double> t_2_1_0 = f[1] * (tcos_x * (e_2 * (h
+                * (il::ii * 3.2)))) + f[2] * (g_134 * (g_135 - g_136)) + f[3]
+                * (h * (g_137 - g_138)) + f[4] * g_139 + f[6] * (g_140 + g_141)
+                + f[7] * (g_142 + g_143) + f[8] * (-g_144 * (g_146 + g_148));
+        s(2, 1, 0) += alpha * t_2_1_0;
+        const std::complex<double> g_149 = h * il::ii;
+        const std::complex<double> t_2_1_1 = f[1] * (tcos_x * (e_2 * (h
+                * 3.2))) + f[2] * (g_8 * (g_135 + g_136)) + f[3] * (g_149
+                * (g_137 + g_138)) + f[4] * (il::ii * g_139) + f[6] * (il::ii
+                * (g_141 + -g_140)) + f[7] * (il::ii * (g_143 + -g_142)) + f[8]
+                * (il::ii * g_144 * (g_148 + -g_146));
+        s(2, 1, 1) += alpha * t_2_1_1;
+        const double g_150 = c_1_m2nu * 0.0625;
+        const double g_151 = c_1_m2nu * d_2;
+        const double g_152 = h2 * (6.0 * c_2_mnu) + g_151;
+        const std::complex<double> g_153 = e * -0.5;
+        const std::complex<double> t_2_1_2 = f[1] * (d * (c_1_m2nu * (il::ii
+                * 0.625))) + f[2] * (d * (tan_x * (d_2 * g_150) - g_15
+                * (1.1875 - nu * 0.375))) + f[3] * (d * h2 * (tan_x * (d_2
+                * -0.1875) + h2 * (il::ii * 0.5625))) + f[5] * (e * (c_1_m2nu
+                * 1.5)) + f[6] * (e * g_152) + f[7] * (e * (g_1 * c_d_3h
+                - c_d_h * (c_d_m3h * (c_1_m2nu * 0.25)))) + f[8] * (c_d_h
+                * (c_d_m3h * (h2 * g_153)));
+        s(2, 1, 2) += alpha * t_2_1_2;
+        const std::complex<double> g_154 = d * (nu * 0.3125);
+        const std::complex<double> g_155 = d * -0.03125 * (h2 * (g_113 + 16)
+                + tan_x * (d_2 * (nu * il::ii)));
+        const std::complex<double> g_156 = tan_x * (il::ii * d_2);
+        const std::complex<double> g_157 = h2 * (d * 0.09375) * (g_1 + g_156);
+        const std::complex<double> g_158 = e * g_113;
+        const std::complex<double> e_c = std::conj(e);
+        const std::complex<double> g_159 = c_2_mnu * e_c;
+        const double g_160 = nu * d_2;
+        const double g_161 = h2 * (3.0 * c_3_nu);
+        const double g_162 = g_160 + g_161;
+        const std::complex<double> g_163 = e * g_162;
+        const std::complex<double> g_164 = e_c * g_112;
+        const double g_165 = nu * d_4;
+        const double g_166 = d2h2 * (2.0 * c_6_nu);
+        const double g_167 = h4 * (3.0 * c_12_nu);
+        const double g_168 = 0.125 * (g_165 - g_166 - g_167);
+        const std::complex<double> g_169 = h4 * e_c;
+        const std::complex<double> g_170 = c_d_h * (c_d_m3h * (h2 * (e
+                * -0.25)));
+        const std::complex<double> t_2_2_0 = f[1] * (il::ii * g_154) + f[2]
+                * (il::ii * g_155) + f[3] * (il::ii * g_157) + f[5] * (0.25
+                * (g_158 + g_159)) + f[6] * (0.5 * (g_163 + g_164)) + f[7] * (e
+                * -g_168 + g_169) + f[8] * g_170;
+        s(2, 2, 0) += alpha * t_2_2_0;
+        const std::complex<double> t_2_2_1 = f[1] * g_154 + f[2] * g_155 + f[3]
+                * g_157 + f[5] * (il::ii * -0.25 * (g_158 - g_159)) + f[6]
+                * (il::ii * -0.5 * (g_163 - g_164)) + f[7] * (il::ii * (g_169
+                + e * g_168)) + f[8] * (-il::ii * g_170);
+        s(2, 2, 1) += alpha * t_2_2_1;
+        const double g_171 = -d_1;
+        const std::complex<double> t_2_2_2 = f[2] * (tan_x * (h * (d_2
+                / 12.0))) + f[3] * g_125 + f[6] * (h * (d_1 * (-10.0 / 3.0)))
+                + f[7] * (h * g_171 * g_128 / 3.0) + f[8] * (c_d_h * (h3 * (d_1
+                * (-2.0 / 3.0))));
+        s(2, 2, 2) += alpha * t_2_2_2;
+        const double c_13_10nu = 13.0 + nu * 10.0;
+        const double g_172 = c_13_10nu * 0.0625;
+        const double c_3_2nu = g_3 + 3.0;
+        const std::complex<double> g_173 = e_2 * (g_172 + tcos_x * (c_3_2nu
+                * 0.5));
+        const double g_174 = nu * 6.0;
+        const double c_7_6nu = 7.0 + g_174;
+        const std::complex<double> g_175 = c_7_2nu * 0.09375 + tcos_x * ((nu
+                + 4.0) * 0.25);
+        const std::complex<double> g_176 = e_2 * 0.28125;
+        const std::complex<double> g_177 = e_2 * 0.109375;
+        const std::complex<double> g_178 = d_2 * (e_2 * 0.625);
+        const double g_179 = h2 * 0.234375;
+        const std::complex<double> g_180 = g_123 * (0.234375 + tcos_x * 0.3125);
+        const std::complex<double> g_181 = h * e;
+        const double c_5_4nu = 5.0 + g_19;
+        const double c_11_4nu = g_19 + 11.0;
+        const std::complex<double> g_182 = e_2 * (d_2 * (c_5_4nu * 0.75) + h2
+                * (c_11_4nu * 0.25));
+        const double g_183 = d_2 * (c_5_4nu * 0.25) + h2 * (c_11_4nu * 0.75);
+        const double c_13_2nu = g_3 + 13.0;
+        const double g_184 = d_4 * (c_1_2nu * 0.125) - h2 * (d_2 * (c_7_2nu
+                * 0.25)) - h4 * (c_13_2nu * 0.375);
+        const std::complex<double> g_185 = e_2 * (d_4 * (c_1_2nu * 0.625) + h2
+                * (d_2 * (c_7_2nu * 0.75)) + h4 * (c_13_2nu * 0.125));
+        const std::complex<double> g_186 = c_d_h * g_181;
+        const std::complex<double> g_187 = e_2 * (d_4 * (7.0 / 24.0) - h2
+                * (d_2 * (11.0 / 12.0)) - h4 * (5.0 / 24.0));
+        const double g_188 = d_2 * 0.25;
+        const double g_189 = d_4 * 0.125 - h2 * g_188 + h4 * 0.625;
+        const std::complex<double> t_3_0_0 = f[1] * (-il::ii * g_11 * (g_172
+                - g_173)) + f[2] * (g_11 * (h2 * (c_7_2nu * (il::ii * 0.09375))
+                - tan_x * (d_2 * (c_3_2nu * 0.03125)) + e_2 * (d_2 * (c_7_6nu
+                * (il::ii * (-1.0 / 12.0)) + tan_x * (c_3_2nu * 0.09375))
+                - g_15 * g_175))) + f[3] * (g_11 * (g_2 * (h2 * (0.09375
+                - g_176) - d_2 * (0.046875 + g_177)) + g_15 * (g_178 - g_179
+                + g_180))) + f[5] * (e * (h * c_3_2nu) * (g_147 - 0.75)) + f[6]
+                * (g_181 * (g_182 - g_183)) + f[7] * (g_181 * (g_184 + g_185))
+                + f[8] * (-g_186 * (g_187 + g_189));
+        s(3, 0, 0) += alpha * t_3_0_0;
+        const std::complex<double> t_3_0_1 = f[1] * (g_11 * (g_172 + g_173))
+                + f[2] * (g_11 * (h2 * (c_7_2nu * -0.09375) - tan_x * (d_2
+                * (c_3_2nu * (il::ii * 0.03125))) - e_2 * (d_2 * (c_7_6nu
+                * (1.0 / 12.0) + tan_x * (c_3_2nu * (il::ii * 0.09375))) + h2
+                * g_175))) + f[3] * (g_11 * (g_156 * (h2 * (0.09375 + g_176)
+                + d_2 * (g_177 + -0.046875)) + h2 * (g_180 + (g_178 + g_179))))
+                + f[5] * (e * (h * (c_3_2nu * -il::ii)) * (g_147 + 0.75))
+                + f[6] * (e * g_134 * (g_182 + g_183)) + f[7] * (e * g_149
+                * (g_184 - g_185)) + f[8] * (il::ii * g_186 * (g_187 - g_189));
+        s(3, 0, 1) += alpha * t_3_0_1;
+        const std::complex<double> t_3_0_2 = f[0] * (tcos_x * (e_2 * (c_1_2nu
+                * il::ii))) + f[1] * (tcos_x * (h2 * (e_2 * (c_2_nu * (2.0
+                * il::ii))))) + f[2] * (tcos_x * (h4 * g_117)) + f[5] * (e * (d
+                * g_67)) + f[6] * (e * (d * g_68)) + f[7] * (e * (d * g_69));
+        s(3, 0, 2) += alpha * t_3_0_2;
+        const std::complex<double> g_190 = h * g_97;
+        const std::complex<double> w_c_tcos_n2 = tcos_x * (13.0 + eix * eix
+                - 10.0 * tcos_x);
+        const std::complex<double> g_191 = e_2 * (1.4625 + w_c_tcos_n2 * 0.375);
+        const double c_5_m4nu = 5.0 - g_19;
+        const std::complex<double> g_192 = 1.25 * (c_1_mnu + 0.15) + tcos_x
+                * (c_5_m4nu * 0.5);
+        const std::complex<double> g_193 = e_2 * (d_2 * (tcos_x + (3.275
+                + tan_x * (il::ii * 0.78125 + tan_x * 0.025))) + h2 * (0.86875
+                + w_c_tcos_n2 * 0.1875));
+        const std::complex<double> g_194 = d_2 * (c_1_mnu + 0.25 / 3.0 + tan_x
+                * (c_5_m4nu * (il::ii * 0.09375)));
+        const double c_5_m2nu = 5.0 - g_3;
+        const std::complex<double> g_195 = h2 * (c_3_4tcos * (c_5_m2nu
+                * 0.0625) - 0.09375);
+        const std::complex<double> g_196 = d2h2 * (il::ii * 0.625 - g_14);
+        const double g_197 = tan_x * (d_4 * 0.109375);
+        const std::complex<double> g_198 = c_3_4tcos * (h4 * (il::ii
+                * 0.078125));
+        const std::complex<double> g_199 = 0.234375 + w_c_tcos_n2 * 0.046875;
+        const double g_200 = tan_x * 0.46875;
+        const std::complex<double> g_201 = 15.0 + g_98;
+        const std::complex<double> g_202 = e_3 * g_25;
+        const double g_203 = nu * 8.0;
+        const double c_9_m8nu = 9.0 - g_203;
+        const double c_15_m8nu = 15.0 - g_203;
+        const double g_204 = c_9_m8nu * g_23 + c_15_m8nu * h2;
+        const std::complex<double> g_205 = g_28 * (9.0 * e_2);
+        const std::complex<double> g_206 = 0.5 * g_202;
+        const double c_15_m4nu = 15.0 - g_19;
+        const double g_207 = c_3_m4nu * g_102 + c_9_m4nu * g_103 + c_15_m4nu
+                * h4;
+        const std::complex<double> g_208 = g_20 * (d_4 * 35.0 + d2h2 * 30.0
+                + 3.0 * h4);
+        const std::complex<double> g_209 = c_d_h * g_206;
+        const double g_210 = 5.0 * h4;
+        const double g_211 = d_4 * -7.0 + d2h2 * 22.0 + g_210;
+        const double g_212 = g_211 / 3.0;
+        const double g_213 = d2h2 * 14.0;
+        const std::complex<double> g_214 = e_2 * (h4 + (d_4 * 21.0 + g_213));
+        const std::complex<double> t_3_1_0 = f[1] * (-il::ii * g_190 * (g_191
+                - g_192)) + f[2] * (il::ii * g_190 * (g_193 - g_194 - g_195))
+                + f[3] * (g_190 * (g_196 - g_197 + g_198 + e_2 * (d_4 * (il::ii
+                * -2.0 + tan_x * 1.015625) - il::ii * h4 * g_199 + d2h2
+                * (g_200 - il::ii * 0.125 * g_201)))) + f[5] * (g_202
+                * (c_5_m4nu + e_2 * -3.0)) + f[6] * (g_202 * (g_204 - g_205))
+                + f[7] * (g_206 * (g_207 - g_208)) + f[8] * (g_209 * (g_212
+                - g_214));
+        s(3, 1, 0) += alpha * t_3_1_0;
+        const std::complex<double> g_215 = -g_190;
+        const std::complex<double> g_216 = d2h2 * (0.625 + g_31);
+        const std::complex<double> g_217 = tan_x * (d_4 * (il::ii * 0.109375));
+        const std::complex<double> g_218 = c_3_4tcos * (h4 * 0.078125);
+        const std::complex<double> g_219 = tan_x * (il::ii * 0.46875);
+        const std::complex<double> g_220 = il::ii * g_202;
+        const std::complex<double> t_3_1_1 = f[1] * (g_215 * (g_191 + g_192))
+                + f[2] * (g_190 * (g_195 + (g_193 + g_194))) + f[3] * (g_215
+                * (g_216 + g_217 + g_218 + e_2 * (d_4 * (2.0 + tan_x * (il::ii
+                * 1.015625)) + h4 * g_199 + d2h2 * (g_219 + 0.125 * g_201))))
+                + f[5] * (g_220 * (c_5_m4nu + g_20)) + f[6] * (g_220 * (g_204
+                + g_205)) + f[7] * (il::ii * g_206 * (g_207 + g_208)) + f[8]
+                * (il::ii * g_209 * (g_212 + g_214));
+        s(3, 1, 1) += alpha * t_3_1_1;
+        const std::complex<double> e_4 = e_2 * e_2;
+        const double g_221 = -d_4;
+        const std::complex<double> g_222 = il::ii * -0.8 + tan_x * 0.3625;
+        const double g_223 = d2h2 / 3.0;
+        const double g_224 = nu * 0.475;
+        const double c_115_m38nu_80 = 1.4375 - g_224;
+        const double c_3_mnu = 3.0 - nu;
+        const double g_225 = 2.0 * c_7_m2nu;
+        const std::complex<double> g_226 = h2 * e_4;
+        const std::complex<double> g_227 = h4 * (il::ii * 0.8);
+        const double g_228 = tan_x * 0.2375;
+        const std::complex<double> g_229 = e_3 * g_30;
+        const double g_230 = h2 * 1.5;
+        const double g_231 = d_2 * 3.5;
+        const std::complex<double> t_3_1_2 = f[0] * (c_tcos_n1 * (c_1_m2nu
+                * (e_4 * (il::ii * (6.4 / 3.0))))) + f[1] * (il::ii * e_4 * (h2
+                * (c_tcos_n1 * (c_2_mnu * (12.8 / 3.0))) - d_2 * (c_1_m2nu
+                / 3.0 * (5.2 + tan_x * (il::ii * 0.725) + tcos_x * 3.2))))
+                + f[2] * (e_4 * (c_1_m2nu * g_221 * g_222 - c_tcos_n1
+                * (c_13_m2nu * (h4 * (il::ii * (0.8 / 3.0)))) + g_223 * (tan_x
+                * -c_115_m38nu_80 + il::ii * 0.4 * (1.0 + c_3_mnu * 8.0
+                + tcos_x * g_225)))) + f[3] * (g_226 * (g_77 * g_222
+                + c_tcos_n1 * g_227 + d2h2 * (g_228 - il::ii * 0.8 * g_79)))
+                + f[5] * (c_1_m2nu * (e_3 * (d * -1.5))) + f[6] * (g_229
+                * (c_2_mnu * (6.0 * h2) + c_1_m2nu * g_27)) + f[7] * (g_229
+                * (c_13_m2nu * (h4 * 0.75) + c_7_m2nu * (d2h2 * 2.5) + c_1_m2nu
+                * (d_4 * 1.75))) + f[8] * (c_d_h * (h2 * g_229) * (g_230
+                + g_231));
+        s(3, 1, 2) += alpha * t_3_1_2;
+        const double g_232 = c_2_mnu * 0.5;
+        const std::complex<double> g_233 = tcos_x * g_232;
+        const std::complex<double> g_234 = e_2 * (nu * (3.2 / 3.0));
+        const std::complex<double> g_235 = c_tcos_n1 * g_234;
+        const double g_236 = c_5_mnu * 0.5;
+        const double g_237 = h2 * g_236;
+        const std::complex<double> g_238 = tcos_x * g_237;
+        const std::complex<double> g_239 = tan_x * (il::ii * 0.3625);
+        const std::complex<double> g_240 = e_2 * (c_tcos_n1 * (h2 * (c_3_nu
+                * (-3.2 / 3.0))) + g_160 / 3.0 * (2.6 + g_239 + tcos_x * 1.6));
+        const double g_241 = 0.2 + nu * (0.11875 / 3.0);
+        const std::complex<double> g_242 = e_2 * (g_92 * g_165 - c_tcos_n1
+                * (c_12_nu * (g_53 / 3.0)) + d2h2 * (1.4 + nu * (0.8 / 3.0)
+                + tcos_x * (c_6_nu * (0.4 / 3.0)) + tan_x * (il::ii * g_241)));
+        const std::complex<double> g_243 = h4 * (tcos_x * 0.5);
+        const double g_244 = c_2_mnu * 0.25;
+        const std::complex<double> g_245 = e * (d * g_244);
+        const double g_246 = nu * 0.75;
+        const std::complex<double> g_247 = d * g_246;
+        const std::complex<double> g_248 = e_3 * g_247;
+        const std::complex<double> g_249 = h2 * (e * (d * g_236));
+        const std::complex<double> g_250 = d * 0.5;
+        const std::complex<double> g_251 = e_3 * g_250 * (g_161 + g_43 * d_2);
+        const std::complex<double> g_252 = h4 * g_81;
+        const std::complex<double> g_253 = d * 0.125;
+        const std::complex<double> g_254 = e_3 * g_253 * (g_167 + (d_4 * (nu
+                * 7.0) + d2h2 * (c_6_nu * 10.0)));
+        const std::complex<double> g_255 = g_90 * (c_d_h * (h2 * (e_3 * (d
+                * -0.25))));
+        const std::complex<double> t_3_2_0 = f[0] * (g_118 * (g_233 + g_235))
+                + f[1] * (g_118 * (g_238 - g_240)) + f[2] * (g_118 * (g_242
+                - g_243)) + f[3] * (g_226 * (g_80 + (g_78 + d_4 * (il::ii
+                * -1.2 + tan_x * 0.54375)))) + f[5] * (g_245 - g_248) + f[6]
+                * (g_249 - g_251) + f[7] * (g_252 - g_254) + f[8] * g_255;
+        s(3, 2, 0) += alpha * t_3_2_0;
+        const std::complex<double> t_3_2_1 = f[0] * (e_2 * (g_235 + -g_233))
+                + f[1] * (g_120 * (g_238 + g_240)) + f[2] * (e_2 * (g_242
+                + g_243)) + f[3] * (g_226 * (g_93 + d_4 * (-1.2 - tan_x
+                * (il::ii * 0.54375)) + d2h2 * (tan_x * (il::ii * -0.11875)
+                - g_94))) + f[5] * (il::ii * (g_245 + g_248)) + f[6] * (il::ii
+                * (g_249 + g_251)) + f[7] * (il::ii * (g_252 + g_254)) + f[8]
+                * (-il::ii * g_255);
+        s(3, 2, 1) += alpha * t_3_2_1;
+        const std::complex<double> g_256 = g_108 + h2 * (19.0 + tcos_x * 28.0);
+        const double g_257 = g_23 + g_42;
+        const std::complex<double> t_3_2_2 = f[1] * (c_5_8tcos * (h * (e_2 * (d
+                * (il::ii * -0.125))))) + f[2] * (h * (e_2 * (d * (il::ii
+                * 0.0625))) * g_256) + f[3] * (g_109 * (h3 * (e_2 * (d
+                * (il::ii * -0.1875))))) + f[5] * (h * g_104) + f[6] * (h
+                * g_99 * g_257) + f[7] * (h * g_101 * (g_102 + d2h2 * 42.0
+                + 13.0 * h4)) + f[8] * (g_28 * (c_d_h * (h3 * g_104)));
+        s(3, 2, 2) += alpha * t_3_2_2;
+        const std::complex<double> g_258 = il::ii * g_11;
+        const std::complex<double> g_259 = e_2 * g_96;
+        const std::complex<double> g_260 = h * (d * 0.0625);
+        const std::complex<double> g_261 = g_2 + h2 * (il::ii * -19.0);
+        const std::complex<double> g_262 = e_2 * g_256;
+        const std::complex<double> g_263 = h3 * (d * 0.1875);
+        const std::complex<double> g_264 = 3.0 * il::ii * h2 - g_2;
+        const std::complex<double> g_265 = e_2 * g_109;
+        const double g_266 = d_2 + 12.0 * h2;
+        const std::complex<double> g_267 = e_2 * g_257;
+        const double g_268 = d_4 * -0.25 + h2 * g_231 + h4 * 9.75;
+        const std::complex<double> g_269 = e_2 * (d_4 * 1.25 + h2 * (d_2
+                * 10.5) + h4 * 3.25);
+        const std::complex<double> g_270 = c_d_h * (h3 * e);
+        const double g_271 = c_d_m3h * 0.5;
+        const std::complex<double> g_272 = e_2 * (d_2 * 2.5 + h2 * 0.5);
+        const std::complex<double> t_3_3_0 = f[1] * (g_258 * (0.625 - g_259))
+                + f[2] * (g_260 * (g_261 + il::ii * g_262)) + f[3] * (g_263
+                * (g_264 - il::ii * g_265)) + f[5] * (g_181 * (1.5 + e_2
+                * -0.5)) + f[6] * (g_181 * (g_266 - g_267)) + f[7] * (g_181
+                * (g_268 - g_269)) + f[8] * (-g_270 * (g_271 + g_272));
+        s(3, 3, 0) += alpha * t_3_3_0;
+        const std::complex<double> g_273 = -g_11;
+        const std::complex<double> g_274 = il::ii * g_181;
+        const std::complex<double> t_3_3_1 = f[1] * (g_273 * (0.625 + g_259))
+                + f[2] * (g_260 * (g_262 + il::ii * g_261)) + f[3] * (g_263
+                * (il::ii * g_264 - g_265)) + f[5] * (g_274 * (1.5 + g_36))
+                + f[6] * (g_274 * (g_266 + g_267)) + f[7] * (g_274 * (g_268
+                + g_269)) + f[8] * (il::ii * g_270 * (g_272 + -g_271));
+        s(3, 3, 1) += alpha * t_3_3_1;
+        const std::complex<double> g_275 = e_2 * (2.0 * il::ii);
+        const std::complex<double> t_3_3_2 = f[0] * (tcos_x * g_275) + f[1]
+                * (tcos_x * (h2 * (e_2 * (il::ii * -4.0)))) + f[2] * (tcos_x
+                * (h4 * g_275)) + f[5] * g_81 + f[6] * (e * (d * g_132)) + f[7]
+                * (e * (d * g_133));
+        s(3, 3, 2) += alpha * t_3_3_2;
+        const std::complex<double> d_c = std::conj(d);
+        const std::complex<double> g_276 = d_c * (nu * 1.25);
+        const double g_277 = h * 0.0625;
+        const std::complex<double> g_278 = h2 * (g_174 * il::ii) - tan_x
+                * (c_5_m2nu * d_2);
+        const std::complex<double> g_279 = il::ii * (h2 * (il::ii * (3.0 * (9.0
+                - g_3))) - tan_x * (g_3 * d_2));
+        const double g_280 = h * 0.09375;
+        const double g_281 = 2.0 * d2h2;
+        const double g_282 = g_221 + g_281;
+        const double g_283 = tan_x * g_282;
+        const double g_284 = -c_5_m2nu;
+        const std::complex<double> g_285 = nu * (2.0 * il::ii);
+        const double g_286 = h * 2.0;
+        const std::complex<double> g_287 = e_c * (nu * (c_d_3h * g_286));
+        const double g_288 = h * 4.5 * (d_2 + 5.0 * h2);
+        const std::complex<double> g_289 = e_c * (c_d_m3h * (c_d_h * (h * (nu
+                * 0.5))));
+        const double g_290 = h * 0.75 * (d_4 - g_103 - 15.0 * h4);
+        const double g_291 = c_d_h * (h * -0.25) * (g_210 + (d_4 - g_281));
+        const std::complex<double> t_4_1_0 = f[1] * (h * (d_sin_p * 2.875
+                - il::ii * g_276)) + f[2] * (g_277 * (d_cos_p * g_278 + d_sin_p
+                * g_279)) + f[3] * (g_280 * (d_sin_p * g_210 + d_cos_p
+                * g_283)) + f[5] * (g_21 * (cos_p * g_284 - sin_p * g_285))
+                + f[6] * (g_287 - cos_p * g_288) + f[7] * (-g_289 + cos_p
+                * g_290) + f[8] * (cos_p * g_291);
+        s(4, 1, 0) += alpha * t_4_1_0;
+        const std::complex<double> t_4_1_1 = f[1] * (h * (g_276 - d_cos_p
+                * 2.875)) + f[2] * (g_277 * (d_sin_p * g_278 - d_cos_p
+                * g_279)) + f[3] * (g_280 * (d_cos_p * -g_210 + d_sin_p
+                * g_283)) + f[5] * (g_21 * (sin_p * g_284 + cos_p * g_285))
+                + f[6] * (il::ii * g_287 - sin_p * g_288) + f[7] * (-il::ii
+                * g_289 + sin_p * g_290) + f[8] * (sin_p * g_291);
+        s(4, 1, 1) += alpha * t_4_1_1;
+        const double abh = std::fabs(h);
+        const double g_292 = c_d_h * (h2 * d_1);
+        const std::complex<double> t_4_1_2 = f[1] * (tan_x * (d_2 * (c_1_m2nu
+                * (0.725 / 3.0)))) + f[2] * (g_2 * (d_2 * (c_1_m2nu * 0.0375)
+                - h2 * (c_115_m38nu_80 / 3.0))) + f[3] * (tan_x * d2h2 * (h2
+                * 0.2375 - d_2 * 0.1125)) + f[4] * (abh * (c_1_mnu * -8.0))
+                + f[5] * (d_1 * (c_1_m2nu * -1.5)) + f[6] * (d_1 * (d_2
+                * (c_1_m2nu * (1.0 / 3.0)) + h2 * (c_3_mnu * 3.6 - 0.4)))
+                + f[7] * (d_1 * (d_4 * (c_1_m2nu * -0.15) + d2h2 * (c_7_m2nu
+                * (1.0 / 6.0)) + h4 * ((0.35 + 1.9 * (8 - nu)) / 3.0))) + f[8]
+                * (g_292 * (h2 * (1.9 / 3.0) - d_2 * 0.3));
+        s(4, 1, 2) += alpha * t_4_1_2;
+        const std::complex<double> tcos_c = std::conj(tcos_x);
+        const std::complex<double> e_2_c = std::conj(e_2);
+        const std::complex<double> g_293 = tcos_c * (e_2_c * g_232);
+        const double g_294 = tan_x * (d_2 * (nu * (0.3625 / 3.0)));
+        const std::complex<double> g_295 = tcos_c * (e_2_c * g_237);
+        const double g_296 = tan_x * (d_2 * (d_2 * (nu * 0.01875) - h2
+                * g_241));
+        const std::complex<double> g_297 = tcos_c * (e_2_c * (h4 * 0.5));
+        const double g_298 = tan_x * (d2h2 * g_49);
+        const double g_299 = abh * (c_1_nu * -2.0);
+        const std::complex<double> g_300 = e_c * (d_c * g_244);
+        const double g_301 = d_1 * g_246;
+        const double g_302 = d_1 * (d_2 * (nu * (0.5 / 3.0)) + h2 * (4.3 + nu
+                * 0.9));
+        const std::complex<double> g_303 = e_c * (d_c * g_237);
+        const double g_304 = d_1 * (d_4 * (nu * -0.075) + d2h2 * (c_6_nu
+                * (0.25 / 3.0)) + h4 / 3.0 * (g_224 + 7.3));
+        const std::complex<double> g_305 = e_c * (h4 * d_c);
+        const double g_306 = g_292 * (g_145 + d_2 * -0.15);
+        const std::complex<double> t_4_2_0 = f[0] * (-il::ii * g_293) + f[1]
+                * (g_294 - il::ii * g_295) + f[2] * (g_296 + il::ii * g_297)
+                + f[3] * g_298 + f[4] * g_299 + f[5] * (g_300 + -g_301) + f[6]
+                * (g_302 + g_303) + f[7] * (g_304 + g_305) + f[8] * g_306;
+        s(4, 2, 0) += alpha * t_4_2_0;
+        const std::complex<double> t_4_2_1 = f[0] * g_293 + f[1] * (g_295
+                + -il::ii * g_294) + f[2] * (-il::ii * g_296 - g_297) + f[3]
+                * (-il::ii * g_298) + f[4] * (-il::ii * g_299) + f[5] * (il::ii
+                * (g_301 + g_300)) + f[6] * (-il::ii * (g_302 - g_303)) + f[7]
+                * (-il::ii * (g_304 - g_305)) + f[8] * (-il::ii * g_306);
+        s(4, 2, 1) += alpha * t_4_2_1;
+        const double g_307 = h * (c_13_10nu * 0.125);
+        const double g_308 = tan_x * (d_2 * (c_3_2nu * 0.0625));
+        const double g_309 = h2 * (c_7_2nu * 0.1875);
+        const double g_310 = g_13 * (h2 * 2 - d_2);
+        const double g_311 = h4 * 0.46875;
+        const double g_312 = h * (c_3_2nu * -1.5);
+        const double g_313 = g_8 * (d_2 * (c_5_4nu * 0.5) + h2 * (c_11_4nu
+                * 1.5));
+        const double g_314 = h * (d_4 * (c_1_2nu * 0.25) - h2 * (d_2 * g_56)
+                - h4 * (c_13_2nu * 0.75));
+        const double g_315 = c_d_h * g_8 * (d_4 * 0.25 - h2 * (d_2 * 0.5) + h4
+                * 1.25);
+        const std::complex<double> t_5_0_0 = f[1] * (d_sin_p * g_307) + f[2]
+                * (g_8 * (d_cos_p * g_308 + d_sin_p * g_309)) + f[3] * (h
+                * (d_cos_p * g_310 + d_sin_p * g_311)) + f[5] * (cos_p * g_312)
+                + f[6] * (cos_p * g_313) + f[7] * (cos_p * g_314) + f[8]
+                * (cos_p * g_315);
+        s(5, 0, 0) += alpha * t_5_0_0;
+        const std::complex<double> t_5_0_1 = f[1] * (d_cos_p * -g_307) + f[2]
+                * (g_8 * (d_sin_p * g_308 - d_cos_p * g_309)) + f[3] * (h
+                * (d_sin_p * g_310 - d_cos_p * g_311)) + f[5] * (sin_p * g_312)
+                + f[6] * (sin_p * g_313) + f[7] * (sin_p * g_314) + f[8]
+                * (sin_p * g_315);
+        s(5, 0, 1) += alpha * t_5_0_1;
+        const std::complex<double> t_5_0_2 = f[1] * (tan_x * (d_2 * (c_1_2nu
+                * (1.0 / 12.0)))) + f[2] * (tan_x * (h2 * (d_2 * (c_2_nu
+                * (-1.0 / 6.0))))) + f[3] * (tan_x * (h4 * g_188)) + f[4]
+                * (abh * (c_1_nu * -4.0)) + f[5] * (d_1 * (c_1_2nu * -0.5))
+                + f[6] * (d_1 * (g_61 + g_230 * (5 + nu * 2))) + f[7] * (d_1
+                * (h2 * (2.0 / 3.0) * (c_2_nu * d_2 + h2 * (nu + 7)))) + f[8]
+                * (d_1 * (c_d_h * (h4 * (2.0 / 3.0))));
+        s(5, 0, 2) += alpha * t_5_0_2;
+        const std::complex<double> g_316 = e_2 * (1.4375 + tcos_x * 2.5);
+        const double g_317 = 0.1875 + c_1_mnu * 1.25;
+        const std::complex<double> g_318 = g_98 + 2.7;
+        const std::complex<double> g_319 = e_2 * 1.25;
+        const double g_320 = 3.75 - g_113;
+        const std::complex<double> g_321 = 0.25 * g_181;
+        const std::complex<double> g_322 = e_2 * (15.0 * h2 + d_2 * 27.0);
+        const double g_323 = h2 * (3.0 * c_15_m8nu) + c_9_m8nu * d_2;
+        const std::complex<double> g_324 = 0.5 * g_321;
+        const double g_325 = c_3_m4nu * d_4 - d2h2 * (2.0 * c_9_m4nu) - h4
+                * (3.0 * c_15_m4nu);
+        const std::complex<double> g_326 = g_20 * (g_210 + (g_102 + d2h2
+                * 18.0));
+        const std::complex<double> g_327 = c_d_h * g_324;
+        const double g_328 = g_282 - g_210;
+        const std::complex<double> g_329 = e_2 / 3.0;
+        const std::complex<double> g_330 = g_211 * g_329;
+        const std::complex<double> t_5_1_0 = f[1] * (g_258 * (g_316 + -g_317))
+                + f[2] * (g_11 * (c_9_m4nu * (h2 * (il::ii * 0.09375)) - tan_x
+                * (c_5_m4nu * (d_2 * 0.03125)) + e_2 * (d_2 * (g_200 + il::ii
+                * (-3.25 / 3.0)) - h2 * (il::ii * 0.3125) * g_318))) + f[3]
+                * (g_11 * (-(h4 * (il::ii * 0.234375) - tan_x * (d2h2
+                * 0.09375) + tan_x * (d_4 * 0.046875)) + e_2 * (g_196 + g_198
+                - g_197))) + f[5] * (g_181 * (g_319 - g_320)) + f[6] * (g_321
+                * (g_322 - g_323)) + f[7] * (g_324 * (g_325 + g_326)) + f[8]
+                * (g_327 * (g_328 + g_330));
+        s(5, 1, 0) += alpha * t_5_1_0;
+        const std::complex<double> t_5_1_1 = f[1] * (g_11 * (g_317 + g_316))
+                + f[2] * (g_273 * (c_9_m4nu * (h2 * 0.09375) + tan_x
+                * (c_5_m4nu * (d_2 * (il::ii * 0.03125))) + e_2 * (d_2 * (g_219
+                + 3.25 / 3.0) + g_318 * (h2 * 0.3125)))) + f[3] * (g_11 * (h4
+                * 0.234375 + tan_x * (d2h2 * (il::ii * 0.09375)) - tan_x * (d_4
+                * (il::ii * 0.046875)) + e_2 * (g_217 + (g_216 + g_218))))
+                + f[5] * (-il::ii * g_181 * (g_319 + g_320)) + f[6] * (-il::ii
+                * g_321 * (g_322 + g_323)) + f[7] * (-il::ii * g_324 * (g_326
+                + -g_325)) + f[8] * (il::ii * g_327 * (g_328 - g_330));
+        s(5, 1, 1) += alpha * t_5_1_1;
+        const std::complex<double> t_5_1_2 = f[0] * (tcos_x * (e_2 * (c_1_m2nu
+                * (il::ii * (6.4 / 3.0))))) + f[1] * (g_329 * (g_151 * (il::ii
+                * 2.6 - tan_x * 0.725) + tcos_x * (h2 * (il::ii * (c_2_mnu
+                * 12.8))))) + f[2] * (e_2 * (d_4 * (tan_x * g_150) + d2h2
+                * ((il::ii * (-5.0 + nu * 1.6) + c_115_m38nu_80 * tan_x) / 3.0)
+                - h4 * (tcos_x * (c_13_m2nu * (il::ii * (0.8 / 3.0)))))) + f[3]
+                * (g_123 * (tan_x * (d_4 * -0.1875) + d2h2 * (il::ii * 0.8
+                - g_228) + tcos_x * g_227)) + f[5] * (c_1_m2nu * g_59) + f[6]
+                * (g_81 * g_152) + f[7] * (g_65 * (d_4 * g_34 + d2h2 * g_225
+                + h4 * (3.0 * c_13_m2nu))) + f[8] * (c_d_m3h * (c_d_h * (h2
+                * (e * (d * -0.5)))));
+        s(5, 1, 2) += alpha * t_5_1_2;
+        const std::complex<double> g_331 = tcos_x * g_234;
+        const double g_332 = tan_x * (d_2 * (c_2_mnu * (0.125 / 3.0)));
+        const std::complex<double> g_333 = g_329 * (g_160 * (g_239 + 1.3)
+                + tcos_x * (h2 * (c_3_nu * 3.2)));
+        const std::complex<double> g_334 = e_2 * (tan_x * (d_4 * g_106) + g_223
+                * (-il::ii * (2.1 + nu * 0.4) + tan_x * (0.6 + nu * 0.11875))
+                - tcos_x * (c_12_nu * (h4 * (il::ii * (0.4 / 3.0)))));
+        const double g_335 = tan_x * (h2 * (d_2 * (c_5_mnu * (0.125 / 3.0))));
+        const double g_336 = d_2 * 0.125;
+        const double g_337 = tan_x * (h4 * g_336);
+        const std::complex<double> g_338 = g_123 * (g_52 + h4 * g_74 + d_4
+                * (tan_x * (il::ii * 0.09375)));
+        const double g_339 = abh * -c_3_mnu;
+        const std::complex<double> g_340 = e * g_247;
+        const double g_341 = d_1 * g_244;
+        const double g_342 = d_1 * (h2 * (0.75 * (6.0 - nu)) + d_2 * (c_2_mnu
+                * (0.25 / 3.0)));
+        const std::complex<double> g_343 = g_162 * (e * g_250);
+        const double g_344 = h2 * (d_1 * (1.0 / 6.0)) * (h2 * (15.0 - nu)
+                + c_5_mnu * d_2);
+        const std::complex<double> g_345 = e * g_253 * (g_166 + g_167 - g_165);
+        const double g_346 = h2 * c_d_h;
+        const double g_347 = d_1 * (h2 * (1.0 / 3.0));
+        const std::complex<double> t_5_2_0 = f[0] * (il::ii * g_331) + f[1]
+                * (g_332 + il::ii * g_333) + f[2] * (g_334 + -g_335) + f[3]
+                * (g_337 + il::ii * g_338) + f[4] * g_339 + f[5] * (g_340
+                + -g_341) + f[6] * (g_342 + g_343) + f[7] * (g_344 + g_345)
+                + f[8] * (g_346 * (g_347 - g_66));
+        s(5, 2, 0) += alpha * t_5_2_0;
+        const std::complex<double> t_5_2_1 = f[0] * g_331 + f[1] * (g_333
+                + il::ii * g_332) + f[2] * (-il::ii * (g_335 + g_334)) + f[3]
+                * (g_338 + il::ii * g_337) + f[4] * (il::ii * g_339) + f[5]
+                * (-il::ii * (g_341 + g_340)) + f[6] * (il::ii * (g_342
+                - g_343)) + f[7] * (il::ii * (g_344 - g_345)) + f[8] * (il::ii
+                * g_346 * (g_66 + g_347));
+        s(5, 2, 1) += alpha * t_5_2_1;
+        const std::complex<double> t_5_2_2 = f[1] * (d * (h * (il::ii
+                * 0.625))) + f[2] * (d * g_277 * g_261) + f[3] * (d * (h3
+                * 0.1875) * g_264) + f[5] * g_22 + f[6] * (e * (h * g_266))
+                + f[7] * (e * (h * (0.25 * (g_221 + g_213 + h4 * 39.0))))
+                + f[8] * (c_d_m3h * (c_d_h * (h3 * g_153)));
+        s(5, 2, 2) += alpha * t_5_2_2;
+        const double g_348 = tan_x * g_336;
+        const double g_349 = h2 * 2.375;
+        const double g_350 = -h3;
+        const double g_351 = 3.0 * g_348;
+        const double g_352 = h2 * 1.125;
+        const double g_353 = g_286 * g_266;
+        const double g_354 = h * (d_4 * -0.5 + h2 * g_89 + h4 * 19.5);
+        const double g_355 = -(c_d_m3h * (h3 * c_d_h));
+        const std::complex<double> t_5_3_0 = f[1] * (d_sin_p * (h * -1.25))
+                + f[2] * (h * (d_cos_p * g_348 + d_sin_p * g_349)) + f[3]
+                * (g_350 * (d_cos_p * g_351 + d_sin_p * g_352)) + f[5] * (cos_p
+                * g_5) + f[6] * (cos_p * g_353) + f[7] * (cos_p * g_354) + f[8]
+                * (cos_p * g_355);
+        s(5, 3, 0) += alpha * t_5_3_0;
+        const std::complex<double> t_5_3_1 = f[1] * (d_cos_p * (h * 1.25))
+                + f[2] * (h * (d_sin_p * g_348 - d_cos_p * g_349)) + f[3]
+                * (g_350 * (d_sin_p * g_351 - d_cos_p * g_352)) + f[5] * (sin_p
+                * g_5) + f[6] * (sin_p * g_353) + f[7] * (sin_p * g_354) + f[8]
+                * (sin_p * g_355);
+        s(5, 3, 1) += alpha * t_5_3_1;
+        const double g_356 = d_2 * (1.0 / 3.0);
+        const std::complex<double> t_5_3_2 = f[1] * (tan_x * (d_2 * (1.0
+                / 6.0))) + f[2] * (tan_x * (h2 * g_356)) + f[3] * (tan_x * (h4
+                * (d_2 * -0.5))) + f[5] * g_171 + f[6] * (d_1 * (g_356 - 9.0
+                * h2)) + f[7] * (d_1 * (g_39 * (d_2 * (4.0 / 3.0) + 8.0 * h2)))
+                + f[8] * (d_1 * (c_d_h * (h4 * (-4.0 / 3.0))));
+        s(5, 3, 2) += alpha * t_5_3_2;
+        s(2, 0, 0) += alpha * std::conj(t_1_0_0);
+        s(2, 0, 1) += alpha * std::conj(t_1_0_1);
+        s(2, 0, 2) += alpha * std::conj(t_1_0_2);
+        s(2, 3, 0) += alpha * std::conj(t_1_3_0);
+        s(2, 3, 1) += alpha * std::conj(t_1_3_1);
+        s(2, 3, 2) += alpha * std::conj(t_1_3_2);
+        s(4, 0, 0) += alpha * std::conj(t_3_0_0);
+        s(4, 0, 1) += alpha * std::conj(t_3_0_1);
+        s(4, 0, 2) += alpha * std::conj(t_3_0_2);
+        s(4, 2, 2) += alpha * std::conj(t_5_2_2);
+        s(4, 3, 0) += alpha * std::conj(t_3_3_0);
+        s(4, 3, 1) += alpha * std::conj(t_3_3_1);
+        s(4, 3, 2) += alpha * std::conj(t_3_3_2);
+    }
+
+// Special case (reduced summation):
+// s += alpha * dot(s_ij_red_h(nu, eix, h), f)
+
+    void s_ij_red_h_contr
+            (double nu, std::complex<double> eix,
+             double h,
+             const il::StaticArray<double, 5> &f, double alpha,
+             il::io_t, il::StaticArray3D<std::complex<double>, 6, 4, 3> &s) {
+        // 159 non-zero coefficients (of 360), 29 of them by conjugation;
+        // 82 common sub-expressions
+        const double sin_x = std::imag(eix);
+        const double g_0 = nu * 2.0;
+        const double c_7_2nu = g_0 + 7.0;
+        const double h2 = h * h;
+        const double h3 = h * h2;
+        const double h4 = h2 * h2;
+        const double h5 = h * h4;
+        const std::complex<double> t_0_0_0 = f[2] * (sin_x * (h * -c_7_2nu))
+                + f[3] * (sin_x * (h3 * -9.0)) + f[4] * (sin_x * (h5 * -1.5));
+        s(0, 0, 0) += alpha * t_0_0_0;
+        const double cos_x = std::real(eix);
+        const std::complex<double> t_0_0_1 = f[2] * (cos_x * (h * c_7_2nu))
+                + f[3] * (cos_x * (h3 * 9.0)) + f[4] * (cos_x * (h5 * 1.5));
+        s(0, 0, 1) += alpha * t_0_0_1;
+        const std::complex<double> g_1 = h * (0.5 * il::ii);
+        const std::complex<double> e2x = eix * eix;
+        const std::complex<double> c_eix_3_1 = eix * (3.0 + e2x);
+        const double g_2 = nu * 4.0;
+        const std::complex<double> g_3 = eix * g_2;
+        const std::complex<double> t_0_1_0 = f[2] * (g_1 * (3.0 * c_eix_3_1
+                - g_3)) + f[3] * (c_eix_3_1 * (h3 * (1.5 * il::ii))) + f[4]
+                * (c_eix_3_1 * (h5 * (il::ii * 0.25)));
+        s(0, 1, 0) += alpha * t_0_1_0;
+        const double g_4 = h * -0.5;
+        const std::complex<double> c_eix_3_m1 = eix * (3.0 - e2x);
+        const std::complex<double> t_0_1_1 = f[2] * (g_4 * (3.0 * c_eix_3_m1
+                - g_3)) + f[3] * (c_eix_3_m1 * (h3 * -1.5)) + f[4]
+                * (c_eix_3_m1 * (h5 * -0.25));
+        s(0, 1, 1) += alpha * t_0_1_1;
+        const double abh = std::fabs(h);
+        const std::complex<double> t_0_1_2 = f[0] * (e2x * (nu * -il::ii)
+                / abh);
+        s(0, 1, 2) += alpha * t_0_1_2;
+        const double c_1_mnu = 1.0 - nu;
+        const std::complex<double> g_5 = e2x * (c_1_mnu * -0.25) / abh;
+        const std::complex<double> t_0_2_0 = f[0] * (il::ii * g_5);
+        s(0, 2, 0) += alpha * t_0_2_0;
+        const std::complex<double> t_0_2_1 = f[0] * g_5;
+        s(0, 2, 1) += alpha * t_0_2_1;
+        const std::complex<double> t_0_2_2 = f[2] * (eix * (h * -il::ii))
+                + f[3] * (eix * (h3 * (il::ii * -2.0)));
+        s(0, 2, 2) += alpha * t_0_2_2;
+        const std::complex<double> t_0_3_0 = f[2] * (sin_x * (h * 2.0)) + f[3]
+                * (sin_x * (4.0 * h3));
+        s(0, 3, 0) += alpha * t_0_3_0;
+        const double g_6 = h3 * -4.0;
+        const std::complex<double> t_0_3_1 = f[2] * (cos_x * (h * -2.0)) + f[3]
+                * (cos_x * g_6);
+        s(0, 3, 1) += alpha * t_0_3_1;
+        const double sgh = (h < 0) ? -1.0 : static_cast<double>(h > 0);
+        const double c_1_nu = nu + 1.0;
+        const std::complex<double> t_1_0_0 = f[0] * (sgh * (e2x * (c_1_nu
+                * (-0.5 * il::ii))));
+        s(1, 0, 0) += alpha * t_1_0_0;
+        const std::complex<double> t_1_0_1 = f[0] * (sgh * (e2x * (c_1_nu
+                * -0.5)));
+        s(1, 0, 1) += alpha * t_1_0_1;
+        const std::complex<double> t_1_0_2 = f[1] * (eix * ((1.0 + g_0) * (0.5
+                * il::ii))) + f[2] * (eix * (h2 * ((nu + 2.0) * (2.0
+                * il::ii)))) + f[3] * (eix * (h4 * (2.0 * il::ii)));
+        s(1, 0, 2) += alpha * t_1_0_2;
+        const std::complex<double> g_7 = e2x * 0.5;
+        const std::complex<double> t_1_1_0 = f[0] * (e2x * (sgh * -il::ii)
+                * (c_1_mnu + g_7));
+        s(1, 1, 0) += alpha * t_1_1_0;
+        const std::complex<double> t_1_1_1 = f[0] * (e2x * sgh * (c_1_mnu
+                - g_7));
+        s(1, 1, 1) += alpha * t_1_1_1;
+        const std::complex<double> g_8 = eix * ((1.0 - g_0) * (0.5 * il::ii));
+        const double c_2_mnu = 2.0 - nu;
+        const std::complex<double> g_9 = eix * (h2 * (c_2_mnu * (2.0
+                * il::ii)));
+        const std::complex<double> g_10 = eix * (h4 * ((13.0 - g_0) * (il::ii
+                * 0.25)));
+        const std::complex<double> g_11 = h2 * (0.5 * il::ii);
+        const std::complex<double> g_12 = eix * (h4 * g_11);
+        const std::complex<double> t_1_1_2 = f[1] * (e2x * g_8) + f[2] * (e2x
+                * g_9) + f[3] * (e2x * g_10) + f[4] * (e2x * g_12);
+        s(1, 1, 2) += alpha * t_1_1_2;
+        const std::complex<double> g_13 = nu * e2x;
+        const std::complex<double> g_14 = eix * (il::ii * 0.25) * (c_2_mnu
+                + g_13);
+        const double c_5_mnu = 5.0 - nu;
+        const double c_3_nu = nu + 3.0;
+        const std::complex<double> g_15 = c_3_nu * e2x;
+        const std::complex<double> g_16 = eix * g_11 * (c_5_mnu + g_15);
+        const double c_12_nu = nu + 12.0;
+        const std::complex<double> g_17 = c_12_nu * e2x;
+        const std::complex<double> g_18 = eix * (h4 * (il::ii * 0.125)) * (8.0
+                + g_17);
+        const std::complex<double> e3x = eix * e2x;
+        const double h6 = h2 * h4;
+        const std::complex<double> g_19 = e3x * (h6 * 0.25);
+        const std::complex<double> t_1_2_0 = f[1] * g_14 + f[2] * g_16 + f[3]
+                * g_18 + f[4] * (il::ii * g_19);
+        s(1, 2, 0) += alpha * t_1_2_0;
+        const std::complex<double> g_20 = eix * -0.25 * (c_2_mnu - g_13);
+        const std::complex<double> g_21 = eix * (h2 * -0.5) * (c_5_mnu - g_15);
+        const std::complex<double> g_22 = eix * (h4 * -0.125) * (8.0 - g_17);
+        const std::complex<double> t_1_2_1 = f[1] * g_20 + f[2] * g_21 + f[3]
+                * g_22 + f[4] * g_19;
+        s(1, 2, 1) += alpha * t_1_2_1;
+        const std::complex<double> t_1_3_2 = f[1] * (eix * il::ii) + f[2]
+                * (eix * (h2 * (il::ii * -4.0))) + f[3] * (eix * (h4 * (il::ii
+                * -4.0)));
+        s(1, 3, 2) += alpha * t_1_3_2;
+        const std::complex<double> g_23 = e2x * -sgh;
+        const std::complex<double> t_2_1_0 = f[0] * (il::ii * g_23);
+        s(2, 1, 0) += alpha * t_2_1_0;
+        const std::complex<double> t_2_1_1 = f[0] * g_23;
+        s(2, 1, 1) += alpha * t_2_1_1;
+        const std::complex<double> t_2_1_2 = f[1] * (3.0 * g_8) + f[2] * (3.0
+                * g_9) + f[3] * (3.0 * g_10) + f[4] * (3.0 * g_12);
+        s(2, 1, 2) += alpha * t_2_1_2;
+        const std::complex<double> c_e3x_3emx = e3x + 3.0 * std::conj(eix);
+        const std::complex<double> g_24 = c_e3x_3emx * (nu * 0.25);
+        const std::complex<double> g_25 = c_e3x_3emx * (c_3_nu * (h2 * 0.5));
+        const std::complex<double> g_26 = c_e3x_3emx * (c_12_nu * (h4 * 0.125));
+        const std::complex<double> g_27 = h6 * (eix * 0.75);
+        const std::complex<double> t_2_2_0 = f[1] * std::conj(g_14 - il::ii
+                * g_24) + f[2] * std::conj(g_16 - il::ii * g_25) + f[3]
+                * std::conj(g_18 - il::ii * g_26) + f[4] * (il::ii * g_27);
+        s(2, 2, 0) += alpha * t_2_2_0;
+        const std::complex<double> t_2_2_1 = f[1] * std::conj(g_24 - g_20)
+                + f[2] * std::conj(g_25 - g_21) + f[3] * std::conj(g_26 - g_22)
+                + f[4] * g_27;
+        s(2, 2, 1) += alpha * t_2_2_1;
+        const double g_28 = h * ((g_0 + 3.0) * 0.25);
+        const double g_29 = h3 * ((11.0 + g_2) * 0.25);
+        const double g_30 = h5 * ((g_0 + 13.0) * 0.125);
+        const double h7 = h2 * h5;
+        const double g_31 = h7 * 0.625;
+        const std::complex<double> t_3_0_0 = f[1] * (c_eix_3_1 * (g_28
+                * -il::ii)) + f[2] * (c_eix_3_1 * (g_29 * -il::ii)) + f[3]
+                * (c_eix_3_1 * (g_30 * -il::ii)) + f[4] * (c_eix_3_1 * (g_31
+                * -il::ii / 3.0));
+        s(3, 0, 0) += alpha * t_3_0_0;
+        const std::complex<double> t_3_0_1 = f[1] * (c_eix_3_m1 * g_28) + f[2]
+                * (c_eix_3_m1 * g_29) + f[3] * (c_eix_3_m1 * g_30) + f[4]
+                * (c_eix_3_m1 * (g_31 / 3.0));
+        s(3, 0, 1) += alpha * t_3_0_1;
+        const std::complex<double> t_3_0_2 = f[0] * (abh * (e2x * (c_1_nu
+                * (il::ii * -2.0))));
+        s(3, 0, 2) += alpha * t_3_0_2;
+        const std::complex<double> g_32 = eix * (h * 0.25);
+        const std::complex<double> g_33 = e2x * -il::ii;
+        const double c_5_m4nu = 5.0 - g_2;
+        const std::complex<double> g_34 = 3.0 * e2x;
+        const std::complex<double> g_35 = eix * (h3 * 0.25);
+        const double c_15_m8nu = 15.0 - nu * 8.0;
+        const std::complex<double> g_36 = e2x * 9.0;
+        const std::complex<double> g_37 = eix * (h5 * 0.125);
+        const double c_15_m4nu = 15.0 - g_2;
+        const std::complex<double> g_38 = eix * (h7 * 0.125);
+        const std::complex<double> t_3_1_0 = f[1] * (g_32 * g_33 * (c_5_m4nu
+                + g_34)) + f[2] * (g_35 * g_33 * (c_15_m8nu + g_36)) + f[3]
+                * (g_37 * g_33 * (c_15_m4nu + g_36)) + f[4] * (g_38 * g_33
+                * (e2x + 5.0 / 3.0));
+        s(3, 1, 0) += alpha * t_3_1_0;
+        const std::complex<double> t_3_1_1 = f[1] * (e2x * g_32 * (c_5_m4nu
+                - g_34)) + f[2] * (e2x * g_35 * (c_15_m8nu - g_36)) + f[3]
+                * (e2x * g_37 * (c_15_m4nu - g_36)) + f[4] * (e2x * g_38 * (5.0
+                / 3.0 - e2x));
+        s(3, 1, 1) += alpha * t_3_1_1;
+        const std::complex<double> t_3_1_2 = f[0] * (e2x * (e2x * (abh
+                * (c_1_mnu * (il::ii * -2.0)))));
+        s(3, 1, 2) += alpha * t_3_1_2;
+        const double c_3_mnu = 3.0 - nu;
+        const std::complex<double> g_39 = c_1_nu * e2x;
+        const std::complex<double> t_3_2_0 = f[0] * (e2x * (abh * (-0.5
+                * il::ii * (c_3_mnu + g_39))));
+        s(3, 2, 0) += alpha * t_3_2_0;
+        const std::complex<double> t_3_2_1 = f[0] * (e2x * (abh * (0.5
+                * (c_3_mnu - g_39))));
+        s(3, 2, 1) += alpha * t_3_2_1;
+        const std::complex<double> g_40 = eix * g_1;
+        const std::complex<double> g_41 = h3 * (4.0 * il::ii);
+        const std::complex<double> g_42 = eix * g_41;
+        const std::complex<double> g_43 = h5 * (il::ii * 3.25);
+        const std::complex<double> g_44 = eix * g_43;
+        const std::complex<double> g_45 = h7 * (0.5 * il::ii);
+        const std::complex<double> g_46 = eix * g_45;
+        const std::complex<double> t_3_2_2 = f[1] * (e2x * g_40) + f[2] * (e2x
+                * g_42) + f[3] * (e2x * g_44) + f[4] * (e2x * g_46);
+        s(3, 2, 2) += alpha * t_3_2_2;
+        const std::complex<double> t_3_3_0 = f[1] * (c_eix_3_1 * g_1) + f[2]
+                * (c_eix_3_1 * g_41) + f[3] * (c_eix_3_1 * g_43) + f[4]
+                * (c_eix_3_1 * g_45);
+        s(3, 3, 0) += alpha * t_3_3_0;
+        const std::complex<double> t_3_3_1 = f[1] * (c_eix_3_m1 * g_4) + f[2]
+                * (c_eix_3_m1 * g_6) + f[3] * (c_eix_3_m1 * (h5 * -3.25))
+                + f[4] * (c_eix_3_m1 * (h7 * -0.5));
+        s(3, 3, 1) += alpha * t_3_3_1;
+        const std::complex<double> g_47 = std::conj(g_32);
+        const std::complex<double> g_48 = 5.0 * e2x;
+        const std::complex<double> g_49 = std::conj(g_35);
+        const std::complex<double> g_50 = 15.0 * e2x;
+        const std::complex<double> g_51 = std::conj(g_37);
+        const std::complex<double> t_4_1_0 = f[1] * (g_47 * (3.0 * il::ii)
+                * (c_5_m4nu - g_48)) + f[2] * (g_49 * (3.0 * il::ii)
+                * (c_15_m8nu - g_50)) + f[3] * (g_51 * (3.0 * il::ii)
+                * (c_15_m4nu - g_50)) + f[4] * (sin_x * (h7 * 1.25));
+        s(4, 1, 0) += alpha * t_4_1_0;
+        const std::complex<double> t_4_1_1 = f[1] * (-3.0 * g_47 * (c_5_m4nu
+                + g_48)) + f[2] * (-3.0 * g_49 * (c_15_m8nu + g_50)) + f[3]
+                * (-3.0 * g_51 * (c_15_m4nu + g_50)) + f[4] * (cos_x * (h7
+                * -1.25));
+        s(4, 1, 1) += alpha * t_4_1_1;
+        const std::complex<double> g_52 = std::conj(e2x) * (abh * (c_3_mnu
+                * -0.5));
+        const std::complex<double> t_4_2_0 = f[0] * (-il::ii * g_52);
+        s(4, 2, 0) += alpha * t_4_2_0;
+        const std::complex<double> t_4_2_1 = f[0] * g_52;
+        s(4, 2, 1) += alpha * t_4_2_1;
+        const std::complex<double> t_5_0_0 = f[1] * (sin_x * (g_28 * 6.0))
+                + f[2] * (sin_x * (g_29 * 6.0)) + f[3] * (sin_x * (g_30 * 6.0))
+                + f[4] * (sin_x * (2.0 * g_31));
+        s(5, 0, 0) += alpha * t_5_0_0;
+        const std::complex<double> t_5_0_1 = f[1] * (cos_x * (g_28 * -6.0))
+                + f[2] * (cos_x * (g_29 * -6.0)) + f[3] * (cos_x * (g_30
+                * -6.0)) + f[4] * (cos_x * (g_31 * -2.0));
+        s(5, 0, 1) += alpha * t_5_0_1;
+        const double g_53 = 3.0 * c_5_m4nu;
+        const std::complex<double> g_54 = e2x / 3.0;
+        const std::complex<double> t_5_1_0 = f[1] * (-il::ii * g_32 * (g_53
+                + g_48)) + f[2] * (g_35 * (il::ii * -3.0) * (c_15_m8nu + g_48))
+                + f[3] * (g_37 * (il::ii * -3.0) * (c_15_m4nu + g_48)) + f[4]
+                * (g_38 * (il::ii * -5.0) * (1.0 + g_54));
+        s(5, 1, 0) += alpha * t_5_1_0;
+        const std::complex<double> t_5_1_1 = f[1] * (g_32 * (g_53 - g_48))
+                + f[2] * (3.0 * g_35 * (c_15_m8nu - g_48)) + f[3] * (3.0 * g_37
+                * (c_15_m4nu - g_48)) + f[4] * (5.0 * g_38 * (1.0 - g_54));
+        s(5, 1, 1) += alpha * t_5_1_1;
+        const std::complex<double> t_5_1_2 = f[0] * (e2x * (abh * (c_1_mnu
+                * (il::ii * -4.0))));
+        s(5, 1, 2) += alpha * t_5_1_2;
+        const std::complex<double> g_55 = e2x * (abh * -c_1_nu);
+        const std::complex<double> t_5_2_0 = f[0] * (il::ii * g_55);
+        s(5, 2, 0) += alpha * t_5_2_0;
+        const std::complex<double> t_5_2_1 = f[0] * g_55;
+        s(5, 2, 1) += alpha * t_5_2_1;
+        const std::complex<double> t_5_2_2 = f[1] * (3.0 * g_40) + f[2] * (3.0
+                * g_42) + f[3] * (3.0 * g_44) + f[4] * (3.0 * g_46);
+        s(5, 2, 2) += alpha * t_5_2_2;
+        const std::complex<double> t_5_3_0 = f[1] * (sin_x * (h * -3.0)) + f[2]
+                * (sin_x * (h3 * -24.0)) + f[3] * (sin_x * (h5 * -19.5)) + f[4]
+                * (sin_x * (h7 * -3.0));
+        s(5, 3, 0) += alpha * t_5_3_0;
+        const std::complex<double> t_5_3_1 = f[1] * (cos_x * (h * 3.0)) + f[2]
+                * (cos_x * (h3 * 24.0)) + f[3] * (cos_x * (h5 * 19.5)) + f[4]
+                * (cos_x * (3.0 * h7));
+        s(5, 3, 1) += alpha * t_5_3_1;
+        s(2, 0, 0) += alpha * std::conj(t_1_0_0);
+        s(2, 0, 1) += alpha * std::conj(t_1_0_1);
+        s(2, 0, 2) += alpha * std::conj(t_1_0_2);
+        s(2, 3, 2) += alpha * std::conj(t_1_3_2);
+        s(4, 0, 0) += alpha * std::conj(t_3_0_0);
+        s(4, 0, 1) += alpha * std::conj(t_3_0_1);
+        s(4, 0, 2) += alpha * std::conj(t_3_0_2);
+        s(4, 2, 2) += alpha * std::conj(t_5_2_2);
+        s(4, 3, 0) += alpha * std::conj(t_3_3_0);
+        s(4, 3, 1) += alpha * std::conj(t_3_3_1);
+    }
+
+// Limit case (h==0): s += alpha * s_ij_lim_h(nu, eix, d)
+
+    void s_ij_lim_h_contr
+            (double nu, std::complex<double> eix,
+             std::complex<double> d,
+             double alpha,
+             il::io_t, il::StaticArray3D<std::complex<double>, 6, 4, 3> &s) {
+        // 30 non-zero coefficients (of 72); 38 common sub-expressions
+        const double sin_x = std::imag(eix);
+        const double d_1 = std::abs(d);
+        const double g_0 = sin_x / d_1;
+        const double g_1 = nu * 2.0;
+        const double g_2 = (1.0 + g_1) * 0.5;
+        s(0, 0, 2) += alpha * (g_0 * g_2);
+        const double c_1_m2nu = 1.0 - g_1;
+        const std::complex<double> e = std::polar(1.0, std::arg(d));
+        const std::complex<double> e_2 = e * e;
+        const double cos_x = std::real(eix);
+        const std::complex<double> g_3 = eix * (2.0 * il::ii);
+        const std::complex<double> g_4 = e_2 * 0.5 / d_1 * (sin_x - cos_x
+                * (cos_x * g_3));
+        s(0, 1, 2) += alpha * (c_1_m2nu * g_4);
+        const double g_5 = (2.0 - nu) * 0.25;
+        const double g_6 = g_0 * g_5;
+        const double g_7 = nu * 0.5;
+        const std::complex<double> g_8 = g_4 * g_7;
+        s(0, 2, 0) += alpha * (g_6 + g_8);
+        s(0, 2, 1) += alpha * (il::ii * (g_6 - g_8));
+        s(0, 3, 2) += alpha * g_0;
+        const double h0_lim = std::atanh(sin_x);
+        const std::complex<double> g_9 = h0_lim * e;
+        s(1, 0, 2) += alpha * (g_9 * g_2);
+        const std::complex<double> e2x = eix * eix;
+        const std::complex<double> g_10 = e * e_2 * -0.125 * (h0_lim * 4.0
+                + eix * il::ii * (e2x + 8.0));
+        s(1, 1, 2) += alpha * (c_1_m2nu * g_10);
+        const std::complex<double> g_11 = g_9 * g_5;
+        const std::complex<double> g_12 = g_10 * g_7;
+        s(1, 2, 0) += alpha * (g_11 + g_12);
+        s(1, 2, 1) += alpha * (il::ii * (g_11 - g_12));
+        s(1, 3, 2) += alpha * g_9;
+        const std::complex<double> g_13 = std::conj(g_9);
+        s(2, 0, 2) += alpha * (g_13 * g_2);
+        const std::complex<double> g_14 = e * 0.125 * (h0_lim * 12.0 + eix
+                * (il::ii * 5.0));
+        s(2, 1, 2) += alpha * (c_1_m2nu * g_14);
+        const std::complex<double> g_15 = g_13 * g_5;
+        const std::complex<double> g_16 = g_14 * g_7;
+        s(2, 2, 0) += alpha * (g_15 + g_16);
+        s(2, 2, 1) += alpha * (il::ii * (g_15 - g_16));
+        s(2, 3, 2) += alpha * g_13;
+        const std::complex<double> g_17 = h0_lim + g_3;
+        const std::complex<double> g_18 = d * e * g_17;
+        s(3, 0, 2) += alpha * (g_18 * g_2);
+        const std::complex<double> g_19 = d_1 * (e_2 * e_2 * -0.5) * (h0_lim
+                * 3.0 - g_3 * (e2x - 3.0));
+        s(3, 1, 2) += alpha * (c_1_m2nu * g_19);
+        const std::complex<double> g_20 = g_18 * g_5;
+        const std::complex<double> g_21 = g_19 * g_7;
+        s(3, 2, 0) += alpha * (g_20 + g_21);
+        s(3, 2, 1) += alpha * (il::ii * (g_20 - g_21));
+        s(3, 3, 2) += alpha * g_18;
+        const std::complex<double> g_22 = std::conj(g_18);
+        s(4, 0, 2) += alpha * (g_22 * g_2);
+        const double g_23 = h0_lim * (d_1 * -1.5);
+        s(4, 1, 2) += alpha * (c_1_m2nu * g_23);
+        const std::complex<double> g_24 = g_22 * g_5;
+        const double g_25 = g_23 * g_7;
+        s(4, 2, 0) += alpha * (g_24 + g_25);
+        s(4, 2, 1) += alpha * (il::ii * (g_24 - g_25));
+        s(4, 3, 2) += alpha * g_22;
+        const double g_26 = d_1 * -h0_lim;
+        s(5, 0, 2) += alpha * (g_26 * g_2);
+        const std::complex<double> g_27 = g_17 * (d_1 * (e_2 * 1.5));
+        s(5, 1, 2) += alpha * (c_1_m2nu * g_27);
+        const double g_28 = g_26 * g_5;
+        const std::complex<double> g_29 = g_27 * g_7;
+        s(5, 2, 0) += alpha * (g_28 + g_29);
+        s(5, 2, 1) += alpha * (il::ii * (g_28 - g_29));
+        s(5, 3, 2) += alpha * g_26;
+    }
+
+// Real-arithmetic versions: s_re + I * s_im += ... (see above)
+// for the independent real quantities only (see h_potential.h)
+
+    void s_ij_gen_h_contr_r
+            (double nu, std::complex<double> eix,
+             double h, std::complex<double> d,
+             const il::StaticArray<double, 9> &f, double alpha,
+             il::io_t, il::StaticArray3D<double, 6, 4, 3> &s_re,
+             il::StaticArray3D<double, 6, 4, 3> &s_im) {
+        // 108 real quantities; 1215 common sub-expressions
+        const double d_sin_p = std::imag(d);
+        const double g_0 = h * d_sin_p;
+        const double g_1 = h * 0.1875;
+        const double h2 = h * h;
+        const double g_2 = 3.0 * h2;
+        const double d_cos_p = std::real(d);
+        const double g_3 = std::imag(eix);
+        const double cos_x = std::real(eix);
+        const double tan_x = g_3 / cos_x;
+        const double d_1 = std::abs(d);
+        const double d_2 = d_1 * d_1;
+        const double g_4 = tan_x * d_2;
+        const std::complex<double> e = std::polar(1.0, std::arg(d));
+        const double cos_p = std::real(e);
+        const double g_5 = nu * 2.0;
+        const double c_7_2nu = g_5 + 7.0;
+        const double g_6 = h * c_7_2nu;
+        const double c_d_3h = d_2 + g_2;
+        const double g_7 = h * 3.0;
+        const double g_8 = c_d_3h * g_7;
+        const double c_d_h = h2 + d_2;
+        const double c_d_m3h = d_2 - g_2;
+        const double g_9 = c_d_h * (c_d_m3h * (h * -0.5));
+        s_re(0, 0, 0) += alpha * (f[2] * g_0 + f[3] * (-g_1 * (d_sin_p * g_2
+                + d_cos_p * g_4)) + f[6] * (cos_p * g_6) + f[7] * (cos_p * g_8)
+                + f[8] * (cos_p * g_9));
+        const double g_10 = -h;
+        const double sin_p = std::imag(e);
+        s_re(0, 0, 1) += alpha * (f[2] * (d_cos_p * g_10) + f[3] * (g_1
+                * (d_cos_p * g_2 - d_sin_p * g_4)) + f[6] * (sin_p * g_6)
+                + f[7] * (sin_p * g_8) + f[8] * (sin_p * g_9));
+        const double c_1_2nu = 1.0 + g_5;
+        const double g_11 = h2 * -2.0;
+        s_re(0, 0, 2) += alpha * (f[6] * (d_1 * -c_1_2nu) + f[7] * (d_1
+                * g_11));
+        const double g_12 = -d_sin_p;
+        const double g_13 = h * g_12;
+        const double g_14 = cos_p * cos_p - sin_p * sin_p;
+        const double g_15 = cos_x * cos_x;
+        const double g_16 = 0.5 + 0.75 * g_15;
+        const double g_17 = cos_p * sin_p;
+        const double g_18 = g_17 + g_17;
+        const double g_19 = cos_x * g_3;
+        const double g_20 = 0.75 * g_19;
+        const double g_21 = g_14 * g_16 - g_18 * g_20;
+        const double g_22 = -0.5 + g_21;
+        const double g_23 = h * d_cos_p;
+        const double g_24 = g_14 * g_20 + g_18 * g_16;
+        const double g_25 = g_23 * g_24;
+        const double g_26 = d_2 * 0.09375;
+        const double g_27 = tan_x * g_26;
+        const double g_28 = tan_x * 0.28125;
+        const double g_29 = d_2 * g_28;
+        const double g_30 = h2 * (0.375 * g_19);
+        const double g_31 = g_29 - -g_30;
+        const double g_32 = 0.0 / cos_x;
+        const double g_33 = 0.28125 * g_32;
+        const double g_34 = h2 * (0.28125 + 0.375 * g_15);
+        const double g_35 = d_2 * (-0.75 + g_33) - g_34;
+        const double g_36 = -g_27 + (g_14 * g_31 - g_18 * g_35);
+        const double g_37 = h2 * 0.28125;
+        const double g_38 = g_26 * g_32;
+        const double g_39 = g_37 - g_38 + (g_14 * g_35 + g_18 * g_31);
+        const double g_40 = cos_p * 0.5;
+        const double g_41 = h * g_40;
+        const double g_42 = nu * 4.0;
+        const double c_9_m4nu = 9.0 - g_42;
+        const double g_43 = 3.0 * g_14;
+        const double g_44 = c_9_m4nu + -g_43;
+        const double g_45 = sin_p * 0.5;
+        const double g_46 = h * g_45;
+        const double g_47 = 3.0 * g_18;
+        const double g_48 = -g_47;
+        const double g_49 = h * 1.5;
+        const double g_50 = cos_p * g_49;
+        const double g_51 = 3.0 * d_2;
+        const double c_3d_h = h2 + g_51;
+        const double g_52 = c_3d_h * g_14;
+        const double g_53 = c_d_3h - g_52;
+        const double g_54 = sin_p * g_49;
+        const double g_55 = c_3d_h * g_18;
+        const double g_56 = -g_55;
+        const double g_57 = h * 0.25;
+        const double g_58 = c_d_h * (cos_p * g_57);
+        const double g_59 = -g_58;
+        const double g_60 = 5.0 * d_2;
+        const double g_61 = h2 + g_60;
+        const double g_62 = g_61 * g_14;
+        const double g_63 = c_d_m3h + g_62;
+        const double g_64 = -(c_d_h * (sin_p * g_57));
+        const double g_65 = g_61 * g_18;
+        const double g_66 = g_64 * g_65;
+        s_re(0, 1, 0) += alpha * (f[2] * (g_13 * g_22 - g_25) + f[3] * (g_23
+                * g_36 - g_0 * g_39) + f[6] * (g_41 * g_44 - g_46 * g_48)
+                + f[7] * (g_50 * g_53 - g_54 * g_56) + f[8] * (g_59 * g_63
+                - g_66));
+        s_im(0, 1, 0) += alpha * (f[2] * (g_13 * g_24 + g_23 * g_22) + f[3]
+                * (g_23 * g_39 + g_0 * g_36) + f[6] * (g_41 * g_48 + g_46
+                * g_44) + f[7] * (g_50 * g_56 + g_54 * g_53) + f[8] * (g_59
+                * g_65 + g_64 * g_63));
+        const double g_67 = 0.5 + g_21;
+        const double g_68 = -d_cos_p;
+        const double g_69 = h * g_68;
+        const double g_70 = -g_33;
+        const double g_71 = g_34 + d_2 * (0.75 + g_70);
+        const double g_72 = g_29 + g_30;
+        const double g_73 = g_37 + -g_38 + (g_14 * g_71 - g_18 * g_72);
+        const double g_74 = g_27 + (g_14 * g_72 + g_18 * g_71);
+        const double g_75 = -g_46;
+        const double g_76 = c_9_m4nu + g_43;
+        const double g_77 = -g_54;
+        const double g_78 = c_d_3h + g_52;
+        const double g_79 = -c_d_m3h;
+        const double g_80 = g_79 + g_62;
+        s_re(0, 1, 1) += alpha * (f[2] * (g_23 * g_67 - g_0 * g_24) + f[3]
+                * (g_69 * g_73 - g_13 * g_74) + f[6] * (g_75 * g_76 - g_41
+                * g_47) + f[7] * (g_77 * g_78 - g_50 * g_55) + f[8] * (g_64
+                * g_80 - g_58 * g_65));
+        s_im(0, 1, 1) += alpha * (f[2] * (g_25 + g_0 * g_67) + f[3] * (g_69
+                * g_74 + g_13 * g_73) + f[6] * (g_47 * g_75 + g_41 * g_76)
+                + f[7] * (g_55 * g_77 + g_50 * g_78) + f[8] * (g_66 + g_58
+                * g_80));
+        const double c_1_m2nu = 1.0 - g_5;
+        const double g_81 = c_1_m2nu * -1.0;
+        const double g_82 = -(g_18 * g_81);
+        const double g_83 = g_14 * g_81;
+        const double g_84 = h2 * g_18;
+        const double g_85 = -g_84;
+        const double g_86 = h2 * g_14;
+        const double g_87 = g_19 * g_86;
+        const double g_88 = -c_1_m2nu;
+        const double g_89 = cos_p * g_88;
+        const double g_90 = sin_p * g_88;
+        const double g_91 = cos_p * g_11;
+        const double g_92 = sin_p * g_11;
+        s_re(0, 1, 2) += alpha * (f[1] * (g_15 * g_82 - g_19 * g_83) + f[2]
+                * (g_15 * g_85 - g_87) + f[6] * (d_cos_p * g_89 - d_sin_p
+                * g_90) + f[7] * (d_cos_p * g_91 - d_sin_p * g_92));
+        const double g_93 = g_15 * g_86;
+        s_im(0, 1, 2) += alpha * (f[1] * (g_15 * g_83 + g_19 * g_82) + f[2]
+                * (g_93 + g_19 * g_85) + f[6] * (d_cos_p * g_90 + d_sin_p
+                * g_89) + f[7] * (d_cos_p * g_92 + d_sin_p * g_91));
+        const double g_94 = nu * -0.5;
+        const double g_95 = g_94 * g_18;
+        const double g_96 = g_94 * g_14;
+        const double g_97 = g_15 * g_95 + g_19 * g_96;
+        const double g_98 = 0.5 * g_18;
+        const double g_99 = h2 * g_98;
+        const double g_100 = 0.5 * g_14;
+        const double g_101 = h2 * g_100;
+        const double g_102 = g_15 * g_99 + g_19 * g_101;
+        const double c_2_mnu = 2.0 - nu;
+        const double g_103 = nu * d_cos_p;
+        const double g_104 = nu * d_sin_p;
+        const double g_105 = cos_p * g_103 - sin_p * g_104;
+        const double g_106 = -h2;
+        const double g_107 = d_1 * g_106;
+        s_re(0, 2, 0) += alpha * (f[1] * -g_97 + f[2] * -g_102 + f[6] * (-0.5
+                * (c_2_mnu * d_1 + g_105)) + f[7] * (g_107 * (1.0 + g_14)));
+        const double g_108 = g_15 * g_96 - g_19 * g_95;
+        const double g_109 = g_15 * g_101 - g_19 * g_99;
+        const double g_110 = cos_p * g_104 + sin_p * g_103;
+        s_im(0, 2, 0) += alpha * (f[1] * g_108 + f[2] * g_109 + f[6] * (-0.5
+                * g_110) + f[7] * (g_107 * g_18));
+        const double g_111 = h2 * d_1;
+        s_re(0, 2, 1) += alpha * (f[1] * g_108 + f[2] * g_109 + f[6] * -(0.5
+                * g_110) + f[7] * -(g_111 * g_18));
+        s_im(0, 2, 1) += alpha * (f[1] * g_97 + f[2] * g_102 + f[6] * (0.5
+                * (d_1 * -c_2_mnu + g_105)) + f[7] * (g_111 * (g_14 - 1.0)));
+        const double h3 = h * h2;
+        const double g_112 = h3 * -2.0;
+        s_re(0, 2, 2) += alpha * (f[6] * (h * -cos_p) + f[7] * (cos_p * g_112));
+        const double g_113 = -sin_p;
+        s_im(0, 2, 2) += alpha * (f[6] * (h * g_113) + f[7] * (sin_p * g_112));
+        const double g_114 = h * -2.0;
+        const double g_115 = h3 * -4.0;
+        s_re(0, 3, 0) += alpha * (f[6] * (cos_p * g_114) + f[7] * (cos_p
+                * g_115));
+        s_re(0, 3, 1) += alpha * (f[6] * (sin_p * g_114) + f[7] * (sin_p
+                * g_115));
+        const double g_116 = 4.0 * h2;
+        s_re(0, 3, 2) += alpha * (f[6] * (d_1 * -2.0) + f[7] * (d_1 * g_116));
+        const double g_117 = nu * 5.0;
+        const double g_118 = h * ((g_117 + 11.0) * 0.2);
+        const double g_119 = g_118 * g_18;
+        const double g_120 = g_118 * g_14;
+        const double g_121 = g_15 * g_119 + g_19 * g_120;
+        const double g_122 = d_2 * ((7.0 + g_117) / 60.0);
+        const double g_123 = d_2 * (0.0 / 60.0);
+        const double g_124 = tan_x * g_122 - g_32 * g_123;
+        const double g_125 = h2 * 16.0;
+        const double g_126 = d_2 * (2.0 * tan_x) + g_125 * g_19;
+        const double g_127 = 0.1 * g_126;
+        const double g_128 = d_2 * (7.0 + -(2.0 * g_32)) + g_125 * g_15;
+        const double g_129 = 0.1 * g_128;
+        const double g_130 = g_14 * g_127 + g_18 * g_129;
+        const double g_131 = h2 * 0.11875;
+        const double g_132 = d_2 * -0.05625 + g_131;
+        const double g_133 = d_2 * g_132;
+        const double g_134 = tan_x * g_133;
+        const double d_4 = d_2 * d_2;
+        const double g_135 = d_4 * 0.09375;
+        const double g_136 = tan_x * g_135;
+        const double d2h2 = h2 * d_2;
+        const double g_137 = tan_x * 0.11875;
+        const double g_138 = d2h2 * g_137;
+        const double h4 = h2 * h2;
+        const double g_139 = h4 * 0.4;
+        const double g_140 = g_139 * g_19;
+        const double g_141 = g_136 + g_138 + g_140;
+        const double g_142 = 0.11875 * g_32;
+        const double g_143 = -g_142;
+        const double g_144 = d2h2 * (0.4 + g_143);
+        const double g_145 = g_135 * g_32;
+        const double g_146 = g_139 * g_15;
+        const double g_147 = g_144 + -g_145 + g_146;
+        const double g_148 = g_14 * g_141 + g_18 * g_147;
+        const double sgh = (h < 0) ? -1.0 : double(h > 0);
+        const double c_1_nu = nu + 1.0;
+        const double c_2_nu = nu + 2.0;
+        const double g_149 = d_1 * (0.3 + c_2_nu * (4.0 / 3.0));
+        const double g_150 = c_7_2nu * 0.5;
+        const double g_151 = d_cos_p * g_150;
+        const double g_152 = d_sin_p * g_150;
+        const double g_153 = cos_p * g_151 - sin_p * g_152;
+        const double g_154 = d_2 * (c_1_2nu * (1.0 / 6.0));
+        const double g_155 = d_1 * (g_154 + h2 * (43.0 / 30.0 + c_2_nu / 3.0));
+        const double g_156 = d_cos_p * 1.5;
+        const double g_157 = d_sin_p * 1.5;
+        const double g_158 = cos_p * g_156 - sin_p * g_157;
+        const double g_159 = c_d_3h * g_158;
+        const double g_160 = h * c_d_h;
+        const double g_161 = -g_160;
+        const double g_162 = d_2 * (d_1 * 0.15) - h2 * (d_1 * (1.9 / 6.0));
+        const double g_163 = d_cos_p * 0.25;
+        const double g_164 = d_sin_p * 0.25;
+        const double g_165 = cos_p * g_163 - sin_p * g_164;
+        const double g_166 = c_d_m3h * g_165;
+        s_re(1, 0, 0) += alpha * (f[1] * -g_121 + f[2] * (h * -(g_124
+                + -g_130)) + f[3] * (h * (g_134 + -g_148)) + f[4] * (sgh
+                * -c_1_nu) + f[6] * (h * (g_149 + g_153)) + f[7] * (h * (g_155
+                + g_159)) + f[8] * (g_161 * (g_162 + g_166)));
+        const double g_167 = g_15 * g_120 - g_19 * g_119;
+        const double g_168 = tan_x * g_123 + g_122 * g_32;
+        const double g_169 = g_14 * g_129 - g_18 * g_127;
+        const double g_170 = g_133 * g_32;
+        const double g_171 = g_14 * g_147 - g_18 * g_141;
+        const double g_172 = cos_p * g_152 + sin_p * g_151;
+        const double g_173 = d_1 * (c_2_nu * (0.0 / 3.0));
+        const double g_174 = cos_p * g_157 + sin_p * g_156;
+        const double g_175 = c_d_3h * g_174;
+        const double g_176 = d_1 * (d_2 * (c_1_2nu * (0.0 / 6.0)) + h2 * (0.0
+                / 3.0 + 0.0 / 30.0));
+        const double g_177 = h2 * (d_1 * (0.0 / 6.0));
+        const double g_178 = -g_177;
+        const double g_179 = cos_p * g_164 + sin_p * g_163;
+        const double g_180 = c_d_m3h * g_179;
+        s_im(1, 0, 0) += alpha * (f[1] * g_167 + f[2] * (h * -(g_168 + g_169))
+                + f[3] * (h * (g_170 + g_171)) + f[6] * (h * (g_172 + g_173))
+                + f[7] * (h * (g_175 + g_176)) + f[8] * (g_161 * (g_178
+                + g_180)));
+        s_re(1, 0, 1) += alpha * (f[1] * g_167 + f[2] * (h * -(g_169 + -g_168))
+                + f[3] * (h * (g_171 + -g_170)) + f[6] * (h * -(g_173
+                + -g_172)) + f[7] * (h * -(g_176 + -g_175)) + f[8] * -(g_160
+                * (g_180 + -g_178)));
+        s_im(1, 0, 1) += alpha * (f[1] * g_121 + f[2] * (h * -(g_124 + g_130))
+                + f[3] * (h * (g_134 + g_148)) + f[4] * (sgh * (c_1_nu * -1.0))
+                + f[6] * (h * (g_149 + -g_153)) + f[7] * (h * (g_155 + -g_159))
+                + f[8] * (g_160 * (-g_162 + g_166)));
+        const double g_181 = c_1_2nu * 0.5;
+        const double g_182 = 2.0 * c_2_nu;
+        const double g_183 = h2 * g_182;
+        const double g_184 = 2.0 * h4;
+        s_re(1, 0, 2) += alpha * (f[5] * (cos_p * g_181) + f[6] * (cos_p
+                * g_183) + f[7] * (cos_p * g_184));
+        s_im(1, 0, 2) += alpha * (f[5] * (sin_p * g_181) + f[6] * (sin_p
+                * g_183) + f[7] * (sin_p * g_184));
+        const double g_185 = h * (0.4 * g_18);
+        const double g_186 = h * (0.4 * g_14);
+        const double g_187 = g_15 * g_185 + g_19 * g_186;
+        const double g_188 = -g_187;
+        const double c_8_m5nu = 8.0 - g_117;
+        const double g_189 = 8.0 * g_14;
+        const double g_190 = -1.0 + g_15;
+        const double g_191 = 8.0 * g_18;
+        const double g_192 = g_189 * g_190 - g_19 * g_191;
+        const double g_193 = c_8_m5nu + g_192;
+        const double g_194 = g_15 * g_186 - g_19 * g_185;
+        const double g_195 = g_19 * g_189 + g_191 * g_190;
+        const double g_196 = g_194 * g_195;
+        const double g_197 = h * g_14;
+        const double g_198 = d_2 * (tan_x * 0.2);
+        const double g_199 = h2 * 1.6;
+        const double g_200 = g_199 * g_19;
+        const double g_201 = 2.0 * g_14;
+        const double g_202 = g_15 - 1.0;
+        const double g_203 = g_15 * g_19 + g_19 * g_202;
+        const double g_204 = h2 * 0.8;
+        const double g_205 = tan_x * 0.1;
+        const double g_206 = 0.4 * g_19;
+        const double g_207 = -g_206;
+        const double g_208 = -(g_203 * g_204) + d_2 * (g_205 - g_207);
+        const double g_209 = 2.0 * g_18;
+        const double g_210 = g_15 * g_202 - g_19 * g_19;
+        const double g_211 = 0.1 * g_32;
+        const double g_212 = 0.4 * g_15;
+        const double g_213 = g_210 * g_204 + d_2 * (g_211 - (0.7 + g_212));
+        const double g_214 = g_198 - -g_200 - (g_201 * g_208 - g_209 * g_213);
+        const double g_215 = h * g_18;
+        const double g_216 = 0.2 * g_32;
+        const double g_217 = g_199 * g_15;
+        const double g_218 = d_2 * (-0.7 + g_216) - g_217 - (g_201 * g_213
+                + g_209 * g_208);
+        const double g_219 = 3.0 * d_4;
+        const double g_220 = tan_x * 0.18125;
+        const double g_221 = g_219 * g_220;
+        const double g_222 = g_139 * g_203;
+        const double g_223 = -g_222;
+        const double g_224 = d2h2 * (g_137 - g_207);
+        const double g_225 = g_221 + g_223 + g_224;
+        const double g_226 = 0.18125 * g_32;
+        const double g_227 = g_139 * g_210;
+        const double g_228 = 2.0 + g_15;
+        const double g_229 = 0.4 * g_228;
+        const double g_230 = d2h2 * (g_142 - g_229);
+        const double g_231 = g_219 * (-0.4 + g_226) + g_227 + g_230;
+        const double g_232 = d2h2 * -g_137 - g_136 + -g_140 + (g_14 * g_225
+                - g_18 * g_231);
+        const double g_233 = g_146 + (d2h2 * (0.4 - g_142) - g_145) + (g_14
+                * g_231 + g_18 * g_225);
+        const double g_234 = d_cos_p * cos_p - d_sin_p * sin_p;
+        const double g_235 = h * g_234;
+        const double g_236 = -g_235;
+        const double g_237 = 4.5 * g_14;
+        const double g_238 = c_9_m4nu * 0.5;
+        const double g_239 = g_237 - g_238;
+        const double g_240 = d_cos_p * sin_p + d_sin_p * cos_p;
+        const double g_241 = h * g_240;
+        const double g_242 = -g_241;
+        const double g_243 = 4.5 * g_18;
+        const double g_244 = g_242 * g_243;
+        const double g_245 = h2 * 4.5;
+        const double g_246 = d_2 * 1.5 + g_245;
+        const double g_247 = g_245 + d_2 * 7.5;
+        const double g_248 = g_247 * g_14;
+        const double g_249 = g_246 - g_248;
+        const double g_250 = g_247 * g_18;
+        const double g_251 = -g_250;
+        const double g_252 = c_d_h * (0.25 * g_235);
+        const double g_253 = -g_252;
+        const double g_254 = 7.0 * d_2;
+        const double g_255 = g_2 + g_254;
+        const double g_256 = g_255 * g_14;
+        const double g_257 = c_d_m3h + g_256;
+        const double g_258 = -(c_d_h * (0.25 * g_241));
+        const double g_259 = g_255 * g_18;
+        const double g_260 = g_258 * g_259;
+        s_re(1, 1, 0) += alpha * (f[1] * (g_188 * g_193 - g_196) + f[2]
+                * (g_197 * g_214 - g_215 * g_218) + f[3] * (g_197 * g_232
+                - g_215 * g_233) + f[6] * (g_236 * g_239 - g_244) + f[7]
+                * (g_235 * g_249 - g_241 * g_251) + f[8] * (g_253 * g_257
+                - g_260));
+        s_im(1, 1, 0) += alpha * (f[1] * (g_188 * g_195 + g_194 * g_193) + f[2]
+                * (g_197 * g_218 + g_215 * g_214) + f[3] * (g_197 * g_233
+                + g_215 * g_232) + f[6] * (g_236 * g_243 + g_242 * g_239)
+                + f[7] * (g_235 * g_251 + g_241 * g_249) + f[8] * (g_253
+                * g_259 + g_258 * g_257));
+        const double g_261 = -c_8_m5nu + g_192;
+        const double g_262 = h2 * -0.8;
+        const double g_263 = g_262 * g_210 + d_2 * (g_212 + (0.7 + -g_211));
+        const double g_264 = g_262 * g_203 + d_2 * (g_205 + g_206);
+        const double g_265 = g_217 + d_2 * (0.7 + -g_216) + (g_201 * g_263
+                - g_209 * g_264);
+        const double g_266 = g_198 + g_200 + (g_201 * g_264 + g_209 * g_263);
+        const double g_267 = -g_197;
+        const double g_268 = 0.4 + -g_226;
+        const double g_269 = g_219 * g_268 - g_227 + d2h2 * (g_143 + g_229);
+        const double g_270 = g_221 - g_222 + d2h2 * (g_137 + g_206);
+        const double g_271 = g_147 + (g_14 * g_269 - g_18 * g_270);
+        const double g_272 = -g_215;
+        const double g_273 = g_141 + (g_14 * g_270 + g_18 * g_269);
+        const double g_274 = g_238 + g_237;
+        const double g_275 = g_246 + g_248;
+        const double g_276 = g_79 + g_256;
+        s_re(1, 1, 1) += alpha * (f[1] * (g_194 * g_261 - g_187 * g_195) + f[2]
+                * (g_197 * g_265 - g_215 * g_266) + f[3] * (g_267 * g_271
+                - g_272 * g_273) + f[6] * (g_242 * g_274 - g_235 * g_243)
+                + f[7] * (g_242 * g_275 - g_235 * g_250) + f[8] * (g_258
+                * g_276 - g_252 * g_259));
+        s_im(1, 1, 1) += alpha * (f[1] * (g_196 + g_187 * g_261) + f[2]
+                * (g_197 * g_266 + g_215 * g_265) + f[3] * (g_267 * g_273
+                + g_272 * g_271) + f[6] * (g_244 + g_235 * g_274) + f[7]
+                * (g_242 * g_250 + g_235 * g_275) + f[8] * (g_260 + g_252
+                * g_276));
+        const double g_277 = -(d_sin_p * g_81);
+        const double g_278 = d_cos_p * g_81;
+        const double g_279 = g_14 * g_277 - g_18 * g_278;
+        const double g_280 = 0.625 + g_15;
+        const double g_281 = g_14 * g_278 + g_18 * g_277;
+        const double g_282 = d_cos_p * g_14 - d_sin_p * g_18;
+        const double g_283 = c_1_m2nu * -d_2;
+        const double g_284 = nu * 0.125;
+        const double g_285 = 4.0 * g_19;
+        const double g_286 = g_283 * (tan_x * 0.1875) + -(h2 * (1.75 * g_19
+                - g_284 * g_285));
+        const double g_287 = d_cos_p * g_18 + d_sin_p * g_14;
+        const double g_288 = 4.0 * g_15;
+        const double g_289 = 3.0 + g_288;
+        const double g_290 = g_283 * (-0.5 + 0.1875 * g_32) + h2 * (1.1875
+                + 1.75 * g_15 - g_284 * g_289);
+        const double g_291 = -(-1.0 * d_sin_p);
+        const double g_292 = -1.0 * d_cos_p;
+        const double g_293 = h2 * (g_14 * g_291 - g_18 * g_292);
+        const double g_294 = h2 * 0.1875;
+        const double g_295 = d_2 * (1.5 + -(0.5625 * g_32)) + g_294 * g_289;
+        const double g_296 = h2 * (g_14 * g_292 + g_18 * g_291);
+        const double g_297 = d_2 * (tan_x * 0.5625) + g_294 * g_285;
+        const double g_298 = c_1_m2nu * -0.5;
+        const double g_299 = cos_p * g_14 - sin_p * g_18;
+        const double g_300 = 2.0 * c_2_mnu;
+        const double g_301 = h2 * g_300 + d_2 * (3.0 * c_1_m2nu);
+        const double g_302 = -g_299;
+        const double g_303 = 5.0 * d_4;
+        const double c_7_m2nu = 7.0 - g_5;
+        const double g_304 = 6.0 * d2h2;
+        const double c_13_m2nu = 13.0 - g_5;
+        const double g_305 = c_1_m2nu * g_303 + c_7_m2nu * g_304 + c_13_m2nu
+                * h4;
+        const double g_306 = -0.25 * g_299;
+        const double g_307 = -0.5 * g_299;
+        s_re(1, 1, 2) += alpha * (f[1] * (g_279 * g_280 - g_19 * g_281) + f[2]
+                * (g_282 * g_286 - g_287 * g_290) + f[3] * (g_293 * g_295
+                - g_296 * g_297) + f[5] * (g_298 * g_299) + f[6] * (g_301
+                * g_302) + f[7] * (g_305 * g_306) + f[8] * (g_61 * (c_d_h * (h2
+                * g_307))));
+        const double g_308 = cos_p * g_18 + sin_p * g_14;
+        const double g_309 = -g_308;
+        const double g_310 = -0.25 * g_308;
+        const double g_311 = -0.5 * g_308;
+        s_im(1, 1, 2) += alpha * (f[1] * (g_19 * g_279 + g_281 * g_280) + f[2]
+                * (g_282 * g_290 + g_287 * g_286) + f[3] * (g_293 * g_297
+                + g_296 * g_295) + f[5] * (g_298 * g_308) + f[6] * (g_301
+                * g_309) + f[7] * (g_305 * g_310) + f[8] * (g_61 * (c_d_h * (h2
+                * g_311))));
+        const double g_312 = 5.0 + 8.0 * g_15;
+        const double g_313 = d_sin_p * -0.0625;
+        const double g_314 = d_cos_p * -0.0625;
+        const double g_315 = nu * (g_14 * g_313 + g_18 * g_314);
+        const double g_316 = 8.0 * g_19;
+        const double g_317 = nu * (g_14 * g_314 - g_18 * g_313);
+        const double g_318 = g_312 * g_315 + g_316 * g_317;
+        const double g_319 = nu * 0.03125;
+        const double g_320 = d_2 * g_319;
+        const double g_321 = 3.0 * tan_x;
+        const double c_6_nu = nu + 6.0;
+        const double g_322 = c_6_nu * 0.125;
+        const double g_323 = g_320 * g_321 + h2 * (g_322 * g_19);
+        const double g_324 = 8.0 + -(3.0 * g_32);
+        const double g_325 = g_320 * g_324 + h2 * (0.5 + nu * 0.09375 + g_322
+                * g_15);
+        const double g_326 = g_282 * g_323 + g_287 * g_325;
+        const double g_327 = d_cos_p * -0.09375;
+        const double g_328 = d_sin_p * -0.09375;
+        const double g_329 = h2 * (g_14 * g_327 - g_18 * g_328);
+        const double g_330 = d_2 * g_321;
+        const double g_331 = g_330 + h2 * g_285;
+        const double g_332 = h2 * (g_14 * g_328 + g_18 * g_327);
+        const double g_333 = d_2 * g_324;
+        const double g_334 = g_333 + h2 * g_289;
+        const double g_335 = g_329 * g_331 + g_332 * g_334;
+        const double g_336 = cos_p * 0.25;
+        const double g_337 = nu * g_14;
+        const double g_338 = c_2_mnu - g_337;
+        const double g_339 = sin_p * 0.25;
+        const double g_340 = nu * g_18;
+        const double g_341 = -g_340;
+        const double c_5_mnu = 5.0 - nu;
+        const double g_342 = c_5_mnu * h2;
+        const double g_343 = nu * 3.0;
+        const double c_3_nu = nu + 3.0;
+        const double g_344 = d_2 * g_343 + c_3_nu * h2;
+        const double g_345 = g_344 * g_14;
+        const double g_346 = g_342 - g_345;
+        const double g_347 = g_344 * g_18;
+        const double g_348 = -g_347;
+        const double c_12_nu = nu + 12.0;
+        const double g_349 = d_4 * (nu * 0.625) + d2h2 * (c_6_nu * 0.75) + h4
+                * (c_12_nu * 0.125);
+        const double g_350 = g_349 * g_14;
+        const double g_351 = h4 - g_350;
+        const double g_352 = g_349 * g_18;
+        const double g_353 = -g_352;
+        const double g_354 = g_61 * (c_d_h * (h2 * g_306));
+        s_re(1, 2, 0) += alpha * (f[1] * -g_318 + f[2] * -g_326 + f[3] * -g_335
+                + f[5] * (g_336 * g_338 - g_339 * g_341) + f[6] * (g_40 * g_346
+                - g_45 * g_348) + f[7] * (cos_p * g_351 - sin_p * g_353) + f[8]
+                * g_354);
+        const double g_355 = g_312 * g_317 - g_316 * g_315;
+        const double g_356 = g_282 * g_325 - g_287 * g_323;
+        const double g_357 = g_329 * g_334 - g_332 * g_331;
+        const double g_358 = g_61 * (c_d_h * (h2 * g_310));
+        s_im(1, 2, 0) += alpha * (f[1] * g_355 + f[2] * g_356 + f[3] * g_357
+                + f[5] * (g_336 * g_341 + g_339 * g_338) + f[6] * (g_40 * g_348
+                + g_45 * g_346) + f[7] * (cos_p * g_353 + sin_p * g_351) + f[8]
+                * g_358);
+        const double g_359 = -g_339;
+        const double g_360 = c_2_mnu + g_337;
+        const double g_361 = -g_45;
+        const double g_362 = g_342 + g_345;
+        const double g_363 = h4 + g_350;
+        s_re(1, 2, 1) += alpha * (f[1] * g_355 + f[2] * g_356 + f[3] * g_357
+                + f[5] * (g_359 * g_360 - g_336 * g_340) + f[6] * (g_361
+                * g_362 - g_40 * g_347) + f[7] * (g_113 * g_363 - cos_p
+                * g_352) + f[8] * -(-1.0 * g_358));
+        s_im(1, 2, 1) += alpha * (f[1] * g_318 + f[2] * g_326 + f[3] * g_335
+                + f[5] * (g_340 * g_359 + g_336 * g_360) + f[6] * (g_347
+                * g_361 + g_40 * g_362) + f[7] * (g_113 * g_352 + cos_p
+                * g_363) + f[8] * (-1.0 * g_354));
+        const double g_364 = -(-1.0 * g_18);
+        const double g_365 = h * g_364;
+        const double g_366 = -1.0 * g_14;
+        const double g_367 = h * g_366;
+        const double g_368 = -g_18;
+        const double g_369 = h3 * g_368;
+        const double g_370 = h3 * g_14;
+        const double g_371 = cos_p * g_68 - sin_p * g_12;
+        const double g_372 = d_cos_p * -2.0;
+        const double g_373 = d_sin_p * -2.0;
+        s_re(1, 2, 2) += alpha * (f[1] * (g_15 * g_365 - g_19 * g_367) + f[2]
+                * (g_15 * g_369 - g_19 * g_370) + f[6] * (h * g_371) + f[7]
+                * (h3 * (cos_p * g_372 - sin_p * g_373)));
+        const double g_374 = cos_p * g_12 + sin_p * g_68;
+        s_im(1, 2, 2) += alpha * (f[1] * (g_15 * g_367 + g_19 * g_365) + f[2]
+                * (g_15 * g_370 + g_19 * g_369) + f[6] * (h * g_374) + f[7]
+                * (h3 * (cos_p * g_373 + sin_p * g_372)));
+        const double g_375 = h * g_368;
+        const double g_376 = -g_14;
+        const double g_377 = h * g_376;
+        const double g_378 = g_15 * g_375 + g_19 * g_377;
+        const double g_379 = d_2 * (tan_x * (1.0 / 12.0) - g_32 * (0.0 / 12.0));
+        const double g_380 = g_87 + g_15 * g_84;
+        const double g_381 = h3 * (d_2 * -0.25);
+        const double g_382 = tan_x * g_381;
+        const double g_383 = d_1 * (10.0 / 3.0);
+        const double g_384 = h * d_1;
+        const double g_385 = d_2 + 11.0 * h2;
+        const double g_386 = g_385 / 3.0;
+        const double g_387 = h2 * g_201;
+        const double g_388 = c_d_h * (d_1 * (h3 * (-2.0 / 3.0)));
+        s_re(1, 3, 0) += alpha * (f[1] * -g_378 + f[2] * (h * (g_379 + -g_380))
+                + f[3] * g_382 + f[6] * (h * (g_371 - g_383)) + f[7] * (g_384
+                * -(g_386 + g_387)) + f[8] * g_388);
+        const double g_389 = g_15 * g_377 - g_19 * g_375;
+        const double g_390 = d_2 * (tan_x * (0.0 / 12.0) + 1.0 / 12.0 * g_32);
+        const double g_391 = g_93 - g_19 * g_84;
+        const double g_392 = g_381 * g_32;
+        const double g_393 = d_1 * (0.0 / 3.0);
+        const double g_394 = h2 * g_209;
+        const double g_395 = c_d_h * (d_1 * (h3 * (0.0 / 3.0)));
+        s_im(1, 3, 0) += alpha * (f[1] * g_389 + f[2] * (h * (g_390 + g_391))
+                + f[3] * g_392 + f[6] * (h * (g_374 - g_393)) + f[7] * (g_384
+                * -(0.0 / 3.0 + g_394)) + f[8] * g_395);
+        s_re(1, 3, 1) += alpha * (f[1] * g_389 + f[2] * (h * (g_391 + -g_390))
+                + f[3] * -g_392 + f[6] * (h * -(g_240 - g_393)) + f[7] * (g_384
+                * -(-1.0 * (0.0 / 3.0 - g_394))) + f[8] * -g_395);
+        s_im(1, 3, 1) += alpha * (f[1] * g_378 + f[2] * (h * (g_379 + g_380))
+                + f[3] * g_382 + f[6] * (h * (g_234 - g_383)) + f[7] * (g_384
+                * (-1.0 * (g_386 - g_387))) + f[8] * g_388);
+        const double g_396 = h2 * -4.0;
+        const double g_397 = h4 * -4.0;
+        s_re(1, 3, 2) += alpha * (f[5] * cos_p + f[6] * (cos_p * g_396) + f[7]
+                * (cos_p * g_397));
+        s_im(1, 3, 2) += alpha * (f[5] * sin_p + f[6] * (sin_p * g_396) + f[7]
+                * (sin_p * g_397));
+        const double g_398 = h * 3.2;
+        const double g_399 = g_398 * g_18;
+        const double g_400 = -g_399;
+        const double g_401 = g_398 * g_14;
+        const double g_402 = g_19 * g_401;
+        const double g_403 = h * -1.0;
+        const double g_404 = 0.1 * g_18;
+        const double g_405 = 0.1 * g_14;
+        const double g_406 = g_128 * g_404 + g_126 * g_405;
+        const double g_407 = d_2 * ((6.0 - g_117) / 30.0);
+        const double g_408 = d_2 * (0.0 / 30.0);
+        const double g_409 = tan_x * g_407 + g_32 * g_408;
+        const double g_410 = g_4 * g_132;
+        const double g_411 = g_131 + g_26;
+        const double g_412 = h2 * 0.4;
+        const double g_413 = g_4 * g_411 - -(g_412 * (h2 * g_19));
+        const double g_414 = d_2 * g_32;
+        const double g_415 = g_411 * g_414 - g_412 * (d_2 + h2 * g_15);
+        const double g_416 = g_14 * g_413 - g_18 * g_415;
+        const double c_1_mnu = 1.0 - nu;
+        const double g_417 = sgh * (c_1_mnu * -2.0);
+        const double g_418 = g_384 * (4.3 - nu * (8.0 / 3.0));
+        const double g_419 = d_cos_p * 4.5;
+        const double g_420 = d_sin_p * 4.5;
+        const double g_421 = h * (cos_p * g_419 - sin_p * g_420);
+        const double c_3_m4nu = 3.0 - g_42;
+        const double g_422 = h2 * (g_300 + 3.3) + d_2 * (c_3_m4nu * 0.5);
+        const double g_423 = h * (d_1 * (1.0 / 3.0)) * g_422;
+        const double g_424 = c_d_3h * (h * g_158);
+        const double g_425 = c_d_h * g_384;
+        const double g_426 = -g_425;
+        const double g_427 = h2 * (0.95 / 3.0);
+        const double g_428 = d_2 * 0.15 - g_427;
+        const double g_429 = 0.25 * g_14;
+        const double g_430 = c_d_m3h * g_429;
+        s_re(2, 1, 0) += alpha * (f[1] * (g_15 * g_400 - g_402) + f[2]
+                * -(g_403 * (g_406 - g_409)) + f[3] * (h * (g_410 - g_416))
+                + f[4] * g_417 + f[6] * (g_418 + g_421) + f[7] * (g_423
+                + g_424) + f[8] * (g_426 * (g_428 + g_430)));
+        const double g_431 = g_15 * g_401;
+        const double g_432 = g_128 * g_405 - g_126 * g_404;
+        const double g_433 = tan_x * g_408 - g_32 * g_407;
+        const double g_434 = g_132 * g_414;
+        const double g_435 = g_14 * g_415 + g_18 * g_413;
+        const double g_436 = h * (cos_p * g_420 + sin_p * g_419);
+        const double g_437 = nu * (0.0 / 3.0);
+        const double g_438 = -g_437;
+        const double g_439 = g_384 * g_438;
+        const double g_440 = c_d_3h * (h * g_174);
+        const double g_441 = h * g_393;
+        const double g_442 = g_422 * g_441;
+        const double g_443 = h2 * (0.0 / 3.0);
+        const double g_444 = -g_443;
+        const double g_445 = 0.25 * g_18;
+        const double g_446 = c_d_m3h * g_445;
+        s_im(2, 1, 0) += alpha * (f[1] * (g_431 + g_19 * g_400) + f[2] * (g_403
+                * (g_432 - g_433)) + f[3] * (h * (g_434 - g_435)) + f[6]
+                * (g_436 + g_439) + f[7] * (g_440 + g_442) + f[8] * (g_426
+                * (g_444 + g_446)));
+        s_re(2, 1, 1) += alpha * (f[1] * (g_431 - g_19 * g_399) + f[2] * (g_10
+                * (g_432 + g_433)) + f[3] * -(h * (g_434 + g_435)) + f[6]
+                * -(g_439 + -g_436) + f[7] * -(g_442 + -g_440) + f[8] * -(g_425
+                * (g_446 + -g_444)));
+        s_im(2, 1, 1) += alpha * (f[1] * (g_402 + g_15 * g_399) + f[2] * (g_10
+                * (g_406 + g_409)) + f[3] * (h * (g_410 + g_416)) + f[4]
+                * g_417 + f[6] * (g_418 + -g_421) + f[7] * (g_423 + -g_424)
+                + f[8] * (g_425 * (-g_428 + g_430)));
+        const double g_447 = c_1_m2nu * 0.625;
+        const double g_448 = c_1_m2nu * 0.0625;
+        const double g_449 = d_2 * g_448;
+        const double g_450 = tan_x * g_449;
+        const double g_451 = g_449 * g_32 - h2 * (1.1875 - nu * 0.375);
+        const double g_452 = d_2 * -0.1875;
+        const double g_453 = tan_x * g_452;
+        const double g_454 = h2 * d_cos_p;
+        const double g_455 = h2 * d_sin_p;
+        const double g_456 = g_452 * g_32 + h2 * 0.5625;
+        const double g_457 = c_1_m2nu * 1.5;
+        const double g_458 = c_1_m2nu * d_2;
+        const double g_459 = h2 * (6.0 * c_2_mnu) + g_458;
+        const double g_460 = g_2 * c_d_3h - c_d_h * (c_d_m3h * (c_1_m2nu
+                * 0.25));
+        const double g_461 = cos_p * -0.5;
+        s_re(2, 1, 2) += alpha * (f[1] * -(d_sin_p * g_447) + f[2] * (d_cos_p
+                * g_450 - d_sin_p * g_451) + f[3] * (g_453 * g_454 - g_455
+                * g_456) + f[5] * (cos_p * g_457) + f[6] * (cos_p * g_459)
+                + f[7] * (cos_p * g_460) + f[8] * (c_d_h * (c_d_m3h * (h2
+                * g_461))));
+        const double g_462 = sin_p * -0.5;
+        s_im(2, 1, 2) += alpha * (f[1] * (d_cos_p * g_447) + f[2] * (d_cos_p
+                * g_451 + d_sin_p * g_450) + f[3] * (g_454 * g_456 + g_453
+                * g_455) + f[5] * (sin_p * g_457) + f[6] * (sin_p * g_459)
+                + f[7] * (sin_p * g_460) + f[8] * (c_d_h * (c_d_m3h * (h2
+                * g_462))));
+        const double g_463 = nu * 0.3125;
+        const double g_464 = d_sin_p * g_463;
+        const double g_465 = d_cos_p * -0.03125;
+        const double g_466 = nu * d_2;
+        const double g_467 = tan_x * g_466;
+        const double g_468 = d_sin_p * -0.03125;
+        const double g_469 = h2 * (g_343 + 16) + -(g_466 * g_32);
+        const double g_470 = g_465 * g_467 + g_468 * g_469;
+        const double g_471 = h2 * (d_cos_p * 0.09375);
+        const double g_472 = h2 * (d_sin_p * 0.09375);
+        const double g_473 = -g_414;
+        const double g_474 = g_2 + g_473;
+        const double g_475 = g_4 * g_471 + g_472 * g_474;
+        const double g_476 = cos_p * g_343;
+        const double g_477 = c_2_mnu * cos_p;
+        const double g_478 = h2 * (3.0 * c_3_nu);
+        const double g_479 = g_466 + g_478;
+        const double g_480 = cos_p * g_479;
+        const double g_481 = cos_p * g_342;
+        const double g_482 = nu * d_4;
+        const double g_483 = d2h2 * (2.0 * c_6_nu);
+        const double g_484 = h4 * (3.0 * c_12_nu);
+        const double g_485 = 0.125 * (g_482 - g_483 - g_484);
+        const double g_486 = -g_485;
+        const double g_487 = h4 * cos_p;
+        const double g_488 = c_d_h * (c_d_m3h * (h2 * (cos_p * -0.25)));
+        s_re(2, 2, 0) += alpha * (f[1] * -g_464 + f[2] * -g_470 + f[3] * -g_475
+                + f[5] * (0.25 * (g_476 + g_477)) + f[6] * (0.5 * (g_480
+                + g_481)) + f[7] * (cos_p * g_486 + g_487) + f[8] * g_488);
+        const double g_489 = d_cos_p * g_463;
+        const double g_490 = g_465 * g_469 - g_468 * g_467;
+        const double g_491 = g_471 * g_474 - g_4 * g_472;
+        const double g_492 = sin_p * g_343;
+        const double g_493 = c_2_mnu * g_113;
+        const double g_494 = sin_p * g_479;
+        const double g_495 = g_342 * g_113;
+        const double g_496 = h4 * g_113;
+        const double g_497 = c_d_h * (c_d_m3h * (h2 * (sin_p * -0.25)));
+        s_im(2, 2, 0) += alpha * (f[1] * g_489 + f[2] * g_490 + f[3] * g_491
+                + f[5] * (0.25 * (g_492 + g_493)) + f[6] * (0.5 * (g_494
+                + g_495)) + f[7] * (sin_p * g_486 + g_496) + f[8] * g_497);
+        s_re(2, 2, 1) += alpha * (f[1] * g_489 + f[2] * g_490 + f[3] * g_491
+                + f[5] * -(-0.25 * (g_492 - g_493)) + f[6] * -(-0.5 * (g_494
+                - g_495)) + f[7] * -(g_496 + sin_p * g_485) + f[8] * -(-1.0
+                * g_497));
+        s_im(2, 2, 1) += alpha * (f[1] * g_464 + f[2] * g_470 + f[3] * g_475
+                + f[5] * (-0.25 * (g_476 - g_477)) + f[6] * (-0.5 * (g_480
+                - g_481)) + f[7] * (g_487 + cos_p * g_485) + f[8] * (-1.0
+                * g_488));
+        const double g_498 = h * (d_2 / 12.0);
+        const double g_499 = h * (0.0 / 12.0);
+        const double g_500 = -d_1;
+        s_re(2, 2, 2) += alpha * (f[2] * (tan_x * g_498 - g_32 * g_499) + f[3]
+                * g_382 + f[6] * (h * (d_1 * (-10.0 / 3.0))) + f[7] * (h
+                * g_500 * g_385 / 3.0) + f[8] * (c_d_h * (h3 * (d_1 * (-2.0
+                / 3.0)))));
+        s_im(2, 2, 2) += alpha * (f[2] * (tan_x * g_499 + g_498 * g_32) + f[3]
+                * g_392 + f[6] * g_441 + f[7] * (0.0 / 3.0) + f[8] * (c_d_h
+                * (h3 * g_393)));
+        const double g_501 = -(-1.0 * g_0);
+        const double c_13_10nu = 13.0 + nu * 10.0;
+        const double g_502 = c_13_10nu * 0.0625;
+        const double c_3_2nu = g_5 + 3.0;
+        const double g_503 = c_3_2nu * 0.5;
+        const double g_504 = g_502 + g_503 * g_15;
+        const double g_505 = g_503 * g_19;
+        const double g_506 = g_14 * g_504 - g_18 * g_505;
+        const double g_507 = g_502 - g_506;
+        const double g_508 = -1.0 * g_23;
+        const double g_509 = g_14 * g_505 + g_18 * g_504;
+        const double g_510 = -g_509;
+        const double g_511 = d_2 * (c_3_2nu * 0.03125);
+        const double g_512 = -(tan_x * g_511);
+        const double g_513 = c_3_2nu * 0.09375;
+        const double g_514 = tan_x * g_513;
+        const double g_515 = nu * 6.0;
+        const double c_7_6nu = 7.0 + g_515;
+        const double g_516 = (nu + 4.0) * 0.25;
+        const double g_517 = h2 * (g_516 * g_19);
+        const double g_518 = d_2 * (g_514 + c_7_6nu * -(0.0 / 12.0)) - -g_517;
+        const double g_519 = g_513 * g_32;
+        const double g_520 = c_7_2nu * 0.09375;
+        const double g_521 = h2 * (g_520 + g_516 * g_15);
+        const double g_522 = d_2 * (c_7_6nu * (-1.0 / 12.0) + g_519) - g_521;
+        const double g_523 = g_512 + (g_14 * g_518 - g_18 * g_522);
+        const double g_524 = g_511 * g_32;
+        const double g_525 = h2 * g_520 - g_524 + (g_14 * g_522 + g_18 * g_518);
+        const double g_526 = 0.28125 * g_14;
+        const double g_527 = 0.109375 * g_14;
+        const double g_528 = h2 * (0.09375 - g_526) - d_2 * (0.046875 + g_527);
+        const double g_529 = 0.28125 * g_18;
+        const double g_530 = d_2 * (0.109375 * g_18);
+        const double g_531 = h2 * -g_529 - g_530;
+        const double g_532 = 0.3125 * g_19;
+        const double g_533 = 0.234375 + 0.3125 * g_15;
+        const double g_534 = h2 * (d_2 * (0.625 * g_18) + (g_86 * g_532 + g_84
+                * g_533));
+        const double g_535 = g_4 * g_528 - g_414 * g_531 + -g_534;
+        const double g_536 = d_2 * (0.625 * g_14);
+        const double g_537 = h2 * 0.234375;
+        const double g_538 = g_86 * g_533 - g_84 * g_532;
+        const double g_539 = g_4 * g_531 + g_414 * g_528 + h2 * (g_536 - g_537
+                + g_538);
+        const double g_540 = h * c_3_2nu;
+        const double g_541 = cos_p * g_540;
+        const double g_542 = g_429 - 0.75;
+        const double g_543 = sin_p * g_540;
+        const double g_544 = h * cos_p;
+        const double c_5_4nu = 5.0 + g_42;
+        const double c_11_4nu = g_42 + 11.0;
+        const double g_545 = d_2 * (c_5_4nu * 0.75) + h2 * (c_11_4nu * 0.25);
+        const double g_546 = g_545 * g_14;
+        const double g_547 = d_2 * (c_5_4nu * 0.25) + h2 * (c_11_4nu * 0.75);
+        const double g_548 = g_546 - g_547;
+        const double g_549 = h * sin_p;
+        const double g_550 = g_545 * g_18;
+        const double c_13_2nu = g_5 + 13.0;
+        const double g_551 = d_4 * (c_1_2nu * 0.125) - h2 * (d_2 * (c_7_2nu
+                * 0.25)) - h4 * (c_13_2nu * 0.375);
+        const double g_552 = d_4 * (c_1_2nu * 0.625) + h2 * (d_2 * (c_7_2nu
+                * 0.75)) + h4 * (c_13_2nu * 0.125);
+        const double g_553 = g_552 * g_14;
+        const double g_554 = g_551 + g_553;
+        const double g_555 = g_552 * g_18;
+        const double g_556 = c_d_h * g_544;
+        const double g_557 = -g_556;
+        const double g_558 = d_2 * 0.25;
+        const double g_559 = d_4 * 0.125 - h2 * g_558 + h4 * 0.625;
+        const double g_560 = d_4 * (7.0 / 24.0) - h2 * (d_2 * (11.0 / 12.0))
+                - h4 * (5.0 / 24.0);
+        const double g_561 = d_4 * (0.0 / 24.0) - h2 * (d_2 * (0.0 / 12.0))
+                - h4 * (0.0 / 24.0);
+        const double g_562 = g_560 * g_14 - g_18 * g_561;
+        const double g_563 = g_559 + g_562;
+        const double g_564 = -(c_d_h * g_549);
+        const double g_565 = g_14 * g_561 + g_560 * g_18;
+        const double g_566 = g_564 * g_565;
+        s_re(3, 0, 0) += alpha * (f[1] * (g_501 * g_507 - g_508 * g_510) + f[2]
+                * (g_23 * g_523 - g_0 * g_525) + f[3] * (g_23 * g_535 - g_0
+                * g_539) + f[5] * (g_541 * g_542 - g_445 * g_543) + f[6]
+                * (g_544 * g_548 - g_549 * g_550) + f[7] * (g_544 * g_554
+                - g_549 * g_555) + f[8] * (g_557 * g_563 - g_566));
+        s_im(3, 0, 0) += alpha * (f[1] * (g_501 * g_510 + g_508 * g_507) + f[2]
+                * (g_23 * g_525 + g_0 * g_523) + f[3] * (g_23 * g_539 + g_0
+                * g_535) + f[5] * (g_445 * g_541 + g_543 * g_542) + f[6]
+                * (g_544 * g_550 + g_549 * g_548) + f[7] * (g_544 * g_555
+                + g_549 * g_554) + f[8] * (g_557 * g_565 + g_564 * g_563));
+        const double g_567 = g_502 + g_506;
+        const double g_568 = g_521 + d_2 * (c_7_6nu * (1.0 / 12.0) + -g_519);
+        const double g_569 = g_517 + d_2 * (g_514 + c_7_6nu * (0.0 / 12.0));
+        const double g_570 = h2 * (c_7_2nu * -0.09375) - -g_524 - (g_14 * g_568
+                - g_18 * g_569);
+        const double g_571 = g_512 - (g_14 * g_569 + g_18 * g_568);
+        const double g_572 = h2 * (0.09375 + g_526) + d_2 * (-0.046875 + g_527);
+        const double g_573 = g_530 + h2 * g_529;
+        const double g_574 = g_473 * g_572 - g_4 * g_573 + h2 * (g_538 + (g_537
+                + g_536));
+        const double g_575 = g_534 + (g_473 * g_573 + g_4 * g_572);
+        const double g_576 = h * (c_3_2nu * -1.0);
+        const double g_577 = -(sin_p * g_576);
+        const double g_578 = 0.75 + g_429;
+        const double g_579 = cos_p * g_576;
+        const double g_580 = -(sin_p * g_403);
+        const double g_581 = g_547 + g_546;
+        const double g_582 = cos_p * g_403;
+        const double g_583 = -g_549;
+        const double g_584 = g_551 - g_553;
+        const double g_585 = -g_555;
+        const double g_586 = g_562 - g_559;
+        s_re(3, 0, 1) += alpha * (f[1] * (g_23 * g_567 - g_0 * g_509) + f[2]
+                * (g_23 * g_570 - g_0 * g_571) + f[3] * (g_23 * g_574 - g_0
+                * g_575) + f[5] * (g_577 * g_578 - g_445 * g_579) + f[6]
+                * (g_580 * g_581 - g_550 * g_582) + f[7] * (g_583 * g_584
+                - g_544 * g_585) + f[8] * (g_564 * g_586 - g_556 * g_565));
+        s_im(3, 0, 1) += alpha * (f[1] * (g_23 * g_509 + g_0 * g_567) + f[2]
+                * (g_23 * g_571 + g_0 * g_570) + f[3] * (g_23 * g_575 + g_0
+                * g_574) + f[5] * (g_445 * g_577 + g_579 * g_578) + f[6]
+                * (g_550 * g_580 + g_582 * g_581) + f[7] * (g_583 * g_585
+                + g_544 * g_584) + f[8] * (g_566 + g_556 * g_586));
+        const double g_587 = -(c_1_2nu * g_18);
+        const double g_588 = c_1_2nu * g_14;
+        const double g_589 = h2 * -(g_182 * g_18);
+        const double g_590 = h2 * (g_182 * g_14);
+        const double g_591 = h4 * g_364;
+        const double g_592 = h4 * g_366;
+        const double g_593 = d_cos_p * g_181;
+        const double g_594 = d_sin_p * g_181;
+        const double g_595 = d_cos_p * g_183;
+        const double g_596 = d_sin_p * g_183;
+        const double g_597 = d_cos_p * g_184;
+        const double g_598 = d_sin_p * g_184;
+        s_re(3, 0, 2) += alpha * (f[0] * (g_15 * g_587 - g_19 * g_588) + f[1]
+                * (g_15 * g_589 - g_19 * g_590) + f[2] * (g_15 * g_591 - g_19
+                * g_592) + f[5] * (cos_p * g_593 - sin_p * g_594) + f[6]
+                * (cos_p * g_595 - sin_p * g_596) + f[7] * (cos_p * g_597
+                - sin_p * g_598));
+        s_im(3, 0, 2) += alpha * (f[0] * (g_15 * g_588 + g_19 * g_587) + f[1]
+                * (g_15 * g_590 + g_19 * g_589) + f[2] * (g_15 * g_592 + g_19
+                * g_591) + f[5] * (cos_p * g_594 + sin_p * g_593) + f[6]
+                * (cos_p * g_596 + sin_p * g_595) + f[7] * (cos_p * g_598
+                + sin_p * g_597));
+        const double g_599 = h * g_287;
+        const double g_600 = -(-1.0 * g_599);
+        const double g_601 = 13.0 + (g_15 - g_3 * g_3) - 10.0 * g_15;
+        const double g_602 = g_19 + g_19 - 10.0 * g_19;
+        const double g_603 = g_15 * g_601 - g_19 * g_602;
+        const double g_604 = 1.4625 + 0.375 * g_603;
+        const double g_605 = g_15 * g_602 + g_19 * g_601;
+        const double g_606 = 0.375 * g_605;
+        const double g_607 = g_14 * g_604 - g_18 * g_606;
+        const double c_5_m4nu = 5.0 - g_42;
+        const double g_608 = c_5_m4nu * 0.5;
+        const double g_609 = 1.25 * (c_1_mnu + 0.15) + g_608 * g_15;
+        const double g_610 = g_607 - g_609;
+        const double g_611 = h * g_282;
+        const double g_612 = -1.0 * g_611;
+        const double g_613 = g_14 * g_606 + g_18 * g_604;
+        const double g_614 = g_608 * g_19;
+        const double g_615 = g_613 - g_614;
+        const double g_616 = -g_599;
+        const double g_617 = tan_x * 0.025;
+        const double g_618 = 0.78125 + 0.025 * g_32;
+        const double g_619 = d_2 * (g_15 + (3.275 + (tan_x * g_617 - g_32
+                * g_618))) + h2 * (0.86875 + 0.1875 * g_603);
+        const double g_620 = d_2 * (g_19 + (tan_x * g_618 + g_617 * g_32)) + h2
+                * (0.1875 * g_605);
+        const double g_621 = g_14 * g_619 - g_18 * g_620;
+        const double g_622 = c_5_m4nu * 0.09375;
+        const double g_623 = d_2 * (c_1_mnu + 0.25 / 3.0 + -(g_32 * g_622));
+        const double c_5_m2nu = 5.0 - g_5;
+        const double g_624 = c_5_m2nu * 0.0625;
+        const double g_625 = h2 * (g_624 * g_289 - 0.09375);
+        const double g_626 = g_621 - g_623 - g_625;
+        const double g_627 = g_14 * g_620 + g_18 * g_619;
+        const double g_628 = d_2 * (0.0 / 3.0 + tan_x * g_622);
+        const double g_629 = h2 * (g_624 * g_285);
+        const double g_630 = g_627 - g_628 - g_629;
+        const double g_631 = d2h2 * -g_28;
+        const double g_632 = d_4 * 0.109375;
+        const double g_633 = tan_x * g_632;
+        const double g_634 = h4 * 0.078125;
+        const double g_635 = g_634 * g_285;
+        const double g_636 = -g_635;
+        const double g_637 = d_4 * (tan_x * 1.015625);
+        const double g_638 = h4 * (0.046875 * g_605);
+        const double g_639 = tan_x * 0.46875;
+        const double g_640 = 0.125 * g_285;
+        const double g_641 = g_637 - -g_638 + d2h2 * (g_639 - -g_640);
+        const double g_642 = 1.015625 * g_32;
+        const double g_643 = h4 * (0.234375 + 0.046875 * g_603);
+        const double g_644 = 0.46875 * g_32;
+        const double g_645 = 0.125 * (15.0 + g_288);
+        const double g_646 = d_4 * (-2.0 + g_642) - g_643 + d2h2 * (g_644
+                - g_645);
+        const double g_647 = g_631 - g_633 + g_636 + (g_14 * g_641 - g_18
+                * g_646);
+        const double g_648 = d2h2 * (0.625 - g_33);
+        const double g_649 = g_632 * g_32;
+        const double g_650 = g_634 * g_289;
+        const double g_651 = g_648 - g_649 + g_650 + (g_14 * g_646 + g_18
+                * g_641);
+        const double g_652 = g_57 * g_299;
+        const double g_653 = c_5_m4nu + -3.0 * g_14;
+        const double g_654 = g_57 * g_308;
+        const double g_655 = -3.0 * g_18;
+        const double g_656 = nu * 8.0;
+        const double c_9_m8nu = 9.0 - g_656;
+        const double c_15_m8nu = 15.0 - g_656;
+        const double g_657 = c_9_m8nu * g_51 + c_15_m8nu * h2;
+        const double g_658 = g_61 * (9.0 * g_14);
+        const double g_659 = g_657 - g_658;
+        const double g_660 = g_61 * (9.0 * g_18);
+        const double g_661 = -g_660;
+        const double g_662 = 0.5 * g_652;
+        const double c_15_m4nu = 15.0 - g_42;
+        const double g_663 = c_3_m4nu * g_303 + c_9_m4nu * g_304 + c_15_m4nu
+                * h4;
+        const double g_664 = d_4 * 35.0 + d2h2 * 30.0 + 3.0 * h4;
+        const double g_665 = g_664 * g_43;
+        const double g_666 = g_663 - g_665;
+        const double g_667 = 0.5 * g_654;
+        const double g_668 = g_664 * g_47;
+        const double g_669 = -g_668;
+        const double g_670 = c_d_h * g_662;
+        const double g_671 = 5.0 * h4;
+        const double g_672 = d_4 * -7.0 + d2h2 * 22.0 + g_671;
+        const double g_673 = g_672 / 3.0;
+        const double g_674 = d2h2 * 14.0;
+        const double g_675 = h4 + (d_4 * 21.0 + g_674);
+        const double g_676 = g_675 * g_14;
+        const double g_677 = g_673 - g_676;
+        const double g_678 = c_d_h * g_667;
+        const double g_679 = g_675 * g_18;
+        const double g_680 = 0.0 / 3.0 - g_679;
+        s_re(3, 1, 0) += alpha * (f[1] * (g_600 * g_610 - g_612 * g_615) + f[2]
+                * (g_616 * g_626 - g_611 * g_630) + f[3] * (g_611 * g_647
+                - g_599 * g_651) + f[5] * (g_652 * g_653 - g_654 * g_655)
+                + f[6] * (g_652 * g_659 - g_654 * g_661) + f[7] * (g_662
+                * g_666 - g_667 * g_669) + f[8] * (g_670 * g_677 - g_678
+                * g_680));
+        s_im(3, 1, 0) += alpha * (f[1] * (g_600 * g_615 + g_612 * g_610) + f[2]
+                * (g_616 * g_630 + g_611 * g_626) + f[3] * (g_611 * g_651
+                + g_599 * g_647) + f[5] * (g_652 * g_655 + g_654 * g_653)
+                + f[6] * (g_652 * g_661 + g_654 * g_659) + f[7] * (g_662
+                * g_669 + g_667 * g_666) + f[8] * (g_670 * g_680 + g_678
+                * g_677));
+        const double g_681 = -g_611;
+        const double g_682 = g_607 + g_609;
+        const double g_683 = g_613 + g_614;
+        const double g_684 = g_625 + (g_621 + g_623);
+        const double g_685 = g_629 + (g_627 + g_628);
+        const double g_686 = d2h2 * (0.625 + g_70);
+        const double g_687 = -g_649;
+        const double g_688 = -g_644;
+        const double g_689 = g_643 + d_4 * (2.0 + -g_642) + d2h2 * (g_645
+                + g_688);
+        const double g_690 = g_637 + g_638 + d2h2 * (g_639 + g_640);
+        const double g_691 = g_650 + (g_686 + g_687) + (g_14 * g_689 - g_18
+                * g_690);
+        const double g_692 = d2h2 * g_28;
+        const double g_693 = g_635 + (g_633 + g_692) + (g_14 * g_690 + g_18
+                * g_689);
+        const double g_694 = -g_654;
+        const double g_695 = c_5_m4nu + g_43;
+        const double g_696 = g_657 + g_658;
+        const double g_697 = -g_667;
+        const double g_698 = g_663 + g_665;
+        const double g_699 = -g_678;
+        const double g_700 = g_673 + g_676;
+        const double g_701 = 0.0 / 3.0 + g_679;
+        s_re(3, 1, 1) += alpha * (f[1] * (g_681 * g_682 - g_616 * g_683) + f[2]
+                * (g_611 * g_684 - g_599 * g_685) + f[3] * (g_681 * g_691
+                - g_616 * g_693) + f[5] * (g_694 * g_695 - g_47 * g_652) + f[6]
+                * (g_694 * g_696 - g_652 * g_660) + f[7] * (g_697 * g_698
+                - g_662 * g_668) + f[8] * (g_699 * g_700 - g_670 * g_701));
+        s_im(3, 1, 1) += alpha * (f[1] * (g_681 * g_683 + g_616 * g_682) + f[2]
+                * (g_611 * g_685 + g_599 * g_684) + f[3] * (g_681 * g_693
+                + g_616 * g_691) + f[5] * (g_47 * g_694 + g_652 * g_695) + f[6]
+                * (g_660 * g_694 + g_652 * g_696) + f[7] * (g_668 * g_697
+                + g_662 * g_698) + f[8] * (g_699 * g_701 + g_670 * g_700));
+        const double g_702 = g_14 * g_14 - g_18 * g_18;
+        const double g_703 = g_14 * g_18;
+        const double g_704 = g_703 + g_703;
+        const double g_705 = c_1_m2nu * (g_702 * -(0.0 / 3.0) - 6.4 / 3.0
+                * g_704);
+        const double g_706 = c_1_m2nu * (6.4 / 3.0 * g_702 + g_704 * -(0.0
+                / 3.0));
+        const double g_707 = -g_704;
+        const double g_708 = c_2_mnu * (12.8 / 3.0);
+        const double g_709 = c_2_mnu * (0.0 / 3.0);
+        const double g_710 = c_1_m2nu / 3.0;
+        const double g_711 = 0.725 * g_32;
+        const double g_712 = 5.2 + -g_711 + 3.2 * g_15;
+        const double g_713 = tan_x * 0.725;
+        const double g_714 = g_713 + 3.2 * g_19;
+        const double g_715 = h2 * (g_708 * g_210 - g_203 * g_709) - d_2
+                * (g_710 * g_712 - 0.0 / 3.0 * g_714);
+        const double g_716 = h2 * (g_210 * g_709 + g_708 * g_203) - d_2
+                * (g_710 * g_714 + 0.0 / 3.0 * g_712);
+        const double g_717 = -d_4;
+        const double g_718 = c_1_m2nu * g_717;
+        const double g_719 = tan_x * 0.3625;
+        const double g_720 = h4 * -(0.0 / 3.0);
+        const double g_721 = c_13_m2nu * g_720;
+        const double g_722 = c_13_m2nu * (h4 * (0.8 / 3.0));
+        const double g_723 = d2h2 / 3.0;
+        const double g_724 = nu * 0.475;
+        const double c_115_m38nu_80 = 1.4375 - g_724;
+        const double g_725 = -c_115_m38nu_80;
+        const double g_726 = 2.0 * c_7_m2nu;
+        const double g_727 = tan_x * g_725 + -(0.4 * (g_726 * g_19));
+        const double c_3_mnu = 3.0 - nu;
+        const double g_728 = g_725 * g_32 + 0.4 * (1.0 + c_3_mnu * 8.0 + g_726
+                * g_15);
+        const double g_729 = g_718 * g_719 - (g_210 * g_721 - g_203 * g_722)
+                + (g_723 * g_727 - 0.0 / 3.0 * g_728);
+        const double g_730 = 0.3625 * g_32;
+        const double g_731 = -0.8 + g_730;
+        const double g_732 = g_718 * g_731 - (g_210 * g_722 + g_203 * g_721)
+                + (g_723 * g_728 + 0.0 / 3.0 * g_727);
+        const double g_733 = h2 * g_702;
+        const double g_734 = h4 * 0.8;
+        const double g_735 = tan_x * 0.2375;
+        const double g_736 = g_219 * g_719 + -(g_203 * g_734) + d2h2 * (g_735
+                - -(0.8 * g_19));
+        const double g_737 = h2 * g_704;
+        const double g_738 = 0.2375 * g_32;
+        const double g_739 = g_219 * g_731 + g_210 * g_734 + d2h2 * (g_738
+                - 0.8 * g_228);
+        const double g_740 = d_cos_p * -1.5;
+        const double g_741 = d_sin_p * -1.5;
+        const double g_742 = c_2_mnu * (6.0 * h2) + c_1_m2nu * g_60;
+        const double g_743 = g_68 * g_299 - g_12 * g_308;
+        const double g_744 = c_13_m2nu * (h4 * 0.75) + c_7_m2nu * (d2h2 * 2.5)
+                + c_1_m2nu * (d_4 * 1.75);
+        const double g_745 = h2 * 1.5;
+        const double g_746 = d_2 * 3.5;
+        const double g_747 = g_745 + g_746;
+        s_re(3, 1, 2) += alpha * (f[0] * (g_210 * g_705 - g_203 * g_706) + f[1]
+                * (g_707 * g_715 - g_702 * g_716) + f[2] * (g_702 * g_729
+                - g_704 * g_732) + f[3] * (g_733 * g_736 - g_737 * g_739)
+                + f[5] * (c_1_m2nu * (g_299 * g_740 - g_308 * g_741)) + f[6]
+                * (g_742 * g_743) + f[7] * (g_744 * g_743) + f[8] * (g_747
+                * (c_d_h * (h2 * g_743))));
+        const double g_748 = g_12 * g_299 + g_68 * g_308;
+        s_im(3, 1, 2) += alpha * (f[0] * (g_210 * g_706 + g_203 * g_705) + f[1]
+                * (g_707 * g_716 + g_702 * g_715) + f[2] * (g_702 * g_732
+                + g_704 * g_729) + f[3] * (g_733 * g_739 + g_737 * g_736)
+                + f[5] * (c_1_m2nu * (g_299 * g_741 + g_308 * g_740)) + f[6]
+                * (g_742 * g_748) + f[7] * (g_744 * g_748) + f[8] * (g_747
+                * (c_d_h * (h2 * g_748))));
+        const double g_749 = c_2_mnu * 0.5;
+        const double g_750 = g_749 * g_15;
+        const double g_751 = nu * (3.2 / 3.0);
+        const double g_752 = g_751 * g_14 - g_18 * g_437;
+        const double g_753 = g_14 * g_437 + g_751 * g_18;
+        const double g_754 = g_210 * g_752 - g_203 * g_753;
+        const double g_755 = g_750 + g_754;
+        const double g_756 = g_749 * g_19;
+        const double g_757 = g_210 * g_753 + g_203 * g_752;
+        const double g_758 = g_756 + g_757;
+        const double g_759 = c_5_mnu * 0.5;
+        const double g_760 = h2 * g_759;
+        const double g_761 = g_760 * g_15;
+        const double g_762 = h2 * (c_3_nu * (-3.2 / 3.0));
+        const double g_763 = h2 * (c_3_nu * (0.0 / 3.0));
+        const double g_764 = g_466 / 3.0;
+        const double g_765 = -g_730;
+        const double g_766 = 2.6 + g_765 + 1.6 * g_15;
+        const double g_767 = g_719 + 1.6 * g_19;
+        const double g_768 = g_762 * g_210 - g_203 * g_763 + (g_764 * g_766
+                - 0.0 / 3.0 * g_767);
+        const double g_769 = g_210 * g_763 + g_762 * g_203 + (g_764 * g_767
+                + 0.0 / 3.0 * g_766);
+        const double g_770 = g_14 * g_768 - g_18 * g_769;
+        const double g_771 = g_761 - g_770;
+        const double g_772 = g_760 * g_19;
+        const double g_773 = g_14 * g_769 + g_18 * g_768;
+        const double g_774 = g_772 - g_773;
+        const double g_775 = c_12_nu * (g_139 / 3.0);
+        const double g_776 = c_12_nu * (0.0 / 3.0);
+        const double g_777 = c_6_nu * (0.4 / 3.0);
+        const double g_778 = c_6_nu * (0.0 / 3.0);
+        const double g_779 = 0.2 + nu * (0.11875 / 3.0);
+        const double g_780 = g_482 * g_268 - (g_775 * g_210 - g_203 * g_776)
+                + d2h2 * (1.4 + nu * (0.8 / 3.0) + (g_777 * g_15 - g_19
+                * g_778) + (tan_x * g_438 - g_779 * g_32));
+        const double g_781 = g_220 * g_482 - (g_210 * g_776 + g_775 * g_203)
+                + d2h2 * (g_437 + (g_15 * g_778 + g_777 * g_19) + (tan_x
+                * g_779 + g_32 * g_438));
+        const double g_782 = g_14 * g_780 - g_18 * g_781;
+        const double g_783 = h4 * (0.5 * g_15);
+        const double g_784 = g_782 - g_783;
+        const double g_785 = g_14 * g_781 + g_18 * g_780;
+        const double g_786 = h4 * (0.5 * g_19);
+        const double g_787 = g_785 - g_786;
+        const double g_788 = tan_x * 0.54375;
+        const double g_789 = g_224 + (g_223 + d_4 * g_788);
+        const double g_790 = 0.54375 * g_32;
+        const double g_791 = g_230 + (g_227 + d_4 * (-1.2 + g_790));
+        const double g_792 = c_2_mnu * 0.25;
+        const double g_793 = d_cos_p * g_792;
+        const double g_794 = cos_p * g_793;
+        const double g_795 = d_sin_p * g_792;
+        const double g_796 = g_794 - sin_p * g_795;
+        const double g_797 = nu * 0.75;
+        const double g_798 = d_cos_p * g_797;
+        const double g_799 = d_sin_p * g_797;
+        const double g_800 = g_299 * g_798 - g_308 * g_799;
+        const double g_801 = d_cos_p * g_759;
+        const double g_802 = d_sin_p * g_759;
+        const double g_803 = h2 * (cos_p * g_801 - sin_p * g_802);
+        const double g_804 = g_478 + g_117 * d_2;
+        const double g_805 = d_cos_p * 0.5;
+        const double g_806 = d_sin_p * 0.5;
+        const double g_807 = g_804 * (g_299 * g_805 - g_308 * g_806);
+        const double g_808 = h4 * g_234;
+        const double g_809 = g_484 + (d_4 * (nu * 7.0) + d2h2 * (c_6_nu
+                * 10.0));
+        const double g_810 = d_cos_p * 0.125;
+        const double g_811 = d_sin_p * 0.125;
+        const double g_812 = g_809 * (g_299 * g_810 - g_308 * g_811);
+        const double g_813 = d_cos_p * -0.25;
+        const double g_814 = d_sin_p * -0.25;
+        const double g_815 = g_255 * (c_d_h * (h2 * (g_299 * g_813 - g_308
+                * g_814)));
+        s_re(3, 2, 0) += alpha * (f[0] * (g_368 * g_755 - g_14 * g_758) + f[1]
+                * (g_368 * g_771 - g_14 * g_774) + f[2] * (g_368 * g_784 - g_14
+                * g_787) + f[3] * (g_733 * g_789 - g_737 * g_791) + f[5]
+                * (g_796 - g_800) + f[6] * (g_803 - g_807) + f[7] * (g_808
+                - g_812) + f[8] * g_815);
+        const double g_816 = cos_p * g_795 + sin_p * g_793;
+        const double g_817 = g_299 * g_799 + g_308 * g_798;
+        const double g_818 = h2 * (cos_p * g_802 + sin_p * g_801);
+        const double g_819 = g_804 * (g_299 * g_806 + g_308 * g_805);
+        const double g_820 = h4 * g_240;
+        const double g_821 = g_809 * (g_299 * g_811 + g_308 * g_810);
+        const double g_822 = g_255 * (c_d_h * (h2 * (g_299 * g_814 + g_308
+                * g_813)));
+        s_im(3, 2, 0) += alpha * (f[0] * (g_368 * g_758 + g_14 * g_755) + f[1]
+                * (g_368 * g_774 + g_14 * g_771) + f[2] * (g_368 * g_787 + g_14
+                * g_784) + f[3] * (g_733 * g_791 + g_737 * g_789) + f[5]
+                * (g_816 - g_817) + f[6] * (g_818 - g_819) + f[7] * (g_820
+                - g_821) + f[8] * g_822);
+        const double g_823 = g_754 + -g_750;
+        const double g_824 = g_757 + -g_756;
+        const double g_825 = g_761 + g_770;
+        const double g_826 = g_772 + g_773;
+        const double g_827 = g_782 + g_783;
+        const double g_828 = g_785 + g_786;
+        const double g_829 = g_227 + d_4 * (-1.2 - -g_790) + d2h2 * (-(-0.11875
+                * g_32) - g_229);
+        const double g_830 = g_222 + d_4 * -g_788 + d2h2 * (tan_x * -0.11875
+                - g_206);
+        s_re(3, 2, 1) += alpha * (f[0] * (g_14 * g_823 - g_18 * g_824) + f[1]
+                * (g_376 * g_825 - g_368 * g_826) + f[2] * (g_14 * g_827 - g_18
+                * g_828) + f[3] * (g_733 * g_829 - g_737 * g_830) + f[5]
+                * -(g_816 + g_817) + f[6] * -(g_818 + g_819) + f[7] * -(g_820
+                + g_821) + f[8] * -(-1.0 * g_822));
+        s_im(3, 2, 1) += alpha * (f[0] * (g_14 * g_824 + g_18 * g_823) + f[1]
+                * (g_376 * g_826 + g_368 * g_825) + f[2] * (g_14 * g_828 + g_18
+                * g_827) + f[3] * (g_733 * g_830 + g_737 * g_829) + f[5]
+                * (g_796 + g_800) + f[6] * (g_803 + g_807) + f[7] * (g_808
+                + g_812) + f[8] * (-1.0 * g_815));
+        const double g_831 = -(d_sin_p * -0.125);
+        const double g_832 = d_cos_p * -0.125;
+        const double g_833 = h * (g_14 * g_831 - g_18 * g_832);
+        const double g_834 = h * (g_14 * g_832 + g_18 * g_831);
+        const double g_835 = d_sin_p * 0.0625;
+        const double g_836 = -g_835;
+        const double g_837 = d_cos_p * 0.0625;
+        const double g_838 = h * (g_14 * g_836 - g_18 * g_837);
+        const double g_839 = g_333 + h2 * (19.0 + 28.0 * g_15);
+        const double g_840 = h * (g_14 * g_837 + g_18 * g_836);
+        const double g_841 = g_330 + h2 * (28.0 * g_19);
+        const double g_842 = -(d_sin_p * -0.1875);
+        const double g_843 = d_cos_p * -0.1875;
+        const double g_844 = h3 * (g_14 * g_842 - g_18 * g_843);
+        const double g_845 = h3 * (g_14 * g_843 + g_18 * g_842);
+        const double g_846 = g_51 + g_116;
+        const double g_847 = g_303 + d2h2 * 42.0 + 13.0 * h4;
+        s_re(3, 2, 2) += alpha * (f[1] * (g_312 * g_833 - g_316 * g_834) + f[2]
+                * (g_838 * g_839 - g_840 * g_841) + f[3] * (g_334 * g_844
+                - g_331 * g_845) + f[5] * (h * g_307) + f[6] * (g_846 * (h
+                * g_302)) + f[7] * (g_847 * (h * g_306)) + f[8] * (g_61
+                * (c_d_h * (h3 * g_307))));
+        s_im(3, 2, 2) += alpha * (f[1] * (g_312 * g_834 + g_316 * g_833) + f[2]
+                * (g_838 * g_841 + g_840 * g_839) + f[3] * (g_334 * g_845
+                + g_331 * g_844) + f[5] * (h * g_311) + f[6] * (g_846 * (h
+                * g_309)) + f[7] * (g_847 * (h * g_310)) + f[8] * (g_61
+                * (c_d_h * (h3 * g_311))));
+        const double g_848 = -g_0;
+        const double g_849 = g_14 * g_280 - g_18 * g_19;
+        const double g_850 = 0.625 - g_849;
+        const double g_851 = g_14 * g_19 + g_18 * g_280;
+        const double g_852 = -g_851;
+        const double g_853 = h * g_837;
+        const double g_854 = g_14 * g_841 + g_18 * g_839;
+        const double g_855 = g_4 + -g_854;
+        const double g_856 = h * g_835;
+        const double g_857 = g_414 + h2 * -19.0;
+        const double g_858 = g_14 * g_839 - g_18 * g_841;
+        const double g_859 = g_857 + g_858;
+        const double g_860 = h3 * (d_cos_p * 0.1875);
+        const double g_861 = -g_4;
+        const double g_862 = g_14 * g_331 + g_18 * g_334;
+        const double g_863 = g_861 - -g_862;
+        const double g_864 = h3 * (d_sin_p * 0.1875);
+        const double g_865 = g_2 - g_414;
+        const double g_866 = g_14 * g_334 - g_18 * g_331;
+        const double g_867 = g_865 - g_866;
+        const double g_868 = 1.5 + -0.5 * g_14;
+        const double g_869 = -0.5 * g_18;
+        const double g_870 = d_2 + 12.0 * h2;
+        const double g_871 = g_846 * g_14;
+        const double g_872 = g_870 - g_871;
+        const double g_873 = g_846 * g_18;
+        const double g_874 = -g_873;
+        const double g_875 = d_4 * -0.25 + h2 * g_746 + h4 * 9.75;
+        const double g_876 = d_4 * 1.25 + h2 * (d_2 * 10.5) + h4 * 3.25;
+        const double g_877 = g_876 * g_14;
+        const double g_878 = g_875 - g_877;
+        const double g_879 = g_876 * g_18;
+        const double g_880 = -g_879;
+        const double g_881 = c_d_h * (h3 * cos_p);
+        const double g_882 = -g_881;
+        const double g_883 = c_d_m3h * 0.5;
+        const double g_884 = d_2 * 2.5 + h2 * 0.5;
+        const double g_885 = g_884 * g_14;
+        const double g_886 = g_883 + g_885;
+        const double g_887 = -(c_d_h * (h3 * sin_p));
+        const double g_888 = g_884 * g_18;
+        const double g_889 = g_887 * g_888;
+        s_re(3, 3, 0) += alpha * (f[1] * (g_848 * g_850 - g_23 * g_852) + f[2]
+                * (g_853 * g_855 - g_856 * g_859) + f[3] * (g_860 * g_863
+                - g_864 * g_867) + f[5] * (g_544 * g_868 - g_549 * g_869)
+                + f[6] * (g_544 * g_872 - g_549 * g_874) + f[7] * (g_544
+                * g_878 - g_549 * g_880) + f[8] * (g_882 * g_886 - g_889));
+        s_im(3, 3, 0) += alpha * (f[1] * (g_848 * g_852 + g_23 * g_850) + f[2]
+                * (g_853 * g_859 + g_856 * g_855) + f[3] * (g_860 * g_867
+                + g_864 * g_863) + f[5] * (g_544 * g_869 + g_549 * g_868)
+                + f[6] * (g_544 * g_874 + g_549 * g_872) + f[7] * (g_544
+                * g_880 + g_549 * g_878) + f[8] * (g_882 * g_888 + g_887
+                * g_886));
+        const double g_890 = -g_23;
+        const double g_891 = 0.625 + g_849;
+        const double g_892 = g_858 + -g_857;
+        const double g_893 = g_4 + g_854;
+        const double g_894 = -g_865 - g_866;
+        const double g_895 = g_861 - g_862;
+        const double g_896 = 1.5 + g_100;
+        const double g_897 = g_870 + g_871;
+        const double g_898 = g_875 + g_877;
+        const double g_899 = -g_883 + g_885;
+        s_re(3, 3, 1) += alpha * (f[1] * (g_890 * g_891 - g_848 * g_851) + f[2]
+                * (g_853 * g_892 - g_856 * g_893) + f[3] * (g_860 * g_894
+                - g_864 * g_895) + f[5] * (g_583 * g_896 - g_98 * g_544) + f[6]
+                * (g_583 * g_897 - g_544 * g_873) + f[7] * (g_583 * g_898
+                - g_544 * g_879) + f[8] * (g_887 * g_899 - g_881 * g_888));
+        s_im(3, 3, 1) += alpha * (f[1] * (g_851 * g_890 + g_848 * g_891) + f[2]
+                * (g_853 * g_893 + g_856 * g_892) + f[3] * (g_860 * g_895
+                + g_864 * g_894) + f[5] * (g_98 * g_583 + g_544 * g_896) + f[6]
+                * (g_583 * g_873 + g_544 * g_897) + f[7] * (g_583 * g_879
+                + g_544 * g_898) + f[8] * (g_889 + g_881 * g_899));
+        const double g_900 = -g_209;
+        const double g_901 = h2 * -(-4.0 * g_18);
+        const double g_902 = h2 * (-4.0 * g_14);
+        const double g_903 = h4 * g_900;
+        const double g_904 = h4 * g_201;
+        const double g_905 = d_cos_p * g_396;
+        const double g_906 = d_sin_p * g_396;
+        const double g_907 = d_cos_p * g_397;
+        const double g_908 = d_sin_p * g_397;
+        s_re(3, 3, 2) += alpha * (f[0] * (g_15 * g_900 - g_19 * g_201) + f[1]
+                * (g_15 * g_901 - g_19 * g_902) + f[2] * (g_15 * g_903 - g_19
+                * g_904) + f[5] * g_234 + f[6] * (cos_p * g_905 - sin_p
+                * g_906) + f[7] * (cos_p * g_907 - sin_p * g_908));
+        s_im(3, 3, 2) += alpha * (f[0] * (g_15 * g_201 + g_19 * g_900) + f[1]
+                * (g_15 * g_902 + g_19 * g_901) + f[2] * (g_15 * g_904 + g_19
+                * g_903) + f[5] * g_240 + f[6] * (cos_p * g_906 + sin_p
+                * g_905) + f[7] * (cos_p * g_908 + sin_p * g_907));
+        const double g_909 = nu * 1.25;
+        const double g_910 = g_909 * g_12;
+        const double g_911 = h * 0.0625;
+        const double g_912 = c_5_m2nu * d_2;
+        const double g_913 = -(tan_x * g_912);
+        const double g_914 = g_5 * d_2;
+        const double g_915 = -(h2 * (3.0 * (9.0 - g_5)) - g_914 * g_32);
+        const double g_916 = h * 0.09375;
+        const double g_917 = 2.0 * d2h2;
+        const double g_918 = g_717 + g_917;
+        const double g_919 = tan_x * g_918;
+        const double g_920 = -c_5_m2nu;
+        const double g_921 = h * 2.0;
+        const double g_922 = nu * (c_d_3h * g_921);
+        const double g_923 = cos_p * g_922;
+        const double g_924 = h * 4.5 * (d_2 + 5.0 * h2);
+        const double g_925 = h * 0.75 * (d_4 - g_304 - 15.0 * h4);
+        const double g_926 = c_d_m3h * (c_d_h * (h * (nu * 0.5)));
+        const double g_927 = cos_p * g_926;
+        const double g_928 = c_d_h * (h * -0.25) * (g_671 + (d_4 - g_917));
+        s_re(4, 1, 0) += alpha * (f[1] * (h * (d_sin_p * 2.875 - -g_910))
+                + f[2] * (g_911 * (d_cos_p * g_913 + d_sin_p * g_915)) + f[3]
+                * (g_916 * (d_sin_p * g_671 + d_cos_p * g_919)) + f[5] * (g_49
+                * (cos_p * g_920)) + f[6] * (g_923 - cos_p * g_924) + f[7]
+                * (cos_p * g_925 + -g_927) + f[8] * (cos_p * g_928));
+        const double g_929 = d_cos_p * g_909;
+        const double g_930 = g_515 * h2 - g_912 * g_32;
+        const double g_931 = -(tan_x * g_914);
+        const double g_932 = g_918 * g_32;
+        const double g_933 = g_922 * g_113;
+        const double g_934 = g_926 * g_113;
+        s_im(4, 1, 0) += alpha * (f[1] * (h * -g_929) + f[2] * (g_911
+                * (d_cos_p * g_930 + d_sin_p * g_931)) + f[3] * (g_916
+                * (d_cos_p * g_932)) + f[5] * (g_49 * -(g_5 * sin_p)) + f[6]
+                * g_933 + f[7] * -g_934);
+        s_re(4, 1, 1) += alpha * (f[1] * (h * (g_929 - d_cos_p * 2.875)) + f[2]
+                * (g_911 * (d_sin_p * g_913 - d_cos_p * g_915)) + f[3] * (g_916
+                * (d_cos_p * -g_671 + d_sin_p * g_919)) + f[5] * (g_49 * (sin_p
+                * g_920)) + f[6] * (-g_933 - sin_p * g_924) + f[7] * (sin_p
+                * g_925 + -(-1.0 * g_934)) + f[8] * (sin_p * g_928));
+        s_im(4, 1, 1) += alpha * (f[1] * (h * g_910) + f[2] * (g_911 * (d_sin_p
+                * g_930 - d_cos_p * g_931)) + f[3] * (g_916 * (d_sin_p
+                * g_932)) + f[5] * (g_49 * (g_5 * cos_p)) + f[6] * g_923 + f[7]
+                * (-1.0 * g_927));
+        const double g_935 = d_2 * (c_1_m2nu * (0.725 / 3.0));
+        const double g_936 = d_2 * (c_1_m2nu * (0.0 / 3.0));
+        const double g_937 = d_2 * (c_1_m2nu * 0.0375) - h2 * (c_115_m38nu_80
+                / 3.0);
+        const double g_938 = h2 * 0.2375 - d_2 * 0.1125;
+        const double abh = std::fabs(h);
+        const double g_939 = c_d_h * g_111;
+        s_re(4, 1, 2) += alpha * (f[1] * (tan_x * g_935 - g_32 * g_936) + f[2]
+                * (g_4 * g_937 - g_414 * g_444) + f[3] * (tan_x * d2h2 * g_938)
+                + f[4] * (abh * (c_1_mnu * -8.0)) + f[5] * (d_1 * (c_1_m2nu
+                * -1.5)) + f[6] * (d_1 * (d_2 * (c_1_m2nu * (1.0 / 3.0)) + h2
+                * (c_3_mnu * 3.6 - 0.4))) + f[7] * (d_1 * (d_4 * (c_1_m2nu
+                * -0.15) + d2h2 * (c_7_m2nu * (1.0 / 6.0)) + h4 * ((0.35 + 1.9
+                * (8 - nu)) / 3.0))) + f[8] * (g_939 * (h2 * (1.9 / 3.0) - d_2
+                * 0.3)));
+        const double g_940 = g_939 * g_443;
+        s_im(4, 1, 2) += alpha * (f[1] * (tan_x * g_936 + g_935 * g_32) + f[2]
+                * (g_4 * g_444 + g_937 * g_414) + f[3] * (g_938 * (d2h2
+                * g_32)) + f[6] * (d_1 * g_936) + f[7] * (d_1 * (d2h2
+                * (c_7_m2nu * (0.0 / 6.0)) + h4 * (0.0 / 3.0))) + f[8] * g_940);
+        const double g_941 = g_749 * g_368;
+        const double g_942 = -g_19;
+        const double g_943 = g_749 * g_14;
+        const double g_944 = g_15 * g_941 + g_942 * g_943;
+        const double g_945 = d_2 * (nu * (0.3625 / 3.0));
+        const double g_946 = d_2 * g_437;
+        const double g_947 = tan_x * g_945 - g_32 * g_946;
+        const double g_948 = g_760 * g_368;
+        const double g_949 = g_760 * g_14;
+        const double g_950 = g_15 * g_948 + g_942 * g_949;
+        const double g_951 = d_2 * (d_2 * (nu * 0.01875) - h2 * g_779);
+        const double g_952 = d_2 * -(h2 * g_437);
+        const double g_953 = tan_x * g_951 - g_32 * g_952;
+        const double g_954 = h4 * 0.5;
+        const double g_955 = g_954 * g_368;
+        const double g_956 = g_954 * g_14;
+        const double g_957 = g_15 * g_955 + g_942 * g_956;
+        const double g_958 = d2h2 * g_132;
+        const double g_959 = tan_x * g_958;
+        const double g_960 = abh * (c_1_nu * -2.0);
+        const double g_961 = d_1 * g_797;
+        const double g_962 = g_792 * g_12;
+        const double g_963 = g_794 - g_113 * g_962;
+        const double g_964 = d_1 * (d_2 * (nu * (0.5 / 3.0)) + h2 * (4.3 + nu
+                * 0.9));
+        const double g_965 = d_cos_p * g_760;
+        const double g_966 = g_760 * g_12;
+        const double g_967 = cos_p * g_965 - g_113 * g_966;
+        const double g_968 = g_724 + 7.3;
+        const double g_969 = d_1 * (d_4 * (nu * -0.075) + d2h2 * (c_6_nu
+                * (0.25 / 3.0)) + h4 / 3.0 * g_968);
+        const double g_970 = h4 * d_cos_p;
+        const double g_971 = h4 * g_12;
+        const double g_972 = cos_p * g_970 - g_113 * g_971;
+        const double g_973 = g_939 * (g_427 + d_2 * -0.15);
+        s_re(4, 2, 0) += alpha * (f[0] * -(-1.0 * g_944) + f[1] * (g_947
+                - -g_950) + f[2] * (g_953 + -g_957) + f[3] * g_959 + f[4]
+                * g_960 + f[5] * (-g_961 + g_963) + f[6] * (g_964 + g_967)
+                + f[7] * (g_969 + g_972) + f[8] * g_973);
+        const double g_974 = g_15 * g_943 - g_942 * g_941;
+        const double g_975 = tan_x * g_946 + g_945 * g_32;
+        const double g_976 = g_15 * g_949 - g_942 * g_948;
+        const double g_977 = tan_x * g_952 + g_951 * g_32;
+        const double g_978 = g_15 * g_956 - g_942 * g_955;
+        const double g_979 = g_958 * g_32;
+        const double g_980 = cos_p * g_962 + g_113 * g_793;
+        const double g_981 = d_1 * g_946;
+        const double g_982 = cos_p * g_966 + g_113 * g_965;
+        const double g_983 = d_1 * (d2h2 * g_778 + g_968 * (0.0 / 3.0));
+        const double g_984 = cos_p * g_971 + g_113 * g_970;
+        s_im(4, 2, 0) += alpha * (f[0] * (-1.0 * g_974) + f[1] * (g_975
+                - g_976) + f[2] * (g_977 + g_978) + f[3] * g_979 + f[5] * g_980
+                + f[6] * (g_981 + g_982) + f[7] * (g_983 + g_984) + f[8]
+                * g_940);
+        s_re(4, 2, 1) += alpha * (f[0] * g_974 + f[1] * (g_976 + -(-1.0
+                * g_975)) + f[2] * (-(-1.0 * g_977) - g_978) + f[3] * -(-1.0
+                * g_979) + f[5] * -g_980 + f[6] * -(-1.0 * (g_981 - g_982))
+                + f[7] * -(-1.0 * (g_983 - g_984)) + f[8] * -(-1.0 * g_940));
+        s_im(4, 2, 1) += alpha * (f[0] * g_944 + f[1] * (g_950 + -1.0 * g_947)
+                + f[2] * (-1.0 * g_953 - g_957) + f[3] * (-1.0 * g_959) + f[4]
+                * (-1.0 * g_960) + f[5] * (g_961 + g_963) + f[6] * (-1.0
+                * (g_964 - g_967)) + f[7] * (-1.0 * (g_969 - g_972)) + f[8]
+                * (-1.0 * g_973));
+        const double g_985 = h * 0.625;
+        const double g_986 = -(d_sin_p * g_985);
+        const double g_987 = d_cos_p * g_911;
+        const double g_988 = d_sin_p * g_911;
+        const double g_989 = g_4 * g_987 - g_857 * g_988;
+        const double g_990 = h3 * 0.1875;
+        const double g_991 = d_cos_p * g_990;
+        const double g_992 = d_sin_p * g_990;
+        const double g_993 = g_861 * g_991 - g_865 * g_992;
+        const double g_994 = h * g_870;
+        const double g_995 = cos_p * g_994;
+        const double g_996 = h * (0.25 * (g_717 + g_674 + h4 * 39.0));
+        const double g_997 = cos_p * g_996;
+        const double g_998 = c_d_m3h * (c_d_h * (h3 * g_461));
+        s_re(4, 2, 2) += alpha * (f[1] * g_986 + f[2] * g_989 + f[3] * g_993
+                + f[5] * g_50 + f[6] * g_995 + f[7] * g_997 + f[8] * g_998);
+        const double g_999 = d_cos_p * g_985;
+        const double g_1000 = g_857 * g_987 + g_4 * g_988;
+        const double g_1001 = g_865 * g_991 + g_861 * g_992;
+        const double g_1002 = sin_p * g_994;
+        const double g_1003 = sin_p * g_996;
+        const double g_1004 = c_d_m3h * (c_d_h * (h3 * g_462));
+        s_im(4, 2, 2) += alpha * (f[1] * -g_999 + f[2] * -g_1000 + f[3]
+                * -g_1001 + f[5] * g_77 + f[6] * -g_1002 + f[7] * -g_1003
+                + f[8] * -g_1004);
+        const double g_1005 = h * (c_13_10nu * 0.125);
+        const double g_1006 = tan_x * (d_2 * (c_3_2nu * 0.0625));
+        const double g_1007 = h2 * (c_7_2nu * 0.1875);
+        const double g_1008 = g_27 * (h2 * 2 - d_2);
+        const double g_1009 = h4 * 0.46875;
+        const double g_1010 = h * (c_3_2nu * -1.5);
+        const double g_1011 = g_10 * (d_2 * (c_5_4nu * 0.5) + h2 * (c_11_4nu
+                * 1.5));
+        const double g_1012 = h * (d_4 * (c_1_2nu * 0.25) - h2 * (d_2 * g_150)
+                - h4 * (c_13_2nu * 0.75));
+        const double g_1013 = c_d_h * g_10 * (d_4 * 0.25 - h2 * (d_2 * 0.5)
+                + h4 * 1.25);
+        s_re(5, 0, 0) += alpha * (f[1] * (d_sin_p * g_1005) + f[2] * (g_10
+                * (d_cos_p * g_1006 + d_sin_p * g_1007)) + f[3] * (h * (d_cos_p
+                * g_1008 + d_sin_p * g_1009)) + f[5] * (cos_p * g_1010) + f[6]
+                * (cos_p * g_1011) + f[7] * (cos_p * g_1012) + f[8] * (cos_p
+                * g_1013));
+        s_re(5, 0, 1) += alpha * (f[1] * (d_cos_p * -g_1005) + f[2] * (g_10
+                * (d_sin_p * g_1006 - d_cos_p * g_1007)) + f[3] * (h * (d_sin_p
+                * g_1008 - d_cos_p * g_1009)) + f[5] * (sin_p * g_1010) + f[6]
+                * (sin_p * g_1011) + f[7] * (sin_p * g_1012) + f[8] * (sin_p
+                * g_1013));
+        s_re(5, 0, 2) += alpha * (f[1] * (tan_x * (d_2 * (c_1_2nu * (1.0
+                / 12.0))) - g_32 * (d_2 * (c_1_2nu * (0.0 / 12.0)))) + f[2]
+                * (tan_x * (h2 * (d_2 * (c_2_nu * (-1.0 / 6.0)))) - g_32 * (h2
+                * (d_2 * (c_2_nu * (0.0 / 6.0))))) + f[3] * (tan_x * (h4
+                * g_558)) + f[4] * (abh * (c_1_nu * -4.0)) + f[5] * (d_1
+                * (c_1_2nu * -0.5)) + f[6] * (d_1 * (g_154 + g_745 * (5 + nu
+                * 2))) + f[7] * (d_1 * (h2 * (2.0 / 3.0) * (c_2_nu * d_2 + h2
+                * (nu + 7)))) + f[8] * (d_1 * (c_d_h * (h4 * (2.0 / 3.0)))));
+        const double g_1014 = 0.1875 + c_1_mnu * 1.25;
+        const double g_1015 = 1.4375 + 2.5 * g_15;
+        const double g_1016 = 2.5 * g_19;
+        const double g_1017 = g_14 * g_1015 - g_18 * g_1016;
+        const double g_1018 = -g_1014 + g_1017;
+        const double g_1019 = g_14 * g_1016 + g_18 * g_1015;
+        const double g_1020 = g_23 * g_1019;
+        const double g_1021 = c_5_m4nu * (d_2 * 0.03125);
+        const double g_1022 = tan_x * g_1021;
+        const double g_1023 = h2 * 0.3125;
+        const double g_1024 = g_1023 * g_285;
+        const double g_1025 = d_2 * (g_639 + -(0.0 / 3.0)) - -g_1024;
+        const double g_1026 = g_1023 * (2.7 + g_288);
+        const double g_1027 = d_2 * (-3.25 / 3.0 + g_644) - g_1026;
+        const double g_1028 = -g_1022 + (g_14 * g_1025 - g_18 * g_1027);
+        const double g_1029 = c_9_m4nu * (h2 * 0.09375);
+        const double g_1030 = g_1021 * g_32;
+        const double g_1031 = g_1029 - g_1030 + (g_14 * g_1027 + g_18 * g_1025);
+        const double g_1032 = d_4 * 0.046875;
+        const double g_1033 = tan_x * g_1032;
+        const double g_1034 = d2h2 * 0.09375;
+        const double g_1035 = tan_x * g_1034;
+        const double g_1036 = g_631 + g_636 - g_633;
+        const double g_1037 = g_648 + g_650 - g_649;
+        const double g_1038 = -(g_1033 + -g_1035) + (g_14 * g_1036 - g_18
+                * g_1037);
+        const double g_1039 = h4 * 0.234375;
+        const double g_1040 = g_1034 * g_32;
+        const double g_1041 = g_1032 * g_32;
+        const double g_1042 = -(g_1039 - g_1040 + g_1041) + (g_14 * g_1037
+                + g_18 * g_1036);
+        const double g_1043 = 1.25 * g_14;
+        const double g_1044 = 3.75 - g_343;
+        const double g_1045 = g_1043 - g_1044;
+        const double g_1046 = 1.25 * g_18;
+        const double g_1047 = 0.25 * g_544;
+        const double g_1048 = 15.0 * h2 + d_2 * 27.0;
+        const double g_1049 = g_1048 * g_14;
+        const double g_1050 = h2 * (3.0 * c_15_m8nu) + c_9_m8nu * d_2;
+        const double g_1051 = g_1049 - g_1050;
+        const double g_1052 = 0.25 * g_549;
+        const double g_1053 = g_1048 * g_18;
+        const double g_1054 = 0.5 * g_1047;
+        const double g_1055 = c_3_m4nu * d_4 - d2h2 * (2.0 * c_9_m4nu) - h4
+                * (3.0 * c_15_m4nu);
+        const double g_1056 = g_671 + (g_303 + d2h2 * 18.0);
+        const double g_1057 = g_1056 * g_43;
+        const double g_1058 = g_1055 + g_1057;
+        const double g_1059 = 0.5 * g_1052;
+        const double g_1060 = g_1056 * g_47;
+        const double g_1061 = c_d_h * g_1054;
+        const double g_1062 = g_918 - g_671;
+        const double g_1063 = g_14 / 3.0;
+        const double g_1064 = g_672 * g_1063;
+        const double g_1065 = g_1062 + g_1064;
+        const double g_1066 = c_d_h * g_1059;
+        const double g_1067 = g_18 / 3.0;
+        const double g_1068 = g_672 * g_1067;
+        s_re(5, 1, 0) += alpha * (f[1] * (g_848 * g_1018 - g_1020) + f[2]
+                * (g_23 * g_1028 - g_0 * g_1031) + f[3] * (g_23 * g_1038 - g_0
+                * g_1042) + f[5] * (g_544 * g_1045 - g_549 * g_1046) + f[6]
+                * (g_1047 * g_1051 - g_1052 * g_1053) + f[7] * (g_1054 * g_1058
+                - g_1059 * g_1060) + f[8] * (g_1061 * g_1065 - g_1066
+                * g_1068));
+        s_im(5, 1, 0) += alpha * (f[1] * (g_848 * g_1019 + g_23 * g_1018)
+                + f[2] * (g_23 * g_1031 + g_0 * g_1028) + f[3] * (g_23 * g_1042
+                + g_0 * g_1038) + f[5] * (g_544 * g_1046 + g_549 * g_1045)
+                + f[6] * (g_1047 * g_1053 + g_1052 * g_1051) + f[7] * (g_1054
+                * g_1060 + g_1059 * g_1058) + f[8] * (g_1061 * g_1068 + g_1066
+                * g_1065));
+        const double g_1069 = g_1014 + g_1017;
+        const double g_1070 = g_1026 + d_2 * (3.25 / 3.0 + g_688);
+        const double g_1071 = g_1024 + d_2 * (g_639 + 0.0 / 3.0);
+        const double g_1072 = g_1029 + -g_1030 + (g_14 * g_1070 - g_18
+                * g_1071);
+        const double g_1073 = g_1022 + (g_14 * g_1071 + g_18 * g_1070);
+        const double g_1074 = g_687 + (g_650 + g_686);
+        const double g_1075 = g_633 + (g_635 + g_692);
+        const double g_1076 = g_1039 + -g_1040 - -g_1041 + (g_14 * g_1074
+                - g_18 * g_1075);
+        const double g_1077 = g_1035 - g_1033 + (g_14 * g_1075 + g_18 * g_1074);
+        const double g_1078 = -(-1.0 * g_549);
+        const double g_1079 = g_1044 + g_1043;
+        const double g_1080 = -1.0 * g_544;
+        const double g_1081 = -(-1.0 * g_1052);
+        const double g_1082 = g_1050 + g_1049;
+        const double g_1083 = -1.0 * g_1047;
+        const double g_1084 = -(-1.0 * g_1059);
+        const double g_1085 = -g_1055 + g_1057;
+        const double g_1086 = -1.0 * g_1054;
+        const double g_1087 = -g_1066;
+        const double g_1088 = g_1062 - g_1064;
+        const double g_1089 = -g_1068;
+        s_re(5, 1, 1) += alpha * (f[1] * (g_23 * g_1069 - g_0 * g_1019) + f[2]
+                * (g_890 * g_1072 - g_848 * g_1073) + f[3] * (g_23 * g_1076
+                - g_0 * g_1077) + f[5] * (g_1078 * g_1079 - g_1046 * g_1080)
+                + f[6] * (g_1081 * g_1082 - g_1053 * g_1083) + f[7] * (g_1084
+                * g_1085 - g_1060 * g_1086) + f[8] * (g_1087 * g_1088 - g_1061
+                * g_1089));
+        s_im(5, 1, 1) += alpha * (f[1] * (g_1020 + g_0 * g_1069) + f[2]
+                * (g_890 * g_1073 + g_848 * g_1072) + f[3] * (g_23 * g_1077
+                + g_0 * g_1076) + f[5] * (g_1046 * g_1078 + g_1080 * g_1079)
+                + f[6] * (g_1053 * g_1081 + g_1083 * g_1082) + f[7] * (g_1060
+                * g_1084 + g_1086 * g_1085) + f[8] * (g_1087 * g_1089 + g_1061
+                * g_1088));
+        const double g_1090 = c_1_m2nu * -(0.0 / 3.0);
+        const double g_1091 = c_1_m2nu * (6.4 / 3.0);
+        const double g_1092 = g_14 * g_1090 - g_18 * g_1091;
+        const double g_1093 = g_14 * g_1091 + g_18 * g_1090;
+        const double g_1094 = h2 * (c_2_mnu * 12.8);
+        const double g_1095 = g_458 * -g_713 + -(g_19 * g_1094);
+        const double g_1096 = g_458 * (2.6 - g_711) + g_15 * g_1094;
+        const double g_1097 = c_13_m2nu * -(0.0 / 3.0);
+        const double g_1098 = c_13_m2nu * (0.8 / 3.0);
+        const double g_1099 = d_4 * (tan_x * g_448) + d2h2 * (c_115_m38nu_80
+                * tan_x / 3.0) - h4 * (g_15 * g_1097 - g_19 * g_1098);
+        const double g_1100 = d_4 * (g_448 * g_32) + d2h2 * ((-5.0 + nu * 1.6
+                + c_115_m38nu_80 * g_32) / 3.0) - h4 * (g_15 * g_1098 + g_19
+                * g_1097);
+        const double g_1101 = d_4 * -0.1875;
+        const double g_1102 = tan_x * g_1101 + d2h2 * -g_735 + -(g_19 * g_734);
+        const double g_1103 = g_1101 * g_32 + d2h2 * (0.8 - g_738) + g_15
+                * g_734;
+        const double g_1104 = d_4 * g_88 + d2h2 * g_726 + h4 * (3.0
+                * c_13_m2nu);
+        const double g_1105 = d_cos_p * -0.5;
+        const double g_1106 = d_sin_p * -0.5;
+        s_re(5, 1, 2) += alpha * (f[0] * (g_15 * g_1092 - g_19 * g_1093) + f[1]
+                * (g_1063 * g_1095 - g_1067 * g_1096) + f[2] * (g_14 * g_1099
+                - g_18 * g_1100) + f[3] * (g_86 * g_1102 - g_84 * g_1103)
+                + f[5] * (c_1_m2nu * g_158) + f[6] * (g_459 * g_234) + f[7]
+                * (g_1104 * g_165) + f[8] * (c_d_m3h * (c_d_h * (h2 * (cos_p
+                * g_1105 - sin_p * g_1106)))));
+        s_im(5, 1, 2) += alpha * (f[0] * (g_15 * g_1093 + g_19 * g_1092) + f[1]
+                * (g_1063 * g_1096 + g_1067 * g_1095) + f[2] * (g_14 * g_1100
+                + g_18 * g_1099) + f[3] * (g_86 * g_1103 + g_84 * g_1102)
+                + f[5] * (c_1_m2nu * g_174) + f[6] * (g_459 * g_240) + f[7]
+                * (g_1104 * g_179) + f[8] * (c_d_m3h * (c_d_h * (h2 * (cos_p
+                * g_1106 + sin_p * g_1105)))));
+        const double g_1107 = g_15 * g_753 + g_19 * g_752;
+        const double g_1108 = d_2 * (c_2_mnu * (0.125 / 3.0));
+        const double g_1109 = d_2 * g_709;
+        const double g_1110 = tan_x * g_1108 - g_32 * g_1109;
+        const double g_1111 = h2 * (c_3_nu * 3.2);
+        const double g_1112 = g_719 * g_466 + g_1111 * g_19;
+        const double g_1113 = g_466 * (1.3 + g_765) + g_1111 * g_15;
+        const double g_1114 = g_1063 * g_1112 + g_1067 * g_1113;
+        const double g_1115 = d_4 * g_319;
+        const double g_1116 = 0.6 + nu * 0.11875;
+        const double g_1117 = tan_x * g_1116;
+        const double g_1118 = -1.0 * (2.1 + nu * 0.4) + g_1116 * g_32;
+        const double g_1119 = c_12_nu * g_720;
+        const double g_1120 = c_12_nu * (h4 * (0.4 / 3.0));
+        const double g_1121 = tan_x * g_1115 + (g_723 * g_1117 - 0.0 / 3.0
+                * g_1118) - (g_15 * g_1119 - g_19 * g_1120);
+        const double g_1122 = g_1115 * g_32 + (g_723 * g_1118 + g_1117 * (0.0
+                / 3.0)) - (g_15 * g_1120 + g_19 * g_1119);
+        const double g_1123 = g_14 * g_1121 - g_18 * g_1122;
+        const double g_1124 = h2 * (d_2 * (c_5_mnu * (0.125 / 3.0)));
+        const double g_1125 = h2 * (d_2 * (c_5_mnu * (0.0 / 3.0)));
+        const double g_1126 = tan_x * g_1124 - g_32 * g_1125;
+        const double g_1127 = d_2 * 0.125;
+        const double g_1128 = h4 * g_1127;
+        const double g_1129 = tan_x * g_1128;
+        const double g_1130 = g_138 + h4 * g_206 + d_4 * (tan_x * 0.09375);
+        const double g_1131 = g_144 + h4 * g_212 + d_4 * -(0.09375 * g_32);
+        const double g_1132 = g_86 * g_1130 + g_84 * g_1131;
+        const double g_1133 = abh * -c_3_mnu;
+        const double g_1134 = d_1 * g_792;
+        const double g_1135 = cos_p * g_798 - sin_p * g_799;
+        const double g_1136 = d_1 * (h2 * (0.75 * (6.0 - nu)) + d_2 * (c_2_mnu
+                * (0.25 / 3.0)));
+        const double g_1137 = g_479 * (cos_p * g_805 - sin_p * g_806);
+        const double g_1138 = h2 * (15.0 - nu) + c_5_mnu * d_2;
+        const double g_1139 = h2 * (d_1 * (1.0 / 6.0)) * g_1138;
+        const double g_1140 = g_483 + g_484 - g_482;
+        const double g_1141 = g_1140 * (cos_p * g_810 - sin_p * g_811);
+        const double g_1142 = h2 * c_d_h;
+        const double g_1143 = d_1 * (h2 * (1.0 / 3.0));
+        s_re(5, 2, 0) += alpha * (f[0] * -g_1107 + f[1] * (g_1110 + -g_1114)
+                + f[2] * (g_1123 + -g_1126) + f[3] * (g_1129 + -g_1132) + f[4]
+                * g_1133 + f[5] * (-g_1134 + g_1135) + f[6] * (g_1136 + g_1137)
+                + f[7] * (g_1139 + g_1141) + f[8] * (g_1142 * (g_1143
+                - g_166)));
+        const double g_1144 = g_15 * g_752 - g_19 * g_753;
+        const double g_1145 = tan_x * g_1109 + g_1108 * g_32;
+        const double g_1146 = g_1063 * g_1113 - g_1067 * g_1112;
+        const double g_1147 = g_14 * g_1122 + g_18 * g_1121;
+        const double g_1148 = tan_x * g_1125 + g_1124 * g_32;
+        const double g_1149 = g_1128 * g_32;
+        const double g_1150 = g_86 * g_1131 - g_84 * g_1130;
+        const double g_1151 = cos_p * g_799 + sin_p * g_798;
+        const double g_1152 = d_1 * g_1109;
+        const double g_1153 = g_479 * (cos_p * g_806 + sin_p * g_805);
+        const double g_1154 = g_1138 * g_177;
+        const double g_1155 = g_1140 * (cos_p * g_811 + sin_p * g_810);
+        const double g_1156 = d_1 * g_443;
+        s_im(5, 2, 0) += alpha * (f[0] * g_1144 + f[1] * (g_1145 + g_1146)
+                + f[2] * (g_1147 + -g_1148) + f[3] * (g_1149 + g_1150) + f[5]
+                * g_1151 + f[6] * (g_1152 + g_1153) + f[7] * (g_1154 + g_1155)
+                + f[8] * (g_1142 * (g_1156 - g_180)));
+        s_re(5, 2, 1) += alpha * (f[0] * g_1144 + f[1] * (g_1146 + -g_1145)
+                + f[2] * -(-1.0 * (g_1147 + g_1148)) + f[3] * (g_1150
+                + -g_1149) + f[5] * -(-1.0 * g_1151) + f[6] * -(g_1152
+                - g_1153) + f[7] * -(g_1154 - g_1155) + f[8] * -(g_1142
+                * (g_180 + g_1156)));
+        s_im(5, 2, 1) += alpha * (f[0] * g_1107 + f[1] * (g_1110 + g_1114)
+                + f[2] * (-1.0 * (g_1123 + g_1126)) + f[3] * (g_1129 + g_1132)
+                + f[4] * g_1133 + f[5] * (-1.0 * (g_1134 + g_1135)) + f[6]
+                * (g_1136 - g_1137) + f[7] * (g_1139 - g_1141) + f[8] * (g_1142
+                * (g_1143 + g_166)));
+        s_re(5, 2, 2) += alpha * (f[1] * g_986 + f[2] * g_989 + f[3] * g_993
+                + f[5] * g_50 + f[6] * g_995 + f[7] * g_997 + f[8] * g_998);
+        s_im(5, 2, 2) += alpha * (f[1] * g_999 + f[2] * g_1000 + f[3] * g_1001
+                + f[5] * g_54 + f[6] * g_1002 + f[7] * g_1003 + f[8] * g_1004);
+        const double g_1157 = tan_x * g_1127;
+        const double g_1158 = h2 * 2.375;
+        const double g_1159 = -h3;
+        const double g_1160 = 3.0 * g_1157;
+        const double g_1161 = h2 * 1.125;
+        const double g_1162 = g_921 * g_870;
+        const double g_1163 = h * (d_4 * -0.5 + h2 * g_254 + h4 * 19.5);
+        const double g_1164 = -(c_d_m3h * (h3 * c_d_h));
+        s_re(5, 3, 0) += alpha * (f[1] * (d_sin_p * (h * -1.25)) + f[2] * (h
+                * (d_cos_p * g_1157 + d_sin_p * g_1158)) + f[3] * (g_1159
+                * (d_cos_p * g_1160 + d_sin_p * g_1161)) + f[5] * (cos_p * g_7)
+                + f[6] * (cos_p * g_1162) + f[7] * (cos_p * g_1163) + f[8]
+                * (cos_p * g_1164));
+        s_re(5, 3, 1) += alpha * (f[1] * (d_cos_p * (h * 1.25)) + f[2] * (h
+                * (d_sin_p * g_1157 - d_cos_p * g_1158)) + f[3] * (g_1159
+                * (d_sin_p * g_1160 - d_cos_p * g_1161)) + f[5] * (sin_p * g_7)
+                + f[6] * (sin_p * g_1162) + f[7] * (sin_p * g_1163) + f[8]
+                * (sin_p * g_1164));
+        const double g_1165 = d_2 * (1.0 / 3.0);
+        s_re(5, 3, 2) += alpha * (f[1] * (tan_x * (d_2 * (1.0 / 6.0)) - g_32
+                * (d_2 * (0.0 / 6.0))) + f[2] * (tan_x * (h2 * g_1165) - g_32
+                * (h2 * (d_2 * (0.0 / 3.0)))) + f[3] * (tan_x * (h4 * (d_2
+                * -0.5))) + f[5] * g_500 + f[6] * (d_1 * (g_1165 - 9.0 * h2))
+                + f[7] * (d_1 * (g_106 * (d_2 * (4.0 / 3.0) + 8.0 * h2)))
+                + f[8] * (d_1 * (c_d_h * (h4 * (-4.0 / 3.0)))));
+    }
+
+    void s_ij_red_h_contr_r
+            (double nu, std::complex<double> eix,
+             double h,
+             const il::StaticArray<double, 5> &f, double alpha,
+             il::io_t, il::StaticArray3D<double, 6, 4, 3> &s_re,
+             il::StaticArray3D<double, 6, 4, 3> &s_im) {
+        // 92 real quantities; 288 common sub-expressions
+        const double sin_x = std::imag(eix);
+        const double g_0 = nu * 2.0;
+        const double c_7_2nu = g_0 + 7.0;
+        const double h2 = h * h;
+        const double h3 = h * h2;
+        const double h4 = h2 * h2;
+        const double h5 = h * h4;
+        s_re(0, 0, 0) += alpha * (f[2] * (sin_x * (h * -c_7_2nu)) + f[3]
+                * (sin_x * (h3 * -9.0)) + f[4] * (sin_x * (h5 * -1.5)));
+        const double cos_x = std::real(eix);
+        s_re(0, 0, 1) += alpha * (f[2] * (cos_x * (h * c_7_2nu)) + f[3]
+                * (cos_x * (h3 * 9.0)) + f[4] * (cos_x * (h5 * 1.5)));
+        const double g_1 = h * 0.5;
+        const double g_2 = cos_x * sin_x;
+        const double g_3 = g_2 + g_2;
+        const double g_4 = cos_x * g_3;
+        const double g_5 = cos_x * cos_x - sin_x * sin_x;
+        const double g_6 = 3.0 + g_5;
+        const double g_7 = g_4 + sin_x * g_6;
+        const double g_8 = nu * 4.0;
+        const double g_9 = g_8 * sin_x;
+        const double g_10 = h3 * 1.5;
+        const double g_11 = h5 * 0.25;
+        s_re(0, 1, 0) += alpha * (f[2] * -(g_1 * (3.0 * g_7 - g_9)) + f[3]
+                * -(g_7 * g_10) + f[4] * -(g_7 * g_11));
+        const double g_12 = sin_x * g_3;
+        const double g_13 = cos_x * g_6 - g_12;
+        const double g_14 = g_8 * cos_x;
+        s_im(0, 1, 0) += alpha * (f[2] * (g_1 * (3.0 * g_13 - g_14)) + f[3]
+                * (g_13 * g_10) + f[4] * (g_13 * g_11));
+        const double g_15 = h * -0.5;
+        const double g_16 = 3.0 - g_5;
+        const double g_17 = -g_3;
+        const double g_18 = cos_x * g_16 - sin_x * g_17;
+        const double g_19 = h3 * -1.5;
+        const double g_20 = h5 * -0.25;
+        s_re(0, 1, 1) += alpha * (f[2] * (g_15 * (3.0 * g_18 - g_14)) + f[3]
+                * (g_19 * g_18) + f[4] * (g_20 * g_18));
+        const double g_21 = cos_x * g_17 + sin_x * g_16;
+        s_im(0, 1, 1) += alpha * (f[2] * (g_15 * (3.0 * g_21 - g_9)) + f[3]
+                * (g_19 * g_21) + f[4] * (g_20 * g_21));
+        const double g_22 = nu * -1.0;
+        const double abh = std::fabs(h);
+        s_re(0, 1, 2) += alpha * f[0] * (-(g_3 * g_22) / abh);
+        s_im(0, 1, 2) += alpha * f[0] * (g_5 * g_22 / abh);
+        const double c_1_mnu = 1.0 - nu;
+        const double g_23 = c_1_mnu * -0.25;
+        const double g_24 = g_23 * g_3 / abh;
+        s_re(0, 2, 0) += alpha * f[0] * -g_24;
+        const double g_25 = g_23 * g_5 / abh;
+        s_im(0, 2, 0) += alpha * f[0] * g_25;
+        s_re(0, 2, 1) += alpha * f[0] * g_25;
+        s_im(0, 2, 1) += alpha * f[0] * g_24;
+        const double g_26 = h * -1.0;
+        const double g_27 = h3 * -2.0;
+        s_re(0, 2, 2) += alpha * (f[2] * -(sin_x * g_26) + f[3] * -(sin_x
+                * g_27));
+        s_im(0, 2, 2) += alpha * (f[2] * (cos_x * g_26) + f[3] * (cos_x
+                * g_27));
+        const double g_28 = 4.0 * h3;
+        const double g_29 = sin_x * g_28;
+        s_re(0, 3, 0) += alpha * (f[2] * (sin_x * (h * 2.0)) + f[3] * g_29);
+        const double g_30 = h3 * -4.0;
+        s_re(0, 3, 1) += alpha * (f[2] * (cos_x * (h * -2.0)) + f[3] * (cos_x
+                * g_30));
+        const double sgh = (h < 0) ? -1.0 : static_cast<double>(h > 0);
+        const double c_1_nu = nu + 1.0;
+        const double g_31 = c_1_nu * -0.5;
+        const double g_32 = g_31 * g_3;
+        s_re(1, 0, 0) += alpha * f[0] * (sgh * -g_32);
+        const double g_33 = sgh * (g_31 * g_5);
+        s_im(1, 0, 0) += alpha * f[0] * g_33;
+        s_re(1, 0, 1) += alpha * f[0] * g_33;
+        s_im(1, 0, 1) += alpha * f[0] * (sgh * g_32);
+        const double g_34 = (1.0 + g_0) * 0.5;
+        const double g_35 = h2 * (2.0 * (nu + 2.0));
+        const double g_36 = 2.0 * h4;
+        s_re(1, 0, 2) += alpha * (f[1] * -(sin_x * g_34) + f[2] * -(sin_x
+                * g_35) + f[3] * -(sin_x * g_36));
+        s_im(1, 0, 2) += alpha * (f[1] * (cos_x * g_34) + f[2] * (cos_x * g_35)
+                + f[3] * (cos_x * g_36));
+        const double g_37 = -1.0 * sgh;
+        const double g_38 = -(g_3 * g_37);
+        const double g_39 = 0.5 * g_5;
+        const double g_40 = c_1_mnu + g_39;
+        const double g_41 = g_5 * g_37;
+        const double g_42 = 0.5 * g_3;
+        s_re(1, 1, 0) += alpha * f[0] * (g_38 * g_40 - g_41 * g_42);
+        s_im(1, 1, 0) += alpha * f[0] * (g_38 * g_42 + g_41 * g_40);
+        const double g_43 = sgh * g_5;
+        const double g_44 = c_1_mnu - g_39;
+        const double g_45 = sgh * g_3;
+        const double g_46 = -g_42;
+        s_re(1, 1, 1) += alpha * f[0] * (g_43 * g_44 - g_45 * g_46);
+        s_im(1, 1, 1) += alpha * f[0] * (g_43 * g_46 + g_45 * g_44);
+        const double g_47 = (1.0 - g_0) * 0.5;
+        const double g_48 = -(sin_x * g_47);
+        const double g_49 = cos_x * g_47;
+        const double c_2_mnu = 2.0 - nu;
+        const double g_50 = h2 * (2.0 * c_2_mnu);
+        const double g_51 = -(sin_x * g_50);
+        const double g_52 = cos_x * g_50;
+        const double g_53 = h4 * ((13.0 - g_0) * 0.25);
+        const double g_54 = -(sin_x * g_53);
+        const double g_55 = cos_x * g_53;
+        const double g_56 = h2 * 0.5;
+        const double g_57 = h4 * g_56;
+        const double g_58 = -(sin_x * g_57);
+        const double g_59 = cos_x * g_57;
+        s_re(1, 1, 2) += alpha * (f[1] * (g_5 * g_48 - g_3 * g_49) + f[2]
+                * (g_5 * g_51 - g_3 * g_52) + f[3] * (g_5 * g_54 - g_3 * g_55)
+                + f[4] * (g_5 * g_58 - g_3 * g_59));
+        s_im(1, 1, 2) += alpha * (f[1] * (g_5 * g_49 + g_3 * g_48) + f[2]
+                * (g_5 * g_52 + g_3 * g_51) + f[3] * (g_5 * g_55 + g_3 * g_54)
+                + f[4] * (g_5 * g_59 + g_3 * g_58));
+        const double g_60 = -(sin_x * 0.25);
+        const double g_61 = nu * g_5;
+        const double g_62 = c_2_mnu + g_61;
+        const double g_63 = cos_x * 0.25;
+        const double g_64 = nu * g_3;
+        const double g_65 = g_60 * g_62 - g_63 * g_64;
+        const double g_66 = -(sin_x * g_56);
+        const double c_5_mnu = 5.0 - nu;
+        const double c_3_nu = nu + 3.0;
+        const double g_67 = c_3_nu * g_5;
+        const double g_68 = c_5_mnu + g_67;
+        const double g_69 = cos_x * g_56;
+        const double g_70 = c_3_nu * g_3;
+        const double g_71 = g_66 * g_68 - g_69 * g_70;
+        const double g_72 = h4 * 0.125;
+        const double g_73 = -(sin_x * g_72);
+        const double c_12_nu = nu + 12.0;
+        const double g_74 = c_12_nu * g_5;
+        const double g_75 = 8.0 + g_74;
+        const double g_76 = cos_x * g_72;
+        const double g_77 = c_12_nu * g_3;
+        const double g_78 = g_73 * g_75 - g_76 * g_77;
+        const double h6 = h2 * h4;
+        const double g_79 = h6 * 0.25;
+        const double g_80 = g_4 + sin_x * g_5;
+        const double g_81 = g_79 * g_80;
+        s_re(1, 2, 0) += alpha * (f[1] * g_65 + f[2] * g_71 + f[3] * g_78
+                + f[4] * -g_81);
+        const double g_82 = g_60 * g_64 + g_63 * g_62;
+        const double g_83 = g_66 * g_70 + g_69 * g_68;
+        const double g_84 = g_73 * g_77 + g_76 * g_75;
+        const double g_85 = cos_x * g_5 - g_12;
+        const double g_86 = g_79 * g_85;
+        s_im(1, 2, 0) += alpha * (f[1] * g_82 + f[2] * g_83 + f[3] * g_84
+                + f[4] * g_86);
+        const double g_87 = cos_x * -0.25;
+        const double g_88 = c_2_mnu - g_61;
+        const double g_89 = sin_x * -0.25;
+        const double g_90 = -g_64;
+        const double g_91 = g_87 * g_88 - g_89 * g_90;
+        const double g_92 = h2 * -0.5;
+        const double g_93 = cos_x * g_92;
+        const double g_94 = c_5_mnu - g_67;
+        const double g_95 = sin_x * g_92;
+        const double g_96 = -g_70;
+        const double g_97 = g_93 * g_94 - g_95 * g_96;
+        const double g_98 = h4 * -0.125;
+        const double g_99 = cos_x * g_98;
+        const double g_100 = 8.0 - g_74;
+        const double g_101 = sin_x * g_98;
+        const double g_102 = -g_77;
+        const double g_103 = g_99 * g_100 - g_101 * g_102;
+        s_re(1, 2, 1) += alpha * (f[1] * g_91 + f[2] * g_97 + f[3] * g_103
+                + f[4] * g_86);
+        const double g_104 = g_87 * g_90 + g_89 * g_88;
+        const double g_105 = g_93 * g_96 + g_95 * g_94;
+        const double g_106 = g_99 * g_102 + g_101 * g_100;
+        s_im(1, 2, 1) += alpha * (f[1] * g_104 + f[2] * g_105 + f[3] * g_106
+                + f[4] * g_81);
+        const double g_107 = -sin_x;
+        const double g_108 = h2 * -4.0;
+        const double g_109 = h4 * -4.0;
+        s_re(1, 3, 2) += alpha * (f[1] * g_107 + f[2] * -(sin_x * g_108) + f[3]
+                * -(sin_x * g_109));
+        s_im(1, 3, 2) += alpha * (f[1] * cos_x + f[2] * (cos_x * g_108) + f[3]
+                * (cos_x * g_109));
+        const double g_110 = -sgh;
+        const double g_111 = g_110 * g_3;
+        s_re(2, 1, 0) += alpha * f[0] * -g_111;
+        const double g_112 = g_110 * g_5;
+        s_im(2, 1, 0) += alpha * f[0] * g_112;
+        s_re(2, 1, 1) += alpha * f[0] * g_112;
+        s_im(2, 1, 1) += alpha * f[0] * g_111;
+        s_re(2, 1, 2) += alpha * (f[1] * (3.0 * g_48) + f[2] * (3.0 * g_51)
+                + f[3] * (3.0 * g_54) + f[4] * (3.0 * g_58));
+        s_im(2, 1, 2) += alpha * (f[1] * (3.0 * g_49) + f[2] * (3.0 * g_52)
+                + f[3] * (3.0 * g_55) + f[4] * (3.0 * g_59));
+        const double g_113 = nu * 0.25;
+        const double g_114 = g_80 + 3.0 * g_107;
+        const double g_115 = g_113 * g_114;
+        const double g_116 = c_3_nu * g_56;
+        const double g_117 = g_116 * g_114;
+        const double g_118 = c_12_nu * g_72;
+        const double g_119 = g_118 * g_114;
+        const double g_120 = h6 * (sin_x * 0.75);
+        s_re(2, 2, 0) += alpha * (f[1] * (g_65 - -g_115) + f[2] * (g_71
+                - -g_117) + f[3] * (g_78 - -g_119) + f[4] * -g_120);
+        const double g_121 = g_85 + 3.0 * cos_x;
+        const double g_122 = g_113 * g_121;
+        const double g_123 = g_116 * g_121;
+        const double g_124 = g_118 * g_121;
+        const double g_125 = h6 * (cos_x * 0.75);
+        s_im(2, 2, 0) += alpha * (f[1] * -(g_82 - g_122) + f[2] * -(g_83
+                - g_123) + f[3] * -(g_84 - g_124) + f[4] * g_125);
+        s_re(2, 2, 1) += alpha * (f[1] * (g_122 - g_91) + f[2] * (g_123 - g_97)
+                + f[3] * (g_124 - g_103) + f[4] * g_125);
+        s_im(2, 2, 1) += alpha * (f[1] * -(g_115 - g_104) + f[2] * -(g_117
+                - g_105) + f[3] * -(g_119 - g_106) + f[4] * g_120);
+        const double g_126 = h * ((g_0 + 3.0) * 0.25);
+        const double g_127 = -1.0 * g_126;
+        const double g_128 = h3 * ((11.0 + g_8) * 0.25);
+        const double g_129 = -1.0 * g_128;
+        const double g_130 = h5 * ((g_0 + 13.0) * 0.125);
+        const double g_131 = -1.0 * g_130;
+        const double h7 = h2 * h5;
+        const double g_132 = h7 * 0.625;
+        const double g_133 = -1.0 * g_132 / 3.0;
+        s_re(3, 0, 0) += alpha * (f[1] * -(g_7 * g_127) + f[2] * -(g_7 * g_129)
+                + f[3] * -(g_7 * g_131) + f[4] * (g_13 * (0.0 / 3.0) - g_7
+                * g_133));
+        s_im(3, 0, 0) += alpha * (f[1] * (g_13 * g_127) + f[2] * (g_13 * g_129)
+                + f[3] * (g_13 * g_131) + f[4] * (g_13 * g_133 + g_7 * (0.0
+                / 3.0)));
+        const double g_134 = g_132 / 3.0;
+        s_re(3, 0, 1) += alpha * (f[1] * (g_126 * g_18) + f[2] * (g_128 * g_18)
+                + f[3] * (g_130 * g_18) + f[4] * (g_134 * g_18 - g_21 * (0.0
+                / 3.0)));
+        s_im(3, 0, 1) += alpha * (f[1] * (g_126 * g_21) + f[2] * (g_128 * g_21)
+                + f[3] * (g_130 * g_21) + f[4] * (g_18 * (0.0 / 3.0) + g_134
+                * g_21));
+        const double g_135 = c_1_nu * -2.0;
+        s_re(3, 0, 2) += alpha * f[0] * (abh * -(g_3 * g_135));
+        s_im(3, 0, 2) += alpha * f[0] * (abh * (g_5 * g_135));
+        const double g_136 = h * 0.25;
+        const double g_137 = cos_x * g_136;
+        const double g_138 = -(-1.0 * g_3);
+        const double g_139 = sin_x * g_136;
+        const double g_140 = -1.0 * g_5;
+        const double g_141 = g_137 * g_138 - g_139 * g_140;
+        const double c_5_m4nu = 5.0 - g_8;
+        const double g_142 = 3.0 * g_5;
+        const double g_143 = c_5_m4nu + g_142;
+        const double g_144 = g_137 * g_140 + g_139 * g_138;
+        const double g_145 = 3.0 * g_3;
+        const double g_146 = h3 * 0.25;
+        const double g_147 = cos_x * g_146;
+        const double g_148 = sin_x * g_146;
+        const double g_149 = g_138 * g_147 - g_140 * g_148;
+        const double c_15_m8nu = 15.0 - nu * 8.0;
+        const double g_150 = 9.0 * g_5;
+        const double g_151 = c_15_m8nu + g_150;
+        const double g_152 = g_140 * g_147 + g_138 * g_148;
+        const double g_153 = 9.0 * g_3;
+        const double g_154 = h5 * 0.125;
+        const double g_155 = cos_x * g_154;
+        const double g_156 = sin_x * g_154;
+        const double g_157 = g_138 * g_155 - g_140 * g_156;
+        const double c_15_m4nu = 15.0 - g_8;
+        const double g_158 = c_15_m4nu + g_150;
+        const double g_159 = g_140 * g_155 + g_138 * g_156;
+        const double g_160 = h7 * 0.125;
+        const double g_161 = cos_x * g_160;
+        const double g_162 = sin_x * g_160;
+        const double g_163 = g_138 * g_161 - g_140 * g_162;
+        const double g_164 = 5.0 / 3.0 + g_5;
+        const double g_165 = g_140 * g_161 + g_138 * g_162;
+        const double g_166 = g_3 + 0.0 / 3.0;
+        s_re(3, 1, 0) += alpha * (f[1] * (g_141 * g_143 - g_144 * g_145) + f[2]
+                * (g_149 * g_151 - g_152 * g_153) + f[3] * (g_157 * g_158
+                - g_153 * g_159) + f[4] * (g_163 * g_164 - g_165 * g_166));
+        s_im(3, 1, 0) += alpha * (f[1] * (g_141 * g_145 + g_144 * g_143) + f[2]
+                * (g_149 * g_153 + g_152 * g_151) + f[3] * (g_153 * g_157
+                + g_159 * g_158) + f[4] * (g_163 * g_166 + g_165 * g_164));
+        const double g_167 = g_5 * g_137 - g_3 * g_139;
+        const double g_168 = c_5_m4nu - g_142;
+        const double g_169 = g_5 * g_139 + g_3 * g_137;
+        const double g_170 = -g_145;
+        const double g_171 = g_5 * g_147 - g_3 * g_148;
+        const double g_172 = c_15_m8nu - g_150;
+        const double g_173 = g_5 * g_148 + g_3 * g_147;
+        const double g_174 = -g_153;
+        const double g_175 = g_5 * g_155 - g_3 * g_156;
+        const double g_176 = c_15_m4nu - g_150;
+        const double g_177 = g_5 * g_156 + g_3 * g_155;
+        const double g_178 = g_5 * g_161 - g_3 * g_162;
+        const double g_179 = 5.0 / 3.0 - g_5;
+        const double g_180 = g_5 * g_162 + g_3 * g_161;
+        const double g_181 = 0.0 / 3.0 - g_3;
+        s_re(3, 1, 1) += alpha * (f[1] * (g_167 * g_168 - g_169 * g_170) + f[2]
+                * (g_171 * g_172 - g_173 * g_174) + f[3] * (g_175 * g_176
+                - g_174 * g_177) + f[4] * (g_178 * g_179 - g_180 * g_181));
+        s_im(3, 1, 1) += alpha * (f[1] * (g_167 * g_170 + g_169 * g_168) + f[2]
+                * (g_171 * g_174 + g_173 * g_172) + f[3] * (g_174 * g_175
+                + g_177 * g_176) + f[4] * (g_178 * g_181 + g_180 * g_179));
+        const double g_182 = abh * (c_1_mnu * -2.0);
+        const double g_183 = -(g_3 * g_182);
+        const double g_184 = g_5 * g_182;
+        s_re(3, 1, 2) += alpha * f[0] * (g_5 * g_183 - g_3 * g_184);
+        s_im(3, 1, 2) += alpha * f[0] * (g_5 * g_184 + g_3 * g_183);
+        const double g_185 = c_1_nu * g_3;
+        const double g_186 = abh * -(-0.5 * g_185);
+        const double c_3_mnu = 3.0 - nu;
+        const double g_187 = c_1_nu * g_5;
+        const double g_188 = abh * (-0.5 * (c_3_mnu + g_187));
+        s_re(3, 2, 0) += alpha * f[0] * (g_5 * g_186 - g_3 * g_188);
+        s_im(3, 2, 0) += alpha * f[0] * (g_5 * g_188 + g_3 * g_186);
+        const double g_189 = abh * (0.5 * (c_3_mnu - g_187));
+        const double g_190 = abh * (0.5 * -g_185);
+        s_re(3, 2, 1) += alpha * f[0] * (g_5 * g_189 - g_3 * g_190);
+        s_im(3, 2, 1) += alpha * f[0] * (g_5 * g_190 + g_3 * g_189);
+        const double g_191 = -(sin_x * g_1);
+        const double g_192 = cos_x * g_1;
+        const double g_193 = -g_29;
+        const double g_194 = cos_x * g_28;
+        const double g_195 = h5 * 3.25;
+        const double g_196 = -(sin_x * g_195);
+        const double g_197 = cos_x * g_195;
+        const double g_198 = h7 * 0.5;
+        const double g_199 = -(sin_x * g_198);
+        const double g_200 = cos_x * g_198;
+        s_re(3, 2, 2) += alpha * (f[1] * (g_5 * g_191 - g_3 * g_192) + f[2]
+                * (g_5 * g_193 - g_3 * g_194) + f[3] * (g_5 * g_196 - g_3
+                * g_197) + f[4] * (g_5 * g_199 - g_3 * g_200));
+        s_im(3, 2, 2) += alpha * (f[1] * (g_5 * g_192 + g_3 * g_191) + f[2]
+                * (g_5 * g_194 + g_3 * g_193) + f[3] * (g_5 * g_197 + g_3
+                * g_196) + f[4] * (g_5 * g_200 + g_3 * g_199));
+        s_re(3, 3, 0) += alpha * (f[1] * -(g_1 * g_7) + f[2] * -(g_28 * g_7)
+                + f[3] * -(g_7 * g_195) + f[4] * -(g_7 * g_198));
+        s_im(3, 3, 0) += alpha * (f[1] * (g_1 * g_13) + f[2] * (g_28 * g_13)
+                + f[3] * (g_13 * g_195) + f[4] * (g_13 * g_198));
+        const double g_201 = h5 * -3.25;
+        const double g_202 = h7 * -0.5;
+        s_re(3, 3, 1) += alpha * (f[1] * (g_15 * g_18) + f[2] * (g_30 * g_18)
+                + f[3] * (g_201 * g_18) + f[4] * (g_202 * g_18));
+        s_im(3, 3, 1) += alpha * (f[1] * (g_15 * g_21) + f[2] * (g_30 * g_21)
+                + f[3] * (g_201 * g_21) + f[4] * (g_202 * g_21));
+        const double g_203 = -g_139;
+        const double g_204 = -(3.0 * g_203);
+        const double g_205 = 5.0 * g_5;
+        const double g_206 = c_5_m4nu - g_205;
+        const double g_207 = 3.0 * g_137;
+        const double g_208 = 5.0 * g_3;
+        const double g_209 = -g_208;
+        const double g_210 = -g_148;
+        const double g_211 = -(3.0 * g_210);
+        const double g_212 = 15.0 * g_5;
+        const double g_213 = c_15_m8nu - g_212;
+        const double g_214 = 3.0 * g_147;
+        const double g_215 = 15.0 * g_3;
+        const double g_216 = -g_215;
+        const double g_217 = -g_156;
+        const double g_218 = -(3.0 * g_217);
+        const double g_219 = c_15_m4nu - g_212;
+        const double g_220 = 3.0 * g_155;
+        s_re(4, 1, 0) += alpha * (f[1] * (g_204 * g_206 - g_207 * g_209) + f[2]
+                * (g_211 * g_213 - g_214 * g_216) + f[3] * (g_218 * g_219
+                - g_216 * g_220) + f[4] * (sin_x * (h7 * 1.25)));
+        s_im(4, 1, 0) += alpha * (f[1] * (g_204 * g_209 + g_207 * g_206) + f[2]
+                * (g_211 * g_216 + g_214 * g_213) + f[3] * (g_216 * g_218
+                + g_220 * g_219));
+        const double g_221 = -3.0 * g_137;
+        const double g_222 = c_5_m4nu + g_205;
+        const double g_223 = -3.0 * g_203;
+        const double g_224 = -3.0 * g_147;
+        const double g_225 = c_15_m8nu + g_212;
+        const double g_226 = -3.0 * g_210;
+        const double g_227 = -3.0 * g_155;
+        const double g_228 = c_15_m4nu + g_212;
+        const double g_229 = -3.0 * g_217;
+        s_re(4, 1, 1) += alpha * (f[1] * (g_221 * g_222 - g_208 * g_223) + f[2]
+                * (g_224 * g_225 - g_215 * g_226) + f[3] * (g_227 * g_228
+                - g_215 * g_229) + f[4] * (cos_x * (h7 * -1.25)));
+        s_im(4, 1, 1) += alpha * (f[1] * (g_208 * g_221 + g_223 * g_222) + f[2]
+                * (g_215 * g_224 + g_226 * g_225) + f[3] * (g_215 * g_227
+                + g_229 * g_228));
+        const double g_230 = abh * (c_3_mnu * -0.5);
+        const double g_231 = g_230 * g_17;
+        s_re(4, 2, 0) += alpha * f[0] * -(-1.0 * g_231);
+        const double g_232 = g_230 * g_5;
+        s_im(4, 2, 0) += alpha * f[0] * (-1.0 * g_232);
+        s_re(4, 2, 1) += alpha * f[0] * g_232;
+        s_im(4, 2, 1) += alpha * f[0] * g_231;
+        const double g_233 = 3.0 * g_191;
+        const double g_234 = 3.0 * g_193;
+        const double g_235 = 3.0 * g_196;
+        const double g_236 = 3.0 * g_199;
+        s_re(4, 2, 2) += alpha * (f[1] * g_233 + f[2] * g_234 + f[3] * g_235
+                + f[4] * g_236);
+        const double g_237 = 3.0 * g_192;
+        const double g_238 = 3.0 * g_194;
+        const double g_239 = 3.0 * g_197;
+        const double g_240 = 3.0 * g_200;
+        s_im(4, 2, 2) += alpha * (f[1] * -g_237 + f[2] * -g_238 + f[3] * -g_239
+                + f[4] * -g_240);
+        s_re(5, 0, 0) += alpha * (f[1] * (sin_x * (g_126 * 6.0)) + f[2]
+                * (sin_x * (g_128 * 6.0)) + f[3] * (sin_x * (g_130 * 6.0))
+                + f[4] * (sin_x * (2.0 * g_132)));
+        s_re(5, 0, 1) += alpha * (f[1] * (cos_x * (g_126 * -6.0)) + f[2]
+                * (cos_x * (g_128 * -6.0)) + f[3] * (cos_x * (g_130 * -6.0))
+                + f[4] * (cos_x * (g_132 * -2.0)));
+        const double g_241 = -(-1.0 * g_139);
+        const double g_242 = 3.0 * c_5_m4nu;
+        const double g_243 = g_242 + g_205;
+        const double g_244 = -1.0 * g_137;
+        const double g_245 = -(-3.0 * g_148);
+        const double g_246 = c_15_m8nu + g_205;
+        const double g_247 = -(-3.0 * g_156);
+        const double g_248 = c_15_m4nu + g_205;
+        const double g_249 = -(-5.0 * g_162);
+        const double g_250 = g_5 / 3.0;
+        const double g_251 = 1.0 + g_250;
+        const double g_252 = -5.0 * g_161;
+        const double g_253 = g_3 / 3.0;
+        s_re(5, 1, 0) += alpha * (f[1] * (g_241 * g_243 - g_208 * g_244) + f[2]
+                * (g_245 * g_246 - g_208 * g_224) + f[3] * (g_247 * g_248
+                - g_208 * g_227) + f[4] * (g_249 * g_251 - g_252 * g_253));
+        s_im(5, 1, 0) += alpha * (f[1] * (g_208 * g_241 + g_244 * g_243) + f[2]
+                * (g_208 * g_245 + g_224 * g_246) + f[3] * (g_208 * g_247
+                + g_227 * g_248) + f[4] * (g_249 * g_253 + g_252 * g_251));
+        const double g_254 = g_242 - g_205;
+        const double g_255 = c_15_m8nu - g_205;
+        const double g_256 = 3.0 * g_148;
+        const double g_257 = c_15_m4nu - g_205;
+        const double g_258 = 3.0 * g_156;
+        const double g_259 = 5.0 * g_161;
+        const double g_260 = 1.0 - g_250;
+        const double g_261 = 5.0 * g_162;
+        const double g_262 = -g_253;
+        s_re(5, 1, 1) += alpha * (f[1] * (g_137 * g_254 - g_139 * g_209) + f[2]
+                * (g_214 * g_255 - g_209 * g_256) + f[3] * (g_220 * g_257
+                - g_209 * g_258) + f[4] * (g_259 * g_260 - g_261 * g_262));
+        s_im(5, 1, 1) += alpha * (f[1] * (g_137 * g_209 + g_139 * g_254) + f[2]
+                * (g_209 * g_214 + g_256 * g_255) + f[3] * (g_209 * g_220
+                + g_258 * g_257) + f[4] * (g_259 * g_262 + g_261 * g_260));
+        const double g_263 = abh * (c_1_mnu * -4.0);
+        s_re(5, 1, 2) += alpha * f[0] * -(g_3 * g_263);
+        s_im(5, 1, 2) += alpha * f[0] * (g_5 * g_263);
+        const double g_264 = abh * -c_1_nu;
+        const double g_265 = g_264 * g_3;
+        s_re(5, 2, 0) += alpha * f[0] * -g_265;
+        const double g_266 = g_264 * g_5;
+        s_im(5, 2, 0) += alpha * f[0] * g_266;
+        s_re(5, 2, 1) += alpha * f[0] * g_266;
+        s_im(5, 2, 1) += alpha * f[0] * g_265;
+        s_re(5, 2, 2) += alpha * (f[1] * g_233 + f[2] * g_234 + f[3] * g_235
+                + f[4] * g_236);
+        s_im(5, 2, 2) += alpha * (f[1] * g_237 + f[2] * g_238 + f[3] * g_239
+                + f[4] * g_240);
+        s_re(5, 3, 0) += alpha * (f[1] * (sin_x * (h * -3.0)) + f[2] * (sin_x
+                * (h3 * -24.0)) + f[3] * (sin_x * (h5 * -19.5)) + f[4] * (sin_x
+                * (h7 * -3.0)));
+        s_re(5, 3, 1) += alpha * (f[1] * (cos_x * (h * 3.0)) + f[2] * (cos_x
+                * (h3 * 24.0)) + f[3] * (cos_x * (h5 * 19.5)) + f[4] * (cos_x
+                * (3.0 * h7)));
+    }
+
+    void s_ij_lim_h_contr_r
+            (double nu, std::complex<double> eix,
+             std::complex<double> d,
+             double alpha,
+             il::io_t, il::StaticArray3D<double, 6, 4, 3> &s_re,
+             il::StaticArray3D<double, 6, 4, 3> &s_im) {
+        // 47 real quantities; 84 common sub-expressions
+        const double sin_x = std::imag(eix);
+        const double d_1 = std::abs(d);
+        const double g_0 = sin_x / d_1;
+        const double g_1 = nu * 2.0;
+        const double g_2 = (1.0 + g_1) * 0.5;
+        s_re(0, 0, 2) += alpha * (g_0 * g_2);
+        const double c_1_m2nu = 1.0 - g_1;
+        const std::complex<double> e = std::polar(1.0, std::arg(d));
+        const double g_3 = std::real(e);
+        const double g_4 = std::imag(e);
+        const double g_5 = g_3 * g_3 - g_4 * g_4;
+        const double g_6 = 0.5 * g_5 / d_1;
+        const double cos_x = std::real(eix);
+        const double g_7 = -(2.0 * sin_x);
+        const double g_8 = sin_x - cos_x * (cos_x * g_7);
+        const double g_9 = g_3 * g_4;
+        const double g_10 = g_9 + g_9;
+        const double g_11 = 0.5 * g_10 / d_1;
+        const double g_12 = 2.0 * cos_x;
+        const double g_13 = -(cos_x * (cos_x * g_12));
+        const double g_14 = g_6 * g_8 - g_11 * g_13;
+        s_re(0, 1, 2) += alpha * (c_1_m2nu * g_14);
+        const double g_15 = g_6 * g_13 + g_11 * g_8;
+        s_im(0, 1, 2) += alpha * (c_1_m2nu * g_15);
+        const double g_16 = (2.0 - nu) * 0.25;
+        const double g_17 = g_0 * g_16;
+        const double g_18 = nu * 0.5;
+        const double g_19 = g_18 * g_14;
+        s_re(0, 2, 0) += alpha * (g_17 + g_19);
+        const double g_20 = g_16 * (0.0 / d_1);
+        const double g_21 = g_18 * g_15;
+        s_im(0, 2, 0) += alpha * (g_20 + g_21);
+        s_re(0, 2, 1) += alpha * -(g_20 - g_21);
+        s_im(0, 2, 1) += alpha * (g_17 - g_19);
+        s_re(0, 3, 2) += alpha * g_0;
+        const double h0_lim = std::atanh(sin_x);
+        const double g_22 = h0_lim * g_3;
+        s_re(1, 0, 2) += alpha * (g_2 * g_22);
+        const double g_23 = h0_lim * g_4;
+        s_im(1, 0, 2) += alpha * (g_2 * g_23);
+        const double g_24 = -0.125 * (g_3 * g_5 - g_4 * g_10);
+        const double g_25 = -sin_x;
+        const double g_26 = cos_x * cos_x - sin_x * sin_x;
+        const double g_27 = 8.0 + g_26;
+        const double g_28 = cos_x * sin_x;
+        const double g_29 = g_28 + g_28;
+        const double g_30 = h0_lim * 4.0 + (g_25 * g_27 - cos_x * g_29);
+        const double g_31 = -0.125 * (g_3 * g_10 + g_4 * g_5);
+        const double g_32 = g_25 * g_29 + cos_x * g_27;
+        const double g_33 = g_24 * g_30 - g_31 * g_32;
+        s_re(1, 1, 2) += alpha * (c_1_m2nu * g_33);
+        const double g_34 = g_24 * g_32 + g_31 * g_30;
+        s_im(1, 1, 2) += alpha * (c_1_m2nu * g_34);
+        const double g_35 = g_16 * g_22;
+        const double g_36 = g_18 * g_33;
+        s_re(1, 2, 0) += alpha * (g_35 + g_36);
+        const double g_37 = g_16 * g_23;
+        const double g_38 = g_18 * g_34;
+        s_im(1, 2, 0) += alpha * (g_37 + g_38);
+        s_re(1, 2, 1) += alpha * -(g_37 - g_38);
+        s_im(1, 2, 1) += alpha * (g_35 - g_36);
+        s_re(1, 3, 2) += alpha * g_22;
+        s_im(1, 3, 2) += alpha * g_23;
+        const double g_39 = 0.125 * g_3;
+        const double g_40 = h0_lim * 12.0 + -(sin_x * 5.0);
+        const double g_41 = 0.125 * g_4;
+        const double g_42 = cos_x * 5.0;
+        const double g_43 = g_39 * g_40 - g_41 * g_42;
+        s_re(2, 1, 2) += alpha * (c_1_m2nu * g_43);
+        const double g_44 = g_39 * g_42 + g_41 * g_40;
+        s_im(2, 1, 2) += alpha * (c_1_m2nu * g_44);
+        const double g_45 = g_18 * g_43;
+        s_re(2, 2, 0) += alpha * (g_35 + g_45);
+        const double g_46 = g_16 * -g_23;
+        const double g_47 = g_18 * g_44;
+        s_im(2, 2, 0) += alpha * (g_46 + g_47);
+        s_re(2, 2, 1) += alpha * -(g_46 - g_47);
+        s_im(2, 2, 1) += alpha * (g_35 - g_45);
+        const double g_48 = std::real(d);
+        const double g_49 = std::imag(d);
+        const double g_50 = g_3 * g_48 - g_4 * g_49;
+        const double g_51 = h0_lim + g_7;
+        const double g_52 = g_4 * g_48 + g_3 * g_49;
+        const double g_53 = g_50 * g_51 - g_12 * g_52;
+        s_re(3, 0, 2) += alpha * (g_2 * g_53);
+        const double g_54 = g_12 * g_50 + g_52 * g_51;
+        s_im(3, 0, 2) += alpha * (g_2 * g_54);
+        const double g_55 = d_1 * (-0.5 * (g_5 * g_5 - g_10 * g_10));
+        const double g_56 = g_26 - 3.0;
+        const double g_57 = h0_lim * 3.0 - (g_7 * g_56 - g_12 * g_29);
+        const double g_58 = g_5 * g_10;
+        const double g_59 = d_1 * (-0.5 * (g_58 + g_58));
+        const double g_60 = -(g_7 * g_29 + g_12 * g_56);
+        const double g_61 = g_55 * g_57 - g_59 * g_60;
+        s_re(3, 1, 2) += alpha * (c_1_m2nu * g_61);
+        const double g_62 = g_55 * g_60 + g_59 * g_57;
+        s_im(3, 1, 2) += alpha * (c_1_m2nu * g_62);
+        const double g_63 = g_16 * g_53;
+        const double g_64 = g_18 * g_61;
+        s_re(3, 2, 0) += alpha * (g_63 + g_64);
+        const double g_65 = g_16 * g_54;
+        const double g_66 = g_18 * g_62;
+        s_im(3, 2, 0) += alpha * (g_65 + g_66);
+        s_re(3, 2, 1) += alpha * -(g_65 - g_66);
+        s_im(3, 2, 1) += alpha * (g_63 - g_64);
+        s_re(3, 3, 2) += alpha * g_53;
+        s_im(3, 3, 2) += alpha * g_54;
+        const double g_67 = h0_lim * (d_1 * -1.5);
+        s_re(4, 1, 2) += alpha * (c_1_m2nu * g_67);
+        const double g_68 = g_67 * g_18;
+        s_re(4, 2, 0) += alpha * (g_68 + g_63);
+        const double g_69 = g_16 * -g_54;
+        s_im(4, 2, 0) += alpha * g_69;
+        s_re(4, 2, 1) += alpha * -g_69;
+        s_im(4, 2, 1) += alpha * (g_63 - g_68);
+        const double g_70 = d_1 * -h0_lim;
+        s_re(5, 0, 2) += alpha * (g_70 * g_2);
+        const double g_71 = d_1 * (1.5 * g_5);
+        const double g_72 = d_1 * (1.5 * g_10);
+        const double g_73 = g_51 * g_71 - g_12 * g_72;
+        s_re(5, 1, 2) += alpha * (c_1_m2nu * g_73);
+        const double g_74 = g_51 * g_72 + g_12 * g_71;
+        s_im(5, 1, 2) += alpha * (c_1_m2nu * g_74);
+        const double g_75 = g_70 * g_16;
+        const double g_76 = g_18 * g_73;
+        s_re(5, 2, 0) += alpha * (g_75 + g_76);
+        const double g_77 = g_18 * g_74;
+        s_im(5, 2, 0) += alpha * g_77;
+        s_re(5, 2, 1) += alpha * -(-g_77);
+        s_im(5, 2, 1) += alpha * (g_75 - g_76);
+        s_re(5, 3, 2) += alpha * g_70;
+    }
+
+}
@@ -0,0 +1,198 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <algorithm>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include "element_utilities.h"
+#include "system_assembly.h"
+#include "lazy_assembly.h"
+
+namespace hfp3d {
+
+    Lazy_Infl_Matrix::Lazy_Infl_Matrix
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             il::int_t max_col) :
+            mu_{mu},
+            nu_{nu},
+            n_par_(n_par),
+            ele_l_{make_ele_struct_list(mesh, n_par)},
+            self_cache_{},
+            act_el_{},
+            act_pos_{mesh.conn.size(1), -1},
+            max_col_{max_col},
+            col_{},
+            lru_{},
+            n_blk_eval_{0} {
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(max_col >= 1);
+        self_cache_.tol = n_par.self_blk_tol;
+    }
+
+    void Lazy_Infl_Matrix::activate(const il::Array<il::int_t> &ae_set) {
+// The columns in the cache are completed (for the new targets)
+// when used, see column_
+        const il::int_t num_ele = act_pos_.size();
+        for (il::int_t i = 0; i < ae_set.size(); ++i) {
+            il::int_t el = ae_set[i];
+            if (el < 0) continue;
+            IL_EXPECT_FAST(el < num_ele);
+            if (act_pos_[el] >= 0) continue;
+            act_pos_[el] = act_el_.size();
+            act_el_.append(el);
+        }
+    }
+
+    const il::Array<il::StaticArray2D<double, 18, 18>> &
+    Lazy_Infl_Matrix::column_(il::int_t source_elem) {
+        auto it = col_.find(source_elem);
+        if (it == col_.end()) {
+            lru_.push_front(source_elem);
+            it = col_.emplace(source_elem, Col_T{}).first;
+            it->second.lru_it = lru_.begin();
+            // dropping the least recently used columns
+            while (static_cast<il::int_t>(col_.size()) > max_col_) {
+                col_.erase(lru_.back());
+                lru_.pop_back();
+            }
+        } else {
+            lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+        }
+        Col_T &col = it->second;
+
+        const il::int_t n_0 = col.blk.size();
+        const il::int_t n_act = act_el_.size();
+        if (n_0 == n_act) {
+            return col.blk;
+        }
+
+        // the missing rows (targets activated after the column
+        // was calculated)
+        const Element_Struct_T &ele_s = ele_l_[source_elem];
+        const bool use_self_cache = n_par_.self_blk_tol > 0.0;
+        il::Array<il::int_t> t_el_l{};
+        t_el_l.reserve(n_act - n_0);
+        for (il::int_t k = n_0; k < n_act; ++k) {
+            // the self-influence block is taken from the cache
+            if (act_el_[k] != source_elem || !use_self_cache) {
+                t_el_l.append(act_el_[k]);
+            }
+        }
+        il::Array<il::StaticArray2D<double, 18, 18>> trac_infl{};
+        if (t_el_l.size() > 0) {
+            Src_El_Prep_T prep = make_src_el_prep
+                    (1, mu_, nu_, make_el_tau_crd(ele_s.vert, ele_s.r_tensor),
+                     ele_s.sf_m);
+            trac_infl = make_el2el_vc_submatrices
+                    (prep, ele_s, ele_l_, t_el_l, n_par_.is_dd_local);
+        }
+        col.blk.reserve(n_act);
+        il::int_t i_t = 0;
+        for (il::int_t k = n_0; k < n_act; ++k) {
+            if (act_el_[k] != source_elem || !use_self_cache) {
+                col.blk.append(trac_infl[i_t]);
+                ++i_t;
+            } else {
+                col.blk.append(make_el2el_vc_self_submatrix
+                        (mu_, nu_, ele_s, n_par_.beta, n_par_.is_dd_local,
+                         il::io, self_cache_));
+            }
+        }
+        n_blk_eval_ += n_act - n_0;
+        return col.blk;
+    }
+
+    il::StaticArray2D<double, 18, 18> Lazy_Infl_Matrix::block
+            (il::int_t target_elem, il::int_t source_elem) {
+        IL_EXPECT_FAST(source_elem >= 0 && source_elem < act_pos_.size());
+        IL_EXPECT_FAST(target_elem >= 0 && target_elem < act_pos_.size());
+        IL_EXPECT_FAST(act_pos_[target_elem] >= 0);
+        return column_(source_elem)[act_pos_[target_elem]];
+    }
+
+    il::Array2D<double> Lazy_Infl_Matrix::matrix
+            (const DoF_Handle_T &dof_hndl) {
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(0) == act_pos_.size());
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(1) == 18);
+        const il::int_t num_dof = dof_hndl.n_dof;
+        const il::int_t n_act = act_el_.size();
+        const il::int_t ndpe = 18;
+        for (il::int_t el = 0; el < act_pos_.size(); ++el) {
+            if (act_pos_[el] >= 0) continue;
+            for (il::int_t i = 0; i < ndpe; ++i) {
+                IL_EXPECT_FAST(dof_hndl.dof_h(el, i) < 0);
+            }
+        }
+        il::Array2D<double> infl_matrix{num_dof, num_dof, 0.0};
+
+        for (il::int_t a_s = 0; a_s < n_act; ++a_s) {
+            il::int_t source_elem = act_el_[a_s];
+            const il::Array<il::StaticArray2D<double, 18, 18>> &col =
+                    column_(source_elem);
+            for (il::int_t a_t = 0; a_t < n_act; ++a_t) {
+                il::int_t target_elem = act_el_[a_t];
+                for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+                    il::int_t j1 = dof_hndl.dof_h(source_elem, i1);
+                    if (j1 < 0) continue;
+                    for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
+                        il::int_t j0 = dof_hndl.dof_h(target_elem, i0);
+                        if (j0 >= 0) {
+                            infl_matrix(j0, j1) += col[a_t](i0, i1);
+                        }
+                    }
+                }
+            }
+        }
+        return infl_matrix;
+    }
+
+    il::Array<double> Lazy_Infl_Matrix::dot
+            (const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &dd) {
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(0) == act_pos_.size());
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(1) == 18);
+        IL_EXPECT_FAST(dd.size() >= dof_hndl.n_dof);
+        const il::int_t n_act = act_el_.size();
+        const il::int_t ndpe = 18;
+        il::Array<double> trac{dof_hndl.n_dof, 0.0};
+
+        for (il::int_t a_s = 0; a_s < n_act; ++a_s) {
+            il::int_t source_elem = act_el_[a_s];
+            // DD of the source element
+            il::StaticArray<double, 18> dd_s;
+            bool is_zero = true;
+            for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+                il::int_t j1 = dof_hndl.dof_h(source_elem, i1);
+                dd_s[i1] = (j1 >= 0) ? dd[j1] : 0.0;
+                is_zero = is_zero && dd_s[i1] == 0.0;
+            }
+            if (is_zero) continue;
+            const il::Array<il::StaticArray2D<double, 18, 18>> &col =
+                    column_(source_elem);
+            for (il::int_t a_t = 0; a_t < n_act; ++a_t) {
+                il::int_t target_elem = act_el_[a_t];
+                for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
+                    il::int_t j0 = dof_hndl.dof_h(target_elem, i0);
+                    if (j0 < 0) continue;
+                    double t = 0.0;
+                    for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+                        t += col[a_t](i0, i1) * dd_s[i1];
+                    }
+                    trac[j0] += t;
+                }
+            }
+        }
+        return trac;
+    }
+
+}
@@ -0,0 +1,96 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Lazily assembled influence matrix for a growing set of "active"
+// (slid or opened) elements, e.g. a fault activated by injection
+// (see init_mesh_data_p_fault): the influence blocks are calculated
+// only between active elements, when an element enters the active set;
+// the columns (source elements) are kept in a cache of bounded size
+// (least recently used ones are dropped and re-calculated on demand)
+
+#ifndef INC_HFPX3D_LAZY_ASSEMBLY_H
+#define INC_HFPX3D_LAZY_ASSEMBLY_H
+
+#include <list>
+#include <unordered_map>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray2D.h>
+#include "mesh_utilities.h"
+#include "element_utilities.h"
+#include "system_assembly.h"
+
+namespace hfp3d {
+
+    class Lazy_Infl_Matrix {
+    private:
+        // column of a source element: blocks of tractions (at CP)
+        // vs DD (see make_el2el_vc_submatrix) for the active elements
+        // act_el_[0 .. blk.size()) as targets
+        struct Col_T {
+            il::Array<il::StaticArray2D<double, 18, 18>> blk{};
+            // position in lru_
+            std::list<il::int_t>::iterator lru_it{};
+        };
+
+        double mu_;
+        double nu_;
+        Num_Param_T n_par_;
+        // properties of all elements of the mesh
+        il::Array<Element_Struct_T> ele_l_;
+        Self_Block_Cache_T self_cache_;
+        // active elements (in the order of activation)
+        // and the position of each element in this list (-1: inactive)
+        il::Array<il::int_t> act_el_;
+        il::Array<il::int_t> act_pos_;
+        // cached columns and their order of use (most recent first)
+        il::int_t max_col_;
+        std::unordered_map<il::int_t, Col_T> col_;
+        std::list<il::int_t> lru_;
+        // number of calculated element-to-element blocks
+        il::int_t n_blk_eval_;
+
+        // the column of source_elem completed for all active targets
+        const il::Array<il::StaticArray2D<double, 18, 18>> &column_
+                (il::int_t source_elem);
+
+    public:
+        // nothing is calculated here; max_col is the maximum number
+        // of cached columns (source elements)
+        Lazy_Infl_Matrix(double mu, double nu,
+                         const Mesh_Geom_T &mesh,
+                         const Num_Param_T &n_par,
+                         il::int_t max_col);
+
+        // adds the elements of ae_set (see Mesh_Data_T) which are not
+        // active yet; elements are never deactivated
+        void activate(const il::Array<il::int_t> &ae_set);
+
+        il::int_t n_active() const { return act_el_.size(); };
+        il::int_t n_cached() const { return col_.size(); };
+        il::int_t n_blk_eval() const { return n_blk_eval_; };
+
+        // influence of source_elem on an active target_elem
+        // (tractions at CP vs DD, 18 * 18)
+        il::StaticArray2D<double, 18, 18> block
+                (il::int_t target_elem, il::int_t source_elem);
+
+        // tractions-vs-DD matrix (dof_hndl.n_dof * dof_hndl.n_dof);
+        // only active elements may have free DoF
+        il::Array2D<double> matrix(const DoF_Handle_T &dof_hndl);
+
+        // tractions (at the DoF of dof_hndl) for given DD
+        il::Array<double> dot
+                (const DoF_Handle_T &dof_hndl,
+                 const il::Array<double> &dd);
+    };
+
+}
+
+#endif //INC_HFPX3D_LAZY_ASSEMBLY_H
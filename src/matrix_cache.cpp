@@ -0,0 +1,147 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <il/Array2D.h>
+#include "binary_io.h"
+#include "system_assembly.h"
+#include "matrix_cache.h"
+
+namespace hfp3d {
+
+    // 8-char tag of matrix cache files
+    const std::string mc_kind = "HFPXMTRX";
+
+    // FNV-1a (64-bit) hash update
+    inline void fnv1a_add
+            (const void *data, std::size_t n_bytes,
+             il::io_t, std::uint64_t &hash) {
+        const unsigned char *p = static_cast<const unsigned char *>(data);
+        for (std::size_t i = 0; i < n_bytes; ++i) {
+            hash ^= p[i];
+            hash *= 1099511628211ULL;
+        }
+    }
+
+    std::uint64_t make_matrix_key
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl) {
+// This function hashes everything the VC matrix depends on
+// (array sizes included, so that different shapes do not collide)
+        std::uint64_t hash = 14695981039346656037ULL;
+        fnv1a_add(&asm_cache_version, sizeof(asm_cache_version),
+                  il::io, hash);
+        fnv1a_add(&mu, sizeof(double), il::io, hash);
+        fnv1a_add(&nu, sizeof(double), il::io, hash);
+        fnv1a_add(&n_par.beta, sizeof(double), il::io, hash);
+        fnv1a_add(&n_par.self_blk_tol, sizeof(double), il::io, hash);
+        std::int64_t n_p[2] = {n_par.tip_type, n_par.is_dd_local ? 1 : 0};
+        fnv1a_add(n_p, sizeof(n_p), il::io, hash);
+
+        std::int64_t sz[2] = {mesh.nods.size(1), mesh.conn.size(1)};
+        fnv1a_add(sz, sizeof(sz), il::io, hash);
+        for (il::int_t n = 0; n < mesh.nods.size(1); ++n) {
+            for (il::int_t k = 0; k < 3; ++k) {
+                double x = mesh.nods(k, n);
+                fnv1a_add(&x, sizeof(double), il::io, hash);
+            }
+        }
+        for (il::int_t el = 0; el < mesh.conn.size(1); ++el) {
+            for (il::int_t k = 0; k < 3; ++k) {
+                std::int64_t n = mesh.conn(k, el);
+                fnv1a_add(&n, sizeof(n), il::io, hash);
+            }
+        }
+        // (nothing for uniform meshes, as in the older keys)
+        for (il::int_t n = 0; n < mesh.vert_wts.size(); ++n) {
+            double w = mesh.vert_wts[n];
+            fnv1a_add(&w, sizeof(double), il::io, hash);
+        }
+
+        std::int64_t dh_sz[3] = {dof_hndl.n_dof, dof_hndl.dof_h.size(0),
+                                 dof_hndl.dof_h.size(1)};
+        fnv1a_add(dh_sz, sizeof(dh_sz), il::io, hash);
+        for (il::int_t j = 0; j < dof_hndl.dof_h.size(1); ++j) {
+            for (il::int_t el = 0; el < dof_hndl.dof_h.size(0); ++el) {
+                std::int64_t d = dof_hndl.dof_h(el, j);
+                fnv1a_add(&d, sizeof(d), il::io, hash);
+            }
+        }
+        return hash;
+    }
+
+    il::Array2D<double> make_3dbem_matrix_vc_cached
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const std::string &cache_dir,
+             il::io_t, DoF_Handle_T &dof_hndl) {
+// This function looks up the cache file named after the key;
+// the key stored in the file is compared as well
+        if (cache_dir.empty()) {
+            return make_3dbem_matrix_vc(mu, nu, mesh, n_par,
+                                        il::io, dof_hndl);
+        }
+        if (dof_hndl.n_dof == 0 || dof_hndl.dof_h.size(0) == 0) {
+            dof_hndl = make_dof_h_crack(mesh, 2, n_par.tip_type);
+        }
+
+        std::uint64_t key = make_matrix_key(mu, nu, mesh, n_par, dof_hndl);
+        // key as a signed integer (to be stored) and in hex (file name)
+        il::int_t key_i;
+        std::memcpy(&key_i, &key, sizeof(key_i));
+        char key_h[17];
+        std::snprintf(key_h, sizeof(key_h), "%016llx",
+                      static_cast<unsigned long long>(key));
+        std::string f_path = cache_dir;
+        if (f_path.back() != '/') {
+            f_path += '/';
+        }
+        f_path += std::string{"vc_matrix_"} + key_h + ".bin";
+
+        // cache hit: the matrix is copied once, from the mapped file
+        {
+            Bin_Reader b_r{f_path, mc_kind, true};
+            il::int_t f_key, n0, n1;
+            const double *m_v = b_r.view_f64("matrix", il::io, n0, n1);
+            if (b_r.is_ok() && b_r.get("key", il::io, f_key) &&
+                f_key == key_i && m_v != nullptr &&
+                n0 == dof_hndl.n_dof + 1 && n1 == dof_hndl.n_dof + 1) {
+                il::Array2D<double> matrix{n0, n1};
+                for (il::int_t j = 0; j < n1; ++j) {
+                    std::memcpy(&matrix(0, j), m_v + n0 * j,
+                                sizeof(double) *
+                                static_cast<std::size_t>(n0));
+                }
+                return matrix;
+            }
+        }
+
+        // cache miss: assembly & storing
+        // (a failure to store is not an error)
+        il::Array2D<double> matrix = make_3dbem_matrix_vc
+                (mu, nu, mesh, n_par, il::io, dof_hndl);
+        std::string t_path = f_path + ".tmp";
+        Bin_Writer b_w{t_path, mc_kind, asm_cache_version};
+        b_w.add("key", key_i);
+        b_w.add("matrix", matrix);
+        if (b_w.close()) {
+            std::rename(t_path.c_str(), f_path.c_str());
+        } else {
+            std::remove(t_path.c_str());
+        }
+        return matrix;
+    }
+
+}
@@ -0,0 +1,51 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Persistent (on-disk) cache of assembled BEM matrices
+
+#ifndef INC_HFPX3D_MATRIX_CACHE_H
+#define INC_HFPX3D_MATRIX_CACHE_H
+
+#include <cstdint>
+#include <string>
+#include <il/Array2D.h>
+#include "mesh_utilities.h"
+
+namespace hfp3d {
+
+    // version of the assembly code; cached matrices with another
+    // version are not used (it is hashed into the key); to be increased
+    // with every change of the kernels, the integration or the key layout
+    // 1: initial;
+    // 2: generated kernels, real-arithmetic accumulation, reference-element
+    //    SF integrals, shared self-blocks, vertex weights in the key
+    const std::uint32_t asm_cache_version = 2;
+
+    // Hash (64-bit FNV-1a) of the mesh (nods, first 3 rows of conn),
+    // elastic constants, numerical parameters and the DoF handle
+    std::uint64_t make_matrix_key
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl);
+
+    // Volume Control matrix (see make_3dbem_matrix_vc) taken from
+    // the cache directory (memory-mapped) if the key matches,
+    // otherwise assembled and stored there;
+    // no caching if cache_dir is empty
+    il::Array2D<double> make_3dbem_matrix_vc_cached
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const std::string &cache_dir,
+             il::io_t, DoF_Handle_T &dof_hndl);
+
+}
+
+#endif //INC_HFPX3D_MATRIX_CACHE_H
@@ -0,0 +1,468 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include "element_utilities.h"
+#include "tensor_utilities.h"
+#include "system_assembly.h"
+#include "bordered_solver.h"
+#include "p_multigrid.h"
+#include "mesh_continuation.h"
+
+namespace hfp3d {
+
+    namespace {
+
+        il::StaticArray2D<double, 3, 3> el_vert_of
+                (const Mesh_Geom_T &mesh, il::int_t el) {
+            il::StaticArray2D<double, 3, 3> el_vert;
+            for (il::int_t j = 0; j < 3; ++j) {
+                il::int_t n = mesh.conn(j, el);
+                for (il::int_t k = 0; k < 3; ++k) {
+                    el_vert(k, j) = mesh.nods(k, n);
+                }
+            }
+            return el_vert;
+        }
+
+        // vertices' weights (see Mesh_Geom_T)
+        il::StaticArray<double, 3> el_wts_of
+                (const Mesh_Geom_T &mesh, il::int_t el) {
+            il::StaticArray<double, 3> el_wts{1.0};
+            if (mesh.vert_wts.size() > 0) {
+                for (il::int_t j = 0; j < 3; ++j) {
+                    el_wts[j] = mesh.vert_wts[mesh.conn(j, el)];
+                }
+            }
+            return el_wts;
+        }
+
+        // the nodes of dst located on src, with the values of the SF
+        // of the source element at each node
+        void locate_mesh_nodes
+                (const Mesh_Geom_T &src,
+                 const El_BVH_T &src_bvh,
+                 const Mesh_Geom_T &dst,
+                 il::io_t,
+                 il::Array<il::int_t> &src_el,
+                 il::Array2D<double> &src_sf) {
+            const il::int_t num_ele = dst.conn.size(1);
+            src_el = il::Array<il::int_t>{num_ele * 6};
+            src_sf = il::Array2D<double>{num_ele * 6, 6};
+            for (il::int_t el = 0; el < num_ele; ++el) {
+                // nodes' coordinates (CP with beta = 0)
+                il::StaticArray<il::StaticArray<double, 3>, 6> nod_crd =
+                        el_cp_nonuniform(el_vert_of(dst, el),
+                                         el_wts_of(dst, el), 0.0);
+                for (int n = 0; n < 6; ++n) {
+                    Mesh_Pt_Loc_T loc = locate_mesh_pt
+                            (src, src_bvh, nod_crd[n]);
+                    il::StaticArray<double, 6> sf = el_p2_sf_at_bc
+                            (loc.bc, el_wts_of(src, loc.el));
+                    src_el[el * 6 + n] = loc.el;
+                    for (int m = 0; m < 6; ++m) {
+                        src_sf(el * 6 + n, m) = sf[m];
+                    }
+                }
+            }
+        }
+
+        // interpolation of a node-wise field (column c of field);
+        // bounded by the nodal values of the source element if is_bounded
+        il::Array<double> interpolate_nodal
+                (const il::Array<il::int_t> &src_el,
+                 const il::Array2D<double> &src_sf,
+                 const il::Array2D<double> &field,
+                 il::int_t c,
+                 bool is_bounded) {
+            const il::int_t n_nod = src_el.size();
+            il::Array<double> val{n_nod, 0.0};
+            for (il::int_t i = 0; i < n_nod; ++i) {
+                const il::int_t s_el = src_el[i];
+                double v = 0.0;
+                double v_min = field(s_el * 6, c), v_max = v_min;
+                for (int m = 0; m < 6; ++m) {
+                    double f_m = field(s_el * 6 + m, c);
+                    v += src_sf(i, m) * f_m;
+                    v_min = std::min(v_min, f_m);
+                    v_max = std::max(v_max, f_m);
+                }
+                val[i] = is_bounded ? std::min(std::max(v, v_min), v_max) : v;
+            }
+            return val;
+        }
+
+        il::Array<double> transfer_bounded
+                (const il::Array<il::int_t> &src_el,
+                 const il::Array2D<double> &src_sf,
+                 const il::Array<double> &f) {
+            if (f.size() == 0) {
+                return il::Array<double>{};
+            }
+            IL_EXPECT_FAST(f.size() % 6 == 0);
+            il::Array2D<double> field{f.size(), 1};
+            for (il::int_t i = 0; i < f.size(); ++i) {
+                field(i, 0) = f[i];
+            }
+            return interpolate_nodal(src_el, src_sf, field, 0, true);
+        }
+
+    }
+
+    Mesh_Geom_T refine_mesh_uniform(const Mesh_Geom_T &mesh) {
+// The children of element (a_0, a_1, a_2) with the mid-edge nodes m_v
+// (across the v-th vertex) are (a_0, m_2, m_1), (m_2, a_1, m_0),
+// (m_1, m_0, a_2), and (m_0, m_1, m_2); all have the parent's orientation.
+// For a graded mesh, m_v are the parent's edge nodes (see el_cp_nonuniform)
+// with the weight sqrt(w_a * w_b) for the edge (a, b)
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        const il::int_t n_rows = mesh.conn.size(0);
+        const il::int_t num_ele = mesh.conn.size(1);
+        const il::int_t n_nods = mesh.nods.size(1);
+        const Mesh_Topo_T topo = (mesh.topo.n_edges > 0) ? mesh.topo :
+                                 make_mesh_topo(mesh.conn, n_nods);
+
+        Mesh_Geom_T r_mesh;
+        r_mesh.nods = il::Array2D<double>{3, n_nods + topo.n_edges};
+        for (il::int_t n = 0; n < n_nods; ++n) {
+            for (il::int_t k = 0; k < 3; ++k) {
+                r_mesh.nods(k, n) = mesh.nods(k, n);
+            }
+        }
+        const bool is_graded = mesh.vert_wts.size() > 0;
+        if (is_graded) {
+            r_mesh.vert_wts = il::Array<double>{n_nods + topo.n_edges};
+            for (il::int_t n = 0; n < n_nods; ++n) {
+                r_mesh.vert_wts[n] = mesh.vert_wts[n];
+            }
+        }
+        for (il::int_t e = 0; e < topo.n_edges; ++e) {
+            il::int_t n_a = topo.edges(0, e), n_b = topo.edges(1, e);
+            double w_a = 1.0, w_b = 1.0;
+            if (is_graded) {
+                w_a = mesh.vert_wts[n_a];
+                w_b = mesh.vert_wts[n_b];
+                r_mesh.vert_wts[n_nods + e] = std::sqrt(w_a * w_b);
+            }
+            for (il::int_t k = 0; k < 3; ++k) {
+                r_mesh.nods(k, n_nods + e) =
+                        (w_a * mesh.nods(k, n_a) + w_b * mesh.nods(k, n_b)) /
+                        (w_a + w_b);
+            }
+        }
+
+        r_mesh.conn = il::Array2D<il::int_t>{n_rows, 4 * num_ele};
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            il::StaticArray<il::int_t, 3> a, m;
+            for (int v = 0; v < 3; ++v) {
+                a[v] = mesh.conn(v, el);
+                m[v] = n_nods + topo.el_edges(v, el);
+            }
+            for (int c = 0; c < 3; ++c) {
+                // the child at the c-th vertex
+                il::int_t r_el = 4 * el + c;
+                r_mesh.conn(c, r_el) = a[c];
+                r_mesh.conn((c + 1) % 3, r_el) = m[(c + 2) % 3];
+                r_mesh.conn((c + 2) % 3, r_el) = m[(c + 1) % 3];
+            }
+            for (int v = 0; v < 3; ++v) {
+                r_mesh.conn(v, 4 * el + 3) = m[v];
+            }
+            for (il::int_t j = 3; j < n_rows; ++j) {
+                for (il::int_t c = 0; c < 4; ++c) {
+                    r_mesh.conn(j, 4 * el + c) = mesh.conn(j, el);
+                }
+            }
+        }
+        r_mesh.topo = make_mesh_topo(r_mesh.conn, r_mesh.nods.size(1));
+        return r_mesh;
+    }
+
+    Mesh_Pt_Loc_T locate_mesh_pt
+            (const Mesh_Geom_T &mesh,
+             const El_BVH_T &bvh,
+             const il::StaticArray<double, 3> &pt) {
+// This function finds the element closest to the point
+// and the barycentric coordinates of the point's projection
+// on the plane of the element; the points outside the element
+// (e.g. at a curved boundary of the mesh) are shifted to the element
+        Mesh_Pt_Loc_T loc;
+        il::Array<il::int_t> found = bvh_knn_query(mesh, bvh, pt, 1);
+        IL_EXPECT_FAST(found.size() == 1);
+        loc.el = found[0];
+        il::StaticArray2D<double, 3, 3> el_vert = el_vert_of(mesh, loc.el);
+
+        // least squares: pt - v_0 = l_1 * (v_1 - v_0) + l_2 * (v_2 - v_0)
+        double g_11 = 0.0, g_12 = 0.0, g_22 = 0.0, r_1 = 0.0, r_2 = 0.0;
+        for (int k = 0; k < 3; ++k) {
+            double e_1 = el_vert(k, 1) - el_vert(k, 0);
+            double e_2 = el_vert(k, 2) - el_vert(k, 0);
+            double d = pt[k] - el_vert(k, 0);
+            g_11 += e_1 * e_1;
+            g_12 += e_1 * e_2;
+            g_22 += e_2 * e_2;
+            r_1 += d * e_1;
+            r_2 += d * e_2;
+        }
+        double det = g_11 * g_22 - g_12 * g_12;
+        IL_EXPECT_FAST(det > 0.0);
+        loc.bc[1] = (r_1 * g_22 - r_2 * g_12) / det;
+        loc.bc[2] = (r_2 * g_11 - r_1 * g_12) / det;
+        loc.bc[0] = 1.0 - loc.bc[1] - loc.bc[2];
+
+        double s = 0.0;
+        for (int v = 0; v < 3; ++v) {
+            loc.bc[v] = std::max(loc.bc[v], 0.0);
+            s += loc.bc[v];
+        }
+        for (int v = 0; v < 3; ++v) {
+            loc.bc[v] /= s;
+        }
+        return loc;
+    }
+
+    il::Array2D<double> transfer_nodal_field
+            (const Mesh_Geom_T &src,
+             const El_BVH_T &src_bvh,
+             const il::Array2D<double> &field,
+             const Mesh_Geom_T &dst) {
+        IL_EXPECT_FAST(field.size(0) == src.conn.size(1) * 6);
+        il::Array<il::int_t> src_el;
+        il::Array2D<double> src_sf;
+        locate_mesh_nodes(src, src_bvh, dst, il::io, src_el, src_sf);
+        const il::int_t n_comp = field.size(1);
+        il::Array2D<double> dst_field{src_el.size(), n_comp};
+        for (il::int_t c = 0; c < n_comp; ++c) {
+            il::Array<double> val = interpolate_nodal
+                    (src_el, src_sf, field, c, false);
+            for (il::int_t i = 0; i < val.size(); ++i) {
+                dst_field(i, c) = val[i];
+            }
+        }
+        return dst_field;
+    }
+
+    il::Array<double> transfer_nodal_field
+            (const Mesh_Geom_T &src,
+             const El_BVH_T &src_bvh,
+             const il::Array<double> &field,
+             const Mesh_Geom_T &dst) {
+        il::Array2D<double> f_2d{field.size(), 1};
+        for (il::int_t i = 0; i < field.size(); ++i) {
+            f_2d(i, 0) = field[i];
+        }
+        il::Array2D<double> dst_f_2d =
+                transfer_nodal_field(src, src_bvh, f_2d, dst);
+        il::Array<double> dst_field{dst_f_2d.size(0)};
+        for (il::int_t i = 0; i < dst_field.size(); ++i) {
+            dst_field[i] = dst_f_2d(i, 0);
+        }
+        return dst_field;
+    }
+
+    Frac_State_T transfer_frac_state
+            (const Mesh_Geom_T &src,
+             const El_BVH_T &src_bvh,
+             const Frac_State_T &f_state,
+             const Mesh_Geom_T &dst) {
+// The bounds keep the interpolated "damage" & friction within
+// the physical range (the 2nd order interpolation overshoots)
+        il::Array<il::int_t> src_el;
+        il::Array2D<double> src_sf;
+        locate_mesh_nodes(src, src_bvh, dst, il::io, src_el, src_sf);
+        Frac_State_T dst_state;
+        dst_state.mr_open = transfer_bounded
+                (src_el, src_sf, f_state.mr_open);
+        dst_state.mr_slip = transfer_bounded
+                (src_el, src_sf, f_state.mr_slip);
+        dst_state.friction_coef = transfer_bounded
+                (src_el, src_sf, f_state.friction_coef);
+        dst_state.slip_cohesion = transfer_bounded
+                (src_el, src_sf, f_state.slip_cohesion);
+        dst_state.open_cohesion = transfer_bounded
+                (src_el, src_sf, f_state.open_cohesion);
+        return dst_state;
+    }
+
+    il::Array<double> transfer_vc_solution
+            (const Mesh_Geom_T &src,
+             const El_BVH_T &src_bvh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_src,
+             const il::Array<double> &x_src,
+             const Mesh_Geom_T &dst,
+             const DoF_Handle_T &dof_dst) {
+// DD are interpolated in the reference coordinate system;
+// the values at shared DoF of dst (see make_dof_h_conforming)
+// are averaged over the element nodes
+        const il::int_t src_n_el = src.conn.size(1);
+        const il::int_t dst_n_el = dst.conn.size(1);
+        IL_EXPECT_FAST(dof_src.dof_h.size(0) == src_n_el);
+        IL_EXPECT_FAST(dof_src.dof_h.size(1) == 18);
+        IL_EXPECT_FAST(dof_dst.dof_h.size(0) == dst_n_el);
+        IL_EXPECT_FAST(dof_dst.dof_h.size(1) == 18);
+        IL_EXPECT_FAST(x_src.size() == dof_src.n_dof + 1);
+
+        // nodal DD of the source mesh (reference coordinates)
+        il::Array2D<double> dd_src{src_n_el * 6, 3, 0.0};
+        for (il::int_t el = 0; el < src_n_el; ++el) {
+            il::StaticArray2D<double, 3, 3> r_tensor =
+                    make_el_r_tensor(el_vert_of(src, el));
+            for (int n = 0; n < 6; ++n) {
+                il::StaticArray<double, 3> dd{0.0};
+                for (int k = 0; k < 3; ++k) {
+                    il::int_t dof = dof_src.dof_h(el, 3 * n + k);
+                    if (dof >= 0) dd[k] = x_src[dof];
+                }
+                if (n_par.is_dd_local) {
+                    dd = il::dot(r_tensor, il::Blas::transpose, dd);
+                }
+                for (int k = 0; k < 3; ++k) {
+                    dd_src(el * 6 + n, k) = dd[k];
+                }
+            }
+        }
+
+        il::Array2D<double> dd_dst =
+                transfer_nodal_field(src, src_bvh, dd_src, dst);
+
+        const il::int_t n_dof = dof_dst.n_dof;
+        il::Array<double> x{n_dof + 1, 0.0};
+        il::Array<double> n_nod{n_dof, 0.0};
+        for (il::int_t el = 0; el < dst_n_el; ++el) {
+            il::StaticArray2D<double, 3, 3> r_tensor =
+                    make_el_r_tensor(el_vert_of(dst, el));
+            for (int n = 0; n < 6; ++n) {
+                il::StaticArray<double, 3> dd;
+                for (int k = 0; k < 3; ++k) {
+                    dd[k] = dd_dst(el * 6 + n, k);
+                }
+                if (n_par.is_dd_local) {
+                    dd = il::dot(r_tensor, dd);
+                }
+                for (int k = 0; k < 3; ++k) {
+                    il::int_t dof = dof_dst.dof_h(el, 3 * n + k);
+                    if (dof >= 0) {
+                        x[dof] += dd[k];
+                        n_nod[dof] += 1.0;
+                    }
+                }
+            }
+        }
+        for (il::int_t j = 0; j < n_dof; ++j) {
+            if (n_nod[j] > 0.0) x[j] /= n_nod[j];
+        }
+
+        // pressure
+        x[n_dof] = x_src[dof_src.n_dof];
+        return x;
+    }
+
+    il::Array<double> solve_vc_continuation
+            (double mu, double nu,
+             const il::Array<Mesh_Geom_T> &mesh_l,
+             const Num_Param_T &n_par,
+             const il::StaticArray<double, 6> &s_inf,
+             double volume,
+             const il::Array<int> &c_order,
+             double rel_tol,
+             int max_it,
+             il::io_t,
+             DoF_Handle_T &dof_hndl,
+             il::Array<int> &n_it) {
+// The tractions at the CP are -dot(s_inf, normal) (reference coordinates);
+// n_it[0] = 0 (direct solution)
+        IL_EXPECT_FAST(mesh_l.size() >= 1);
+        const int restart = 60;
+        const il::int_t leaf_size = 8;
+        n_it = il::Array<int>{mesh_l.size(), 0};
+
+        il::Array<double> x{};
+        DoF_Handle_T prev_dof_hndl{};
+        for (il::int_t l = 0; l < mesh_l.size(); ++l) {
+            const Mesh_Geom_T &mesh = mesh_l[l];
+            const il::int_t num_ele = mesh.conn.size(1);
+            dof_hndl = DoF_Handle_T{};
+            il::Array2D<double> matrix = make_3dbem_matrix_vc
+                    (mu, nu, mesh, n_par, il::io, dof_hndl);
+
+            // RHS
+            il::Array<double> t_cp{num_ele * 18};
+            for (il::int_t el = 0; el < num_ele; ++el) {
+                il::StaticArray2D<double, 3, 3> r_tensor =
+                        make_el_r_tensor(el_vert_of(mesh, el));
+                il::StaticArray<double, 3> nv_el;
+                for (int j = 0; j < 3; ++j) {
+                    nv_el[j] = -r_tensor(2, j);
+                }
+                il::StaticArray<double, 3> ti_el = nv_dot_sim(nv_el, s_inf);
+                for (int n = 0; n < 6; ++n) {
+                    for (int k = 0; k < 3; ++k) {
+                        t_cp[el * 18 + 3 * n + k] = -ti_el[k];
+                    }
+                }
+            }
+            il::Array<double> rhs =
+                    make_vc_rhs_from_cp(dof_hndl, t_cp, volume);
+
+            if (l == 0) {
+                VC_Solver solver{matrix};
+                x = solver.solve(rhs);
+            } else {
+                // the transferred solution is used as the initial iterate
+                // only with the preconditioner, and only if it reduces
+                // the preconditioned residual (otherwise x_0 = 0):
+                // without it, GMRES takes more iterations from x_0
+                // than from 0 (see the header)
+                const il::int_t n = rhs.size();
+                il::Array<double> x_0{n, 0.0};
+                std::unique_ptr<P_Multigrid_Prec> prec{};
+                if (c_order.size() > 0) {
+                    prec.reset(new P_Multigrid_Prec
+                            (mu, nu, mesh, n_par, matrix, dof_hndl, c_order));
+                    El_BVH_T bvh = make_el_bvh(mesh_l[l - 1], leaf_size);
+                    il::Array<double> x_t = transfer_vc_solution
+                            (mesh_l[l - 1], bvh, n_par, prev_dof_hndl, x,
+                             mesh, dof_hndl);
+                    // rhs - dot(matrix, x_t), column-wise
+                    il::Array<double> r_t = rhs;
+                    for (il::int_t j = 0; j < n; ++j) {
+                        const double x_j = x_t[j];
+                        if (x_j == 0.0) continue;
+                        for (il::int_t i = 0; i < n; ++i) {
+                            r_t[i] -= matrix(i, j) * x_j;
+                        }
+                    }
+                    il::Array<double> p_r = prec->apply(r_t);
+                    il::Array<double> p_f = prec->apply(rhs);
+                    double r_2 = 0.0, f_2 = 0.0;
+                    for (il::int_t i = 0; i < n; ++i) {
+                        r_2 += p_r[i] * p_r[i];
+                        f_2 += p_f[i] * p_f[i];
+                    }
+                    if (r_2 < f_2) {
+                        x_0 = std::move(x_t);
+                    }
+                }
+                x = gmres_solve(matrix, rhs, x_0, prec.get(), rel_tol,
+                                max_it, restart, il::io, n_it[l]);
+            }
+            prev_dof_hndl = dof_hndl;
+        }
+        return x;
+    }
+
+}
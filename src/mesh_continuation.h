@@ -0,0 +1,113 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Transfer of the solution between meshes of the same fracture
+// (coarse to fine): the nodes of the target mesh are located
+// on the source mesh (see bvh_knn_query), the node-wise values
+// are interpolated by the 2nd order SF of the source element
+// (exactly for nested meshes, see refine_mesh_uniform);
+// continuation (nested meshes) solver of the VC problem
+
+#ifndef INC_HFPX3D_MESH_CONTINUATION_H
+#define INC_HFPX3D_MESH_CONTINUATION_H
+
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include "mesh_utilities.h"
+#include "spatial_index.h"
+#include "cohesion_friction.h"
+
+namespace hfp3d {
+
+    // Uniform refinement: each element is split into 4 by the mid-edge
+    // (edge, for graded meshes) nodes; new nodes follow the old ones
+    // in the order of mesh.topo edges; the extra rows of conn (if any)
+    // are inherited
+    Mesh_Geom_T refine_mesh_uniform(const Mesh_Geom_T &mesh);
+
+    // location of a point on a mesh: the closest element
+    // and the barycentric coordinates of the point's projection
+    // on the element (clamped to the element)
+    struct Mesh_Pt_Loc_T {
+        il::int_t el = -1;
+        il::StaticArray<double, 3> bc{0.0};
+    };
+
+    Mesh_Pt_Loc_T locate_mesh_pt
+            (const Mesh_Geom_T &mesh,
+             const El_BVH_T &bvh,
+             const il::StaticArray<double, 3> &pt);
+
+    // Node-wise field (see Mesh_Data_T: row el * 6 + n for the n-th node
+    // of element el, a column per component) interpolated
+    // from the source mesh (src, with its BVH) to the nodes of dst
+    il::Array2D<double> transfer_nodal_field
+            (const Mesh_Geom_T &src,
+             const El_BVH_T &src_bvh,
+             const il::Array2D<double> &field,
+             const Mesh_Geom_T &dst);
+
+    // The same for a scalar field (e.g. pressure)
+    il::Array<double> transfer_nodal_field
+            (const Mesh_Geom_T &src,
+             const El_BVH_T &src_bvh,
+             const il::Array<double> &field,
+             const Mesh_Geom_T &dst);
+
+    // Node-wise "damage state" & friction-cohesion; the interpolated
+    // values are bounded by the nodal values of the source element;
+    // empty arrays stay empty
+    Frac_State_T transfer_frac_state
+            (const Mesh_Geom_T &src,
+             const El_BVH_T &src_bvh,
+             const Frac_State_T &f_state,
+             const Mesh_Geom_T &dst);
+
+    // Solution of the VC system (DD & pressure, see make_3dbem_matrix_vc)
+    // transferred to the DoF of dst (dof_dst); DD are converted
+    // to local coordinates of dst elements if n_par.is_dd_local
+    il::Array<double> transfer_vc_solution
+            (const Mesh_Geom_T &src,
+             const El_BVH_T &src_bvh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_src,
+             const il::Array<double> &x_src,
+             const Mesh_Geom_T &dst,
+             const DoF_Handle_T &dof_dst);
+
+    // The VC problem (stress at infinity s_inf, fluid volume)
+    // solved on a sequence of meshes (mesh_l, coarse to fine):
+    // directly on the coarsest mesh, then by GMRES (see gmres_solve),
+    // p-multigrid preconditioned if c_order is not empty
+    // (see P_Multigrid_Prec); returns the solution on the finest mesh,
+    // its DoF handle, and the numbers of GMRES iterations per mesh.
+    // With the preconditioner, GMRES starts from the solution transferred
+    // from the previous mesh if its preconditioned residual is smaller
+    // than the preconditioned RHS, from 0 otherwise; without it,
+    // always from 0: the residual of the transferred solution
+    // is dominated by the elements at the tip (the interpolation error
+    // amplified by the hypersingular operator), and plain GMRES
+    // takes more iterations from it than from 0
+    il::Array<double> solve_vc_continuation
+            (double mu, double nu,
+             const il::Array<Mesh_Geom_T> &mesh_l,
+             const Num_Param_T &n_par,
+             const il::StaticArray<double, 6> &s_inf,
+             double volume,
+             const il::Array<int> &c_order,
+             double rel_tol,
+             int max_it,
+             il::io_t,
+             DoF_Handle_T &dof_hndl,
+             il::Array<int> &n_it);
+
+}
+
+#endif //INC_HFPX3D_MESH_CONTINUATION_H
@@ -14,6 +14,7 @@
 #include <il/StaticArray2D.h>
 #include <il/io/numpy.h>
 #include "mesh_file_io.h"
+#include "mesh_topology.h"
 
 namespace hfp3d {
 
@@ -53,6 +54,9 @@ namespace hfp3d {
                 }
             }
         }
+
+        // edge-to-element adjacency
+        mesh.topo = make_mesh_topo(mesh.conn, mesh.nods.size(1));
     }
 
     void load_mesh_from_numpy_64
@@ -85,6 +89,9 @@ namespace hfp3d {
                 }
             }
         }
+
+        // edge-to-element adjacency
+        mesh.topo = make_mesh_topo(mesh.conn, mesh.nods.size(1));
     }
 
 }
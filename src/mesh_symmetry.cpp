@@ -0,0 +1,721 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include <il/linear_algebra.h>
+#include "element_utilities.h"
+#include "system_assembly.h"
+#include "mesh_symmetry.h"
+
+namespace hfp3d {
+
+    namespace {
+
+        typedef il::StaticArray2D<double, 3, 3> Mat3_T;
+
+        Mat3_T mat3_dot(const Mat3_T &a, const Mat3_T &b) {
+            Mat3_T c{0.0};
+            for (int j = 0; j < 3; ++j) {
+                for (int k = 0; k < 3; ++k) {
+                    for (int l = 0; l < 3; ++l) {
+                        c(k, j) += a(k, l) * b(l, j);
+                    }
+                }
+            }
+            return c;
+        }
+
+        double mat3_diff(const Mat3_T &a, const Mat3_T &b) {
+            double d = 0.0;
+            for (int j = 0; j < 3; ++j) {
+                for (int k = 0; k < 3; ++k) {
+                    d = std::max(d, std::fabs(a(k, j) - b(k, j)));
+                }
+            }
+            return d;
+        }
+
+        // reflection (w.r. to the plane normal to unit n): I - 2 n n^T,
+        // or rotation about the unit axis n by angle phi
+        Mat3_T make_reflection(const il::StaticArray<double, 3> &n) {
+            Mat3_T g{0.0};
+            for (int j = 0; j < 3; ++j) {
+                for (int k = 0; k < 3; ++k) {
+                    g(k, j) = ((j == k) ? 1.0 : 0.0) - 2.0 * n[k] * n[j];
+                }
+            }
+            return g;
+        }
+
+        Mat3_T make_rotation(const il::StaticArray<double, 3> &n, double phi) {
+            double c = std::cos(phi), s = std::sin(phi);
+            Mat3_T g;
+            for (int j = 0; j < 3; ++j) {
+                for (int k = 0; k < 3; ++k) {
+                    g(k, j) = ((j == k) ? c : 0.0) + (1.0 - c) * n[k] * n[j];
+                }
+            }
+            g(0, 1) -= s * n[2];
+            g(1, 0) += s * n[2];
+            g(0, 2) += s * n[1];
+            g(2, 0) -= s * n[1];
+            g(1, 2) -= s * n[0];
+            g(2, 1) += s * n[0];
+            return g;
+        }
+
+        // eigen-decomposition of a symmetric 3x3 matrix (Jacobi);
+        // eigenvectors are the columns of v
+        void sym3_eigen
+                (Mat3_T a,
+                 il::io_t, il::StaticArray<double, 3> &lambda, Mat3_T &v) {
+            v = Mat3_T{0.0};
+            for (int k = 0; k < 3; ++k) v(k, k) = 1.0;
+            for (int sweep = 0; sweep < 50; ++sweep) {
+                double off = std::fabs(a(0, 1)) + std::fabs(a(0, 2)) +
+                             std::fabs(a(1, 2));
+                if (off == 0.0) break;
+                for (int p = 0; p < 2; ++p) {
+                    for (int q = p + 1; q < 3; ++q) {
+                        if (a(p, q) == 0.0) continue;
+                        double theta = 0.5 * (a(q, q) - a(p, p)) / a(p, q);
+                        double t = ((theta >= 0.0) ? 1.0 : -1.0) /
+                                   (std::fabs(theta) +
+                                    std::sqrt(theta * theta + 1.0));
+                        double c = 1.0 / std::sqrt(t * t + 1.0), s = t * c;
+                        for (int k = 0; k < 3; ++k) {
+                            double akp = a(k, p), akq = a(k, q);
+                            a(k, p) = c * akp - s * akq;
+                            a(k, q) = s * akp + c * akq;
+                        }
+                        for (int k = 0; k < 3; ++k) {
+                            double apk = a(p, k), aqk = a(q, k);
+                            a(p, k) = c * apk - s * aqk;
+                            a(q, k) = s * apk + c * aqk;
+                        }
+                        for (int k = 0; k < 3; ++k) {
+                            double vkp = v(k, p), vkq = v(k, q);
+                            v(k, p) = c * vkp - s * vkq;
+                            v(k, q) = s * vkp + c * vkq;
+                        }
+                    }
+                }
+            }
+            for (int k = 0; k < 3; ++k) lambda[k] = a(k, k);
+        }
+
+        // nodes sorted by the distance to the center (for the search
+        // of the image of a node)
+        struct Node_Search_T {
+            const Mesh_Geom_T *mesh;
+            il::StaticArray<double, 3> center;
+            double tol;
+            std::vector<std::pair<double, il::int_t>> r_n;
+        };
+
+        double dist_3(const il::StaticArray<double, 3> &a,
+                      const il::StaticArray<double, 3> &b) {
+            il::StaticArray<double, 3> d;
+            for (int k = 0; k < 3; ++k) d[k] = a[k] - b[k];
+            return l2norm(d);
+        }
+
+        il::int_t find_node
+                (const Node_Search_T &ns,
+                 const il::StaticArray<double, 3> &y) {
+            double r = dist_3(y, ns.center);
+            auto it = std::lower_bound
+                    (ns.r_n.begin(), ns.r_n.end(),
+                     std::make_pair(r - ns.tol, il::int_t{-1}));
+            for (; it != ns.r_n.end() && it->first <= r + ns.tol; ++it) {
+                il::StaticArray<double, 3> x;
+                for (int k = 0; k < 3; ++k) {
+                    x[k] = ns.mesh->nods(k, it->second);
+                }
+                if (dist_3(x, y) <= ns.tol) return it->second;
+            }
+            return -1;
+        }
+
+        std::uint64_t el_key(il::int_t a, il::int_t b, il::int_t c,
+                             il::int_t n) {
+            il::int_t s[3] = {a, b, c};
+            std::sort(s, s + 3);
+            return (static_cast<std::uint64_t>(s[0]) * n +
+                    static_cast<std::uint64_t>(s[1])) * n +
+                   static_cast<std::uint64_t>(s[2]);
+        }
+
+        // images of the elements under g (empty if g is not a symmetry)
+        il::Array<il::int_t> map_elements
+                (const Node_Search_T &ns,
+                 const std::unordered_map<std::uint64_t, il::int_t> &el_m,
+                 const Mat3_T &g) {
+            const Mesh_Geom_T &mesh = *ns.mesh;
+            const il::int_t n_nod = mesh.nods.size(1);
+            const il::int_t n_el = mesh.conn.size(1);
+            il::Array<il::int_t> n_map{n_nod, -1};
+            for (il::int_t n = 0; n < n_nod; ++n) {
+                il::StaticArray<double, 3> y{0.0};
+                for (int k = 0; k < 3; ++k) {
+                    for (int l = 0; l < 3; ++l) {
+                        y[k] += g(k, l) * (mesh.nods(l, n) - ns.center[l]);
+                    }
+                }
+                for (int k = 0; k < 3; ++k) y[k] += ns.center[k];
+                n_map[n] = find_node(ns, y);
+                if (n_map[n] < 0) return il::Array<il::int_t>{};
+                // the edge nodes of graded meshes have to map as well
+                if (mesh.vert_wts.size() > 0 &&
+                    mesh.vert_wts[n_map[n]] != mesh.vert_wts[n]) {
+                    return il::Array<il::int_t>{};
+                }
+            }
+            il::Array<il::int_t> e_map{n_el};
+            for (il::int_t el = 0; el < n_el; ++el) {
+                auto it = el_m.find(el_key(n_map[mesh.conn(0, el)],
+                                           n_map[mesh.conn(1, el)],
+                                           n_map[mesh.conn(2, el)], n_nod));
+                if (it == el_m.end()) return il::Array<il::int_t>{};
+                e_map[el] = it->second;
+            }
+            return e_map;
+        }
+
+        // positions of the 6 nodes of an element
+        il::StaticArray<il::StaticArray<double, 3>, 6> el_node_crd
+                (const Element_Struct_T &ele_s) {
+            return el_cp_nonuniform(ele_s.vert, ele_s.vert_wts, 0.0);
+        }
+
+        // orthonormal basis of the column space of p (Gram-Schmidt)
+        // in the 1st columns of b; returns its dimension
+        int make_col_basis
+                (const il::StaticArray2D<double, 18, 18> &p,
+                 il::io_t, il::StaticArray2D<double, 18, 18> &b) {
+            b = il::StaticArray2D<double, 18, 18>{0.0};
+            int n_b = 0;
+            for (int j = 0; j < 18; ++j) {
+                il::StaticArray<double, 18> c;
+                double n_0 = 0.0;
+                for (int i = 0; i < 18; ++i) {
+                    c[i] = p(i, j);
+                    n_0 += c[i] * c[i];
+                }
+                if (n_0 == 0.0) continue;
+                // (twice, for orthogonality)
+                for (int pass = 0; pass < 2; ++pass) {
+                    for (int l = 0; l < n_b; ++l) {
+                        double d = 0.0;
+                        for (int i = 0; i < 18; ++i) d += b(i, l) * c[i];
+                        for (int i = 0; i < 18; ++i) c[i] -= d * b(i, l);
+                    }
+                }
+                double n_c = 0.0;
+                for (int i = 0; i < 18; ++i) n_c += c[i] * c[i];
+                if (n_c <= 1e-16 * n_0) continue;
+                n_c = std::sqrt(n_c);
+                for (int i = 0; i < 18; ++i) b(i, n_b) = c[i] / n_c;
+                ++n_b;
+            }
+            return n_b;
+        }
+
+    }
+
+    Mesh_Sym_T make_mesh_sym
+            (const Mesh_Geom_T &mesh,
+             double rel_tol) {
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
+        const il::int_t n_nod = mesh.nods.size(1);
+        const il::int_t n_el = mesh.conn.size(1);
+        IL_EXPECT_FAST(n_nod >= 1);
+
+        Mesh_Sym_T sym;
+        Node_Search_T ns;
+        ns.mesh = &mesh;
+        ns.center = il::StaticArray<double, 3>{0.0};
+        for (il::int_t n = 0; n < n_nod; ++n) {
+            for (int k = 0; k < 3; ++k) {
+                ns.center[k] += mesh.nods(k, n) / n_nod;
+            }
+        }
+        sym.center = ns.center;
+
+        // principal axes of the nodes' distribution
+        Mat3_T cov{0.0};
+        double r_max = 0.0;
+        for (il::int_t n = 0; n < n_nod; ++n) {
+            il::StaticArray<double, 3> x;
+            for (int k = 0; k < 3; ++k) x[k] = mesh.nods(k, n) - ns.center[k];
+            for (int j = 0; j < 3; ++j) {
+                for (int k = 0; k < 3; ++k) cov(k, j) += x[k] * x[j];
+            }
+            r_max = std::max(r_max, l2norm(x));
+        }
+        ns.tol = rel_tol * r_max;
+        il::StaticArray<double, 3> lambda;
+        Mat3_T ax;
+        sym3_eigen(cov, il::io, lambda, ax);
+
+        ns.r_n.reserve(static_cast<std::size_t>(n_nod));
+        for (il::int_t n = 0; n < n_nod; ++n) {
+            il::StaticArray<double, 3> x;
+            for (int k = 0; k < 3; ++k) x[k] = mesh.nods(k, n);
+            ns.r_n.emplace_back(dist_3(x, ns.center), n);
+        }
+        std::sort(ns.r_n.begin(), ns.r_n.end());
+
+        std::unordered_map<std::uint64_t, il::int_t> el_m;
+        el_m.reserve(static_cast<std::size_t>(n_el));
+        for (il::int_t el = 0; el < n_el; ++el) {
+            el_m[el_key(mesh.conn(0, el), mesh.conn(1, el),
+                        mesh.conn(2, el), n_nod)] = el;
+        }
+
+        // candidates
+        std::vector<Mat3_T> cand;
+        Mat3_T g_id{0.0};
+        for (int k = 0; k < 3; ++k) g_id(k, k) = 1.0;
+        cand.push_back(g_id);
+        for (int a = 0; a < 3; ++a) {
+            il::StaticArray<double, 3> n;
+            for (int k = 0; k < 3; ++k) n[k] = ax(k, a);
+            cand.push_back(make_reflection(n));
+            cand.push_back(make_rotation(n, M_PI));
+        }
+        // axis of (possible) rotational symmetry
+        const double l_tol = 1e-6 * std::max(std::fabs(lambda[0]),
+                std::max(std::fabs(lambda[1]), std::fabs(lambda[2])));
+        for (int a = 0; a < 3; ++a) {
+            int b = (a + 1) % 3, c = (a + 2) % 3;
+            if (std::fabs(lambda[b] - lambda[c]) > l_tol ||
+                std::fabs(lambda[a] - lambda[b]) <= l_tol) continue;
+            il::StaticArray<double, 3> n;
+            for (int k = 0; k < 3; ++k) n[k] = ax(k, a);
+            // the node farthest from the axis
+            il::int_t p = -1;
+            double rho_p = 0.0, h_p = 0.0;
+            il::Array<double> rho{n_nod}, h{n_nod};
+            for (il::int_t q = 0; q < n_nod; ++q) {
+                il::StaticArray<double, 3> x;
+                for (int k = 0; k < 3; ++k) {
+                    x[k] = mesh.nods(k, q) - ns.center[k];
+                }
+                h[q] = x[0] * n[0] + x[1] * n[1] + x[2] * n[2];
+                il::StaticArray<double, 3> x_r;
+                for (int k = 0; k < 3; ++k) x_r[k] = x[k] - h[q] * n[k];
+                rho[q] = l2norm(x_r);
+                if (rho[q] > rho_p) {
+                    rho_p = rho[q];
+                    p = q;
+                }
+            }
+            if (p < 0 || rho_p <= ns.tol) continue;
+            h_p = h[p];
+            il::StaticArray<double, 3> u_p, w_p;
+            for (int k = 0; k < 3; ++k) {
+                u_p[k] = (mesh.nods(k, p) - ns.center[k] - h_p * n[k]) / rho_p;
+            }
+            w_p = il::cross(n, u_p);
+            // reflection keeping p
+            cand.push_back(make_reflection(w_p));
+            for (il::int_t q = 0; q < n_nod; ++q) {
+                if (q == p || std::fabs(rho[q] - rho_p) > ns.tol ||
+                    std::fabs(h[q] - h_p) > ns.tol) continue;
+                il::StaticArray<double, 3> u_q, d;
+                double c_q = 0.0, s_q = 0.0;
+                for (int k = 0; k < 3; ++k) {
+                    u_q[k] = mesh.nods(k, q) - ns.center[k] - h[q] * n[k];
+                    d[k] = u_p[k] * rho_p - u_q[k];
+                    c_q += u_q[k] * u_p[k];
+                    s_q += u_q[k] * w_p[k];
+                }
+                double phi = std::atan2(s_q, c_q);
+                cand.push_back(make_rotation(n, phi));
+                cand.push_back(make_reflection(normalize(d)));
+            }
+        }
+
+        // symmetries among the candidates
+        std::vector<Mat3_T> g_l;
+        std::vector<il::Array<il::int_t>> m_l;
+        auto add_if_sym = [&](const Mat3_T &g) {
+            for (const Mat3_T &h : g_l) {
+                if (mat3_diff(g, h) < 1e-8) return;
+            }
+            il::Array<il::int_t> e_map = map_elements(ns, el_m, g);
+            if (e_map.size() == n_el) {
+                g_l.push_back(g);
+                m_l.push_back(std::move(e_map));
+            }
+        };
+        for (const Mat3_T &g : cand) {
+            add_if_sym(g);
+        }
+        // closure (products of symmetries)
+        for (std::size_t i = 0; i < g_l.size(); ++i) {
+            for (std::size_t j = 0; j <= i; ++j) {
+                add_if_sym(mat3_dot(g_l[i], g_l[j]));
+                add_if_sym(mat3_dot(g_l[j], g_l[i]));
+            }
+        }
+
+        const il::int_t n_g = static_cast<il::int_t>(g_l.size());
+        sym.g_m = il::Array<Mat3_T>{n_g};
+        sym.el_map = il::Array2D<il::int_t>{n_g, n_el};
+        for (il::int_t g = 0; g < n_g; ++g) {
+            sym.g_m[g] = g_l[g];
+            for (il::int_t el = 0; el < n_el; ++el) {
+                sym.el_map(g, el) = m_l[g][el];
+            }
+        }
+        return sym;
+    }
+
+    Sym_Fold_T make_sym_fold
+            (const Mesh_Geom_T &mesh,
+             const Mesh_Sym_T &sym,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             double rel_tol) {
+// For an element e = g(r) (r being the representative), the DD and
+// tractions at its node (CP) pi_g(n) are s * dot(g_m[g], ...) at the node n
+// of r, s = +/-1 for (anti)parallel normals of g(r) and e.
+// The symmetric DD of r are in the range of the average of these
+// transforms over its stabilizer (g(r) = r); the basis of this range
+// (free DoF only) defines the reduced DoF; the same for tractions
+        const il::int_t n_el = mesh.conn.size(1);
+        const il::int_t n_g = sym.g_m.size();
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(0) == n_el);
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(1) == 18);
+        IL_EXPECT_FAST(sym.el_map.size(1) == n_el);
+
+        il::Array<Element_Struct_T> ele_l = make_ele_struct_list(mesh, n_par);
+        double r_max = 0.0;
+        for (il::int_t n = 0; n < mesh.nods.size(1); ++n) {
+            il::StaticArray<double, 3> x;
+            for (int k = 0; k < 3; ++k) x[k] = mesh.nods(k, n) - sym.center[k];
+            r_max = std::max(r_max, l2norm(x));
+        }
+        const double tol = rel_tol * r_max;
+
+        // transforms of DD (dd) and tractions (tr) from r to e = g(r)
+        auto make_transform = [&](il::int_t g, il::int_t r, il::int_t e,
+                                  il::io_t,
+                                  il::StaticArray2D<double, 18, 18> &s_dd,
+                                  il::StaticArray2D<double, 18, 18> &s_tr) {
+            const Mat3_T &g_m = sym.g_m[g];
+            const Element_Struct_T &ele_r = ele_l[r], &ele_e = ele_l[e];
+            // dot(n_e, g_m, n_r)
+            double n_g_n = 0.0;
+            for (int k = 0; k < 3; ++k) {
+                for (int l = 0; l < 3; ++l) {
+                    n_g_n += ele_e.r_tensor(2, k) * g_m(k, l) *
+                             ele_r.r_tensor(2, l);
+                }
+            }
+            double s = (n_g_n > 0.0) ? 1.0 : -1.0;
+            Mat3_T g_dd = g_m;
+            if (n_par.is_dd_local) {
+                // dot(r_e, g_m, transpose(r_r))
+                Mat3_T r_r_t;
+                for (int j = 0; j < 3; ++j) {
+                    for (int k = 0; k < 3; ++k) {
+                        r_r_t(k, j) = ele_r.r_tensor(j, k);
+                    }
+                }
+                g_dd = mat3_dot(ele_e.r_tensor, mat3_dot(g_m, r_r_t));
+            }
+            il::StaticArray<il::StaticArray<double, 3>, 6> x_r =
+                    el_node_crd(ele_r), x_e = el_node_crd(ele_e);
+            s_dd = il::StaticArray2D<double, 18, 18>{0.0};
+            s_tr = il::StaticArray2D<double, 18, 18>{0.0};
+            for (int n = 0; n < 6; ++n) {
+                il::StaticArray<double, 3> y{0.0};
+                for (int k = 0; k < 3; ++k) {
+                    for (int l = 0; l < 3; ++l) {
+                        y[k] += g_m(k, l) * (x_r[n][l] - sym.center[l]);
+                    }
+                }
+                for (int k = 0; k < 3; ++k) y[k] += sym.center[k];
+                int m = -1;
+                for (int q = 0; q < 6; ++q) {
+                    if (dist_3(x_e[q], y) <= tol) m = q;
+                }
+                IL_EXPECT_FAST(m >= 0);
+                for (int k = 0; k < 3; ++k) {
+                    for (int l = 0; l < 3; ++l) {
+                        s_dd(3 * m + k, 3 * n + l) = s * g_dd(k, l);
+                        s_tr(3 * m + k, 3 * n + l) = s * g_m(k, l);
+                    }
+                }
+            }
+        };
+
+        Sym_Fold_T fold;
+        fold.n_dof = dof_hndl.n_dof;
+        fold.el_rep = il::Array<il::int_t>{n_el, -1};
+        fold.red_0 = il::Array<il::int_t>{n_el, -1};
+        fold.n_red_el = il::Array<int>{n_el, 0};
+        fold.dd_x = il::Array<il::StaticArray2D<double, 18, 18>>{n_el};
+        fold.tr_x = il::Array<il::StaticArray2D<double, 18, 18>>{n_el};
+        fold.tr_e = il::Array<il::StaticArray2D<double, 18, 18>>{n_el};
+        fold.rel_tol = rel_tol;
+        il::int_t n_red = 0;
+        for (il::int_t r = 0; r < n_el; ++r) {
+            if (fold.el_rep[r] >= 0) continue;
+            // the orbit of r and the stabilizer average
+            il::StaticArray2D<double, 18, 18> p_dd{0.0}, p_tr{0.0},
+                    s_dd, s_tr;
+            int n_h = 0;
+            for (il::int_t g = 0; g < n_g; ++g) {
+                if (sym.el_map(g, r) == r) {
+                    make_transform(g, r, r, il::io, s_dd, s_tr);
+                    for (int j = 0; j < 18; ++j) {
+                        for (int i = 0; i < 18; ++i) {
+                            p_dd(i, j) += s_dd(i, j);
+                            p_tr(i, j) += s_tr(i, j);
+                        }
+                    }
+                    ++n_h;
+                }
+            }
+            // free DoF only
+            for (int j = 0; j < 18; ++j) {
+                for (int i = 0; i < 18; ++i) {
+                    bool is_free = dof_hndl.dof_h(r, i) >= 0 &&
+                                   dof_hndl.dof_h(r, j) >= 0;
+                    p_dd(i, j) = is_free ? p_dd(i, j) / n_h : 0.0;
+                    p_tr(i, j) = is_free ? p_tr(i, j) / n_h : 0.0;
+                }
+            }
+            il::StaticArray2D<double, 18, 18> b_dd, b_tr;
+            int n_b = make_col_basis(p_dd, il::io, b_dd);
+            int n_b_tr = make_col_basis(p_tr, il::io, b_tr);
+            IL_EXPECT_FAST(n_b == n_b_tr);
+            fold.red_0[r] = n_red;
+            fold.n_red_el[r] = n_b;
+            fold.tr_x[r] = b_tr;
+            n_red += n_b;
+
+            for (il::int_t g = 0; g < n_g; ++g) {
+                il::int_t e = sym.el_map(g, r);
+                if (fold.el_rep[e] >= 0) continue;
+                fold.el_rep[e] = r;
+                make_transform(g, r, e, il::io, s_dd, s_tr);
+                il::StaticArray2D<double, 18, 18> e_x{0.0}, e_t{0.0};
+                for (int j = 0; j < n_b; ++j) {
+                    for (int i = 0; i < 18; ++i) {
+                        if (dof_hndl.dof_h(e, i) < 0) continue;
+                        for (int l = 0; l < 18; ++l) {
+                            e_x(i, j) += s_dd(i, l) * b_dd(l, j);
+                            e_t(i, j) += s_tr(i, l) * b_tr(l, j);
+                        }
+                    }
+                }
+                fold.dd_x[e] = e_x;
+                fold.tr_e[e] = e_t;
+            }
+        }
+        fold.n_red = n_red;
+        return fold;
+    }
+
+    il::Array2D<double> make_3dbem_matrix_vc_sym
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             const Sym_Fold_T &fold) {
+// This function assembles transpose(tr_x[t]) * M(t, s) * dd_x[s]
+// (M(t, s) being the blocks of make_3dbem_matrix_vc) summed over
+// all source elements s for the representatives t, and the reduced
+// VC row & column (see set_el_vc_border)
+        const il::int_t n_el = mesh.conn.size(1);
+        const il::int_t n_red = fold.n_red;
+        IL_EXPECT_FAST(fold.el_rep.size() == n_el);
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(0) == n_el);
+        IL_EXPECT_FAST(dof_hndl.n_dof == fold.n_dof);
+        il::Array2D<double> red_matrix{n_red + 1, n_red + 1, 0.0};
+
+        il::Array<Element_Struct_T> ele_l = make_ele_struct_list(mesh, n_par);
+        il::Array<il::int_t> rep_l{};
+        for (il::int_t el = 0; el < n_el; ++el) {
+            if (fold.el_rep[el] == el) rep_l.append(el);
+        }
+        const il::int_t n_rep = rep_l.size();
+
+        for (il::int_t s = 0; s < n_el; ++s) {
+            const Element_Struct_T &ele_s = ele_l[s];
+            const il::int_t r_s = fold.el_rep[s];
+            const int n_c = fold.n_red_el[r_s];
+            const il::int_t c_0 = fold.red_0[r_s];
+            const il::StaticArray2D<double, 18, 18> &dd_x = fold.dd_x[s];
+            Src_El_Prep_T prep = make_src_el_prep
+                    (1, mu, nu, make_el_tau_crd(ele_s.vert, ele_s.r_tensor),
+                     ele_s.sf_m);
+            il::Array<il::StaticArray2D<double, 18, 18>> trac_infl =
+                    make_el2el_vc_submatrices(prep, ele_s, ele_l, rep_l,
+                                              n_par.is_dd_local);
+            for (il::int_t t = 0; t < n_rep; ++t) {
+                il::int_t r_t = rep_l[t];
+                const int n_r = fold.n_red_el[r_t];
+                const il::int_t r_0 = fold.red_0[r_t];
+                const il::StaticArray2D<double, 18, 18> &tr_x = fold.tr_x[r_t];
+                // dot(trac_infl, dd_x) (free DoF)
+                il::StaticArray2D<double, 18, 18> m_x{0.0};
+                for (int j = 0; j < n_c; ++j) {
+                    for (int l = 0; l < 18; ++l) {
+                        if (dd_x(l, j) == 0.0) continue;
+                        for (int i = 0; i < 18; ++i) {
+                            m_x(i, j) += trac_infl[t](i, l) * dd_x(l, j);
+                        }
+                    }
+                }
+                for (int j = 0; j < n_c; ++j) {
+                    for (int i = 0; i < n_r; ++i) {
+                        double v = 0.0;
+                        for (int l = 0; l < 18; ++l) {
+                            v += tr_x(l, i) * m_x(l, j);
+                        }
+                        red_matrix(r_0 + i, c_0 + j) += v;
+                    }
+                }
+            }
+
+            // Volume vs DD (all elements)
+            const double area = el_area(ele_s.vert);
+            const il::StaticArray<double, 6> sf_int_ref =
+                    el_p2_sf_integral_ref(ele_s.vert_wts);
+            for (int n = 0; n < 6; ++n) {
+                il::StaticArray<double, 3> sf_i_v{0.0};
+                if (!n_par.is_dd_local) {
+                    for (int j = 0; j < 3; ++j) {
+                        sf_i_v[j] = area * sf_int_ref[n] *
+                                    ele_s.r_tensor(2, j);
+                    }
+                } else {
+                    sf_i_v[2] = area * sf_int_ref[n];
+                }
+                for (int j = 0; j < 3; ++j) {
+                    for (int c = 0; c < n_c; ++c) {
+                        red_matrix(n_red, c_0 + c) +=
+                                sf_i_v[j] * dd_x(3 * n + j, c);
+                    }
+                }
+            }
+            // Tractions vs pressure (representatives)
+            if (r_s == s) {
+                const il::StaticArray2D<double, 18, 18> &tr_x = fold.tr_x[s];
+                for (int i = 0; i < n_c; ++i) {
+                    double v = 0.0;
+                    for (int n = 0; n < 6; ++n) {
+                        for (int j = 0; j < 3; ++j) {
+                            v -= tr_x(3 * n + j, i) * ele_s.r_tensor(2, j);
+                        }
+                    }
+                    red_matrix(c_0 + i, n_red) = v;
+                }
+            }
+        }
+        return red_matrix;
+    }
+
+    il::Array<double> fold_sym_rhs
+            (const Sym_Fold_T &fold,
+             const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &rhs,
+             il::io_t, double &asym) {
+// The symmetric part of the tractions at CP of an element e
+// is dot(tr_e[e], c_r), c_r being the reduced RHS of its representative
+        IL_EXPECT_FAST(rhs.size() == fold.n_dof + 1);
+        const il::int_t n_el = fold.el_rep.size();
+        il::Array<double> rhs_red{fold.n_red + 1, 0.0};
+        for (il::int_t el = 0; el < n_el; ++el) {
+            if (fold.el_rep[el] != el) continue;
+            for (int i = 0; i < fold.n_red_el[el]; ++i) {
+                double v = 0.0;
+                for (int l = 0; l < 18; ++l) {
+                    il::int_t dof = dof_hndl.dof_h(el, l);
+                    if (dof >= 0) v += fold.tr_x[el](l, i) * rhs[dof];
+                }
+                rhs_red[fold.red_0[el] + i] = v;
+            }
+        }
+        rhs_red[fold.n_red] = rhs[fold.n_dof];
+
+        // the antisymmetric (discarded) part
+        double n_a = 0.0, n_t = 0.0;
+        for (il::int_t el = 0; el < n_el; ++el) {
+            il::int_t r = fold.el_rep[el];
+            for (int l = 0; l < 18; ++l) {
+                il::int_t dof = dof_hndl.dof_h(el, l);
+                if (dof < 0) continue;
+                double v = rhs[dof];
+                for (int c = 0; c < fold.n_red_el[r]; ++c) {
+                    v -= fold.tr_e[el](l, c) * rhs_red[fold.red_0[r] + c];
+                }
+                n_a += v * v;
+                n_t += rhs[dof] * rhs[dof];
+            }
+        }
+        asym = (n_t > 0.0) ? std::sqrt(n_a / n_t) : 0.0;
+        return rhs_red;
+    }
+
+    il::Array<double> fold_sym_rhs
+            (const Sym_Fold_T &fold,
+             const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &rhs) {
+        double asym;
+        il::Array<double> rhs_red =
+                fold_sym_rhs(fold, dof_hndl, rhs, il::io, asym);
+        // (checked in release builds as well)
+        if (asym > std::sqrt(fold.rel_tol)) {
+            std::abort();
+        }
+        return rhs_red;
+    }
+
+    il::Array<double> expand_sym_solution
+            (const Sym_Fold_T &fold,
+             const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &x_red) {
+        IL_EXPECT_FAST(x_red.size() == fold.n_red + 1);
+        const il::int_t n_el = fold.el_rep.size();
+        il::Array<double> x{fold.n_dof + 1, 0.0};
+        for (il::int_t el = 0; el < n_el; ++el) {
+            il::int_t r = fold.el_rep[el];
+            for (int l = 0; l < 18; ++l) {
+                il::int_t dof = dof_hndl.dof_h(el, l);
+                if (dof < 0) continue;
+                double v = 0.0;
+                for (int c = 0; c < fold.n_red_el[r]; ++c) {
+                    v += fold.dd_x[el](l, c) * x_red[fold.red_0[r] + c];
+                }
+                x[dof] = v;
+            }
+        }
+        x[fold.n_dof] = x_red[fold.n_red];
+        return x;
+    }
+
+}
@@ -0,0 +1,117 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Symmetry of the mesh (mirror planes, rotation axes through its center)
+// and the VC system reduced to the symmetric solutions: the unknowns are
+// the DD of one element per orbit (a "fundamental sector"), the DD of
+// the other elements being their images; the influence of the images
+// is folded into the matrix. The loading (s_inf, pressure, volume)
+// has to be symmetric too (checked by fold_sym_rhs); for a planar
+// crack, the reflection through its plane is always found, and it
+// leaves no room for shear loading
+
+#ifndef INC_HFPX3D_MESH_SYMMETRY_H
+#define INC_HFPX3D_MESH_SYMMETRY_H
+
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include "mesh_utilities.h"
+
+namespace hfp3d {
+
+    // symmetry group of the mesh: x -> center + dot(g_m[g], x - center)
+    struct Mesh_Sym_T {
+        il::StaticArray<double, 3> center{};
+        // orthogonal matrices (the 1st one is identity)
+        il::Array<il::StaticArray2D<double, 3, 3>> g_m{};
+        // images of the elements: el_map(g, el)
+        il::Array2D<il::int_t> el_map{};
+    };
+
+    // the VC system reduced to symmetric solutions
+    struct Sym_Fold_T {
+        // number of DD DoF of the full and the reduced system
+        il::int_t n_dof = 0;
+        il::int_t n_red = 0;
+        // representative of the orbit of each element
+        il::Array<il::int_t> el_rep{};
+        // 1st reduced DoF of each representative (-1 for other elements)
+        // and their number
+        il::Array<il::int_t> red_0{};
+        il::Array<int> n_red_el{};
+        // DD of each element (free DoF, see DoF_Handle_T)
+        // vs the reduced DoF of its representative (1st n_red_el columns)
+        il::Array<il::StaticArray2D<double, 18, 18>> dd_x{};
+        // tractions at CP of a representative to the reduced equations
+        // (transposed, 1st n_red_el columns)
+        il::Array<il::StaticArray2D<double, 18, 18>> tr_x{};
+        // symmetric tractions at CP of each element (free DoF)
+        // vs the reduced equations of its representative
+        // (1st n_red_el columns)
+        il::Array<il::StaticArray2D<double, 18, 18>> tr_e{};
+        // tolerance of the symmetry (see make_sym_fold)
+        double rel_tol = 0.0;
+    };
+
+    // Finds the isometries (about the centroid of the nodes) mapping
+    // the mesh onto itself (nodes within rel_tol * mesh size);
+    // candidates are the reflections & rotations by pi w.r. to
+    // the principal axes of the nodes' distribution and, if 2 principal
+    // moments are equal, the reflections & rotations mapping a node
+    // to another one about the 3rd axis; the group is closed by products
+    Mesh_Sym_T make_mesh_sym
+            (const Mesh_Geom_T &mesh,
+             double rel_tol);
+
+    // The reduced DoF: for each orbit, the basis of the DD of
+    // the representative invariant under its stabilizer
+    Sym_Fold_T make_sym_fold
+            (const Mesh_Geom_T &mesh,
+             const Mesh_Sym_T &sym,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             double rel_tol);
+
+    // Reduced VC matrix ((n_red + 1) * (n_red + 1)): the rows of
+    // the representatives only (vs all source elements) are calculated
+    il::Array2D<double> make_3dbem_matrix_vc_sym
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             const Sym_Fold_T &fold);
+
+    // RHS of the full VC system (tractions & volume) to the reduced one;
+    // the antisymmetric part of the tractions (e.g. shear loading
+    // of a planar crack, see make_mesh_sym) is discarded, its norm
+    // relative to the one of the tractions is returned in asym
+    il::Array<double> fold_sym_rhs
+            (const Sym_Fold_T &fold,
+             const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &rhs,
+             il::io_t, double &asym);
+
+    // The same for a symmetric RHS: aborts if the relative norm
+    // of the antisymmetric part exceeds sqrt(fold.rel_tol)
+    il::Array<double> fold_sym_rhs
+            (const Sym_Fold_T &fold,
+             const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &rhs);
+
+    // Solution of the reduced system (DD & pressure) to the full one
+    il::Array<double> expand_sym_solution
+            (const Sym_Fold_T &fold,
+             const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &x_red);
+
+}
+
+#endif //INC_HFPX3D_MESH_SYMMETRY_H
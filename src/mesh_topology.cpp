@@ -0,0 +1,206 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cstdlib>
+#include <unordered_map>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include "mesh_topology.h"
+
+namespace hfp3d {
+
+    Mesh_Topo_T make_mesh_topo
+            (const il::Array2D<il::int_t> &conn,
+             il::int_t n_nods) {
+// This function builds the edge list, edge-to-element and
+// element-to-edge maps, element neighbours, node valence and
+// node-to-element (CSR) map of a triangular surface mesh
+// using a hash table of edges (one pass over the elements)
+        IL_EXPECT_FAST(conn.size(0) >= 3);
+        IL_EXPECT_FAST(n_nods > 0);
+
+        const il::int_t n_el = conn.size(1);
+        Mesh_Topo_T topo;
+        topo.el_edges = il::Array2D<il::int_t>{3, n_el, -1};
+        topo.el_nbrs = il::Array2D<il::int_t>{3, n_el, -1};
+        topo.nod_val = il::Array<il::int_t>{n_nods, 0};
+
+        // edges are keyed by the pair of end nodes (n_a < n_b)
+        std::unordered_map<il::int_t, il::int_t> edge_map;
+        edge_map.reserve(static_cast<std::size_t>(3 * n_el));
+        // 3 * n_el is the upper bound for the number of edges
+        il::Array2D<il::int_t> edges{2, 3 * n_el, -1};
+        il::Array2D<il::int_t> edge_el{2, 3 * n_el, -1};
+        il::int_t n_edges = 0;
+
+        for (il::int_t el = 0; el < n_el; ++el) {
+            for (int v = 0; v < 3; ++v) {
+                il::int_t n = conn(v, el);
+                IL_EXPECT_FAST(n >= 0 && n < n_nods);
+                ++topo.nod_val[n];
+                // the edge across the v-th vertex
+                il::int_t n_a = conn((v + 1) % 3, el);
+                il::int_t n_b = conn((v + 2) % 3, el);
+                if (n_a > n_b) {
+                    il::int_t n_t = n_a;
+                    n_a = n_b;
+                    n_b = n_t;
+                }
+                il::int_t key = n_a * n_nods + n_b;
+                auto it = edge_map.find(key);
+                if (it == edge_map.end()) {
+                    // new edge
+                    edge_map.emplace(key, n_edges);
+                    edges(0, n_edges) = n_a;
+                    edges(1, n_edges) = n_b;
+                    edge_el(0, n_edges) = el;
+                    topo.el_edges(v, el) = n_edges;
+                    ++n_edges;
+                } else {
+                    // mated edge: set neighbours on both sides
+                    il::int_t e = it->second;
+                    topo.el_edges(v, el) = e;
+                    // non-manifold edges (> 2 elements) are not supported
+                    // (checked in release builds as well)
+                    if (edge_el(1, e) != -1) {
+                        std::abort();
+                    }
+                    edge_el(1, e) = el;
+                    il::int_t el_m = edge_el(0, e);
+                    topo.el_nbrs(v, el) = el_m;
+                    for (int w = 0; w < 3; ++w) {
+                        if (topo.el_edges(w, el_m) == e) {
+                            topo.el_nbrs(w, el_m) = el;
+                        }
+                    }
+                }
+            }
+        }
+
+        // trimming the edge arrays
+        topo.n_edges = n_edges;
+        topo.edges = il::Array2D<il::int_t>{2, n_edges};
+        topo.edge_el = il::Array2D<il::int_t>{2, n_edges};
+        for (il::int_t e = 0; e < n_edges; ++e) {
+            for (int j = 0; j < 2; ++j) {
+                topo.edges(j, e) = edges(j, e);
+                topo.edge_el(j, e) = edge_el(j, e);
+            }
+        }
+
+        // node-to-element map (CSR)
+        topo.nod_el_ptr = il::Array<il::int_t>{n_nods + 1, 0};
+        for (il::int_t n = 0; n < n_nods; ++n) {
+            topo.nod_el_ptr[n + 1] = topo.nod_el_ptr[n] + topo.nod_val[n];
+        }
+        topo.nod_el = il::Array<il::int_t>{topo.nod_el_ptr[n_nods]};
+        il::Array<il::int_t> fill{n_nods, 0};
+        for (il::int_t el = 0; el < n_el; ++el) {
+            for (int v = 0; v < 3; ++v) {
+                il::int_t n = conn(v, el);
+                topo.nod_el[topo.nod_el_ptr[n] + fill[n]] = el;
+                ++fill[n];
+            }
+        }
+
+        // tip edges and tip nodes
+        il::int_t n_tip = 0;
+        for (il::int_t e = 0; e < n_edges; ++e) {
+            if (topo.edge_el(1, e) == -1) {
+                ++n_tip;
+            }
+        }
+        topo.tip_edges = il::Array<il::int_t>{n_tip};
+        topo.is_tip_nod = il::Array<int>{n_nods, 0};
+        n_tip = 0;
+        for (il::int_t e = 0; e < n_edges; ++e) {
+            if (topo.edge_el(1, e) == -1) {
+                topo.tip_edges[n_tip] = e;
+                ++n_tip;
+                topo.is_tip_nod[topo.edges(0, e)] = 1;
+                topo.is_tip_nod[topo.edges(1, e)] = 1;
+            }
+        }
+
+        return topo;
+    }
+
+    il::Array2D<il::int_t> make_tip_set
+            (const Mesh_Topo_T &topo,
+             const il::Array2D<il::int_t> &conn,
+             const il::Array<il::int_t> &el_set) {
+// This function lists the edges of the element set (el_set)
+// which are mated with no other element of the set
+// (i.e. the edges of the front to propagate from)
+// and links each of them with its neighbours along the front
+        const il::int_t n_el = conn.size(1);
+        const il::int_t n_nods = topo.nod_val.size();
+        IL_EXPECT_FAST(topo.el_nbrs.size(1) == n_el);
+
+        // membership flags
+        il::Array<int> in_set{n_el, 0};
+        if (el_set.size() == 0) {
+            for (il::int_t el = 0; el < n_el; ++el) {
+                in_set[el] = 1;
+            }
+        } else {
+            for (il::int_t j = 0; j < el_set.size(); ++j) {
+                // -1 means intact element
+                if (el_set[j] >= 0) {
+                    in_set[el_set[j]] = 1;
+                }
+            }
+        }
+
+        // counting the front edges
+        il::int_t n_tip = 0;
+        for (il::int_t el = 0; el < n_el; ++el) {
+            if (in_set[el] == 0) continue;
+            for (int v = 0; v < 3; ++v) {
+                il::int_t nbr = topo.el_nbrs(v, el);
+                if (nbr == -1 || in_set[nbr] == 0) {
+                    ++n_tip;
+                }
+            }
+        }
+
+        il::Array2D<il::int_t> tip_set{n_tip, 5, -1};
+        // front edge starting (node a) at each node
+        il::Array<il::int_t> starts_at{n_nods, -1};
+        n_tip = 0;
+        for (il::int_t el = 0; el < n_el; ++el) {
+            if (in_set[el] == 0) continue;
+            for (int v = 0; v < 3; ++v) {
+                il::int_t nbr = topo.el_nbrs(v, el);
+                if (nbr == -1 || in_set[nbr] == 0) {
+                    int a = (v + 1) % 3;
+                    int b = (a + 1) % 3;
+                    tip_set(n_tip, 0) = el;
+                    tip_set(n_tip, 1) = a;
+                    tip_set(n_tip, 2) = b;
+                    starts_at[conn(a, el)] = n_tip;
+                    ++n_tip;
+                }
+            }
+        }
+
+        // linking consecutive edges of the front (b of one is a of next)
+        for (il::int_t t = 0; t < n_tip; ++t) {
+            il::int_t n_b = conn(tip_set(t, 2), tip_set(t, 0));
+            il::int_t t_next = starts_at[n_b];
+            if (t_next != -1) {
+                tip_set(t, 4) = t_next;
+                tip_set(t_next, 3) = t;
+            }
+        }
+
+        return tip_set;
+    }
+
+}
@@ -0,0 +1,71 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#ifndef INC_HFPX3D_MESH_TOPOLOGY_H
+#define INC_HFPX3D_MESH_TOPOLOGY_H
+
+#include <il/Array.h>
+#include <il/Array2D.h>
+
+namespace hfp3d {
+
+    // edge-based adjacency of a triangular surface mesh
+    struct Mesh_Topo_T {
+        // number of edges
+        il::int_t n_edges = 0;
+
+        // end nodes of each edge (edges(0, e) < edges(1, e))
+        il::Array2D<il::int_t> edges{};
+
+        // elements sharing each edge (edge_el(1, e) = -1 for tip edges)
+        il::Array2D<il::int_t> edge_el{};
+
+        // edge across the v-th vertex of each element: el_edges(v, el)
+        // (i.e. the edge between vertices (v+1)%3 and (v+2)%3)
+        il::Array2D<il::int_t> el_edges{};
+
+        // neighbour element across the v-th vertex: el_nbrs(v, el)
+        // (-1 means the edge belongs to the tip)
+        il::Array2D<il::int_t> el_nbrs{};
+
+        // node valence (number of elements sharing the node)
+        il::Array<il::int_t> nod_val{};
+
+        // node-to-element map in compressed row (CSR) form:
+        // elements around node n are nod_el[nod_el_ptr[n] .. nod_el_ptr[n+1])
+        il::Array<il::int_t> nod_el_ptr{};
+        il::Array<il::int_t> nod_el{};
+
+        // list of tip (boundary) edges
+        il::Array<il::int_t> tip_edges{};
+
+        // tip node flags (1 if the node belongs to a tip edge, 0 otherwise)
+        il::Array<int> is_tip_nod{};
+    };
+
+    // Builds the edge-to-element adjacency in O(N)
+    // from mesh connectivity (first 3 rows of conn are used);
+    // the mesh must be manifold (at most 2 elements per edge)
+    Mesh_Topo_T make_mesh_topo
+            (const il::Array2D<il::int_t> &conn,
+             il::int_t n_nods);
+
+    // List of tip (boundary) edges of a set of elements (el_set),
+    // or of the whole mesh if el_set is empty, in the form
+    // elem No; node a (0..2); node b (0..2); prev. edge No; next edge No
+    // where a -> b follows the element's vertex order and
+    // prev./next edge No refer to rows of the same list (-1 if none)
+    il::Array2D<il::int_t> make_tip_set
+            (const Mesh_Topo_T &topo,
+             const il::Array2D<il::int_t> &conn,
+             const il::Array<il::int_t> &el_set);
+
+}
+
+#endif //INC_HFPX3D_MESH_TOPOLOGY_H
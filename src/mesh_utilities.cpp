@@ -7,6 +7,8 @@
 // See the LICENSE.TXT file for more details. 
 //
 
+#include <cmath>
+#include <utility>
 #include <il/Array2D.h>
 #include <il/StaticArray.h>
 #include "mesh_utilities.h"
@@ -22,11 +24,19 @@ namespace hfp3d {
         // assuming the surface mesh given by mesh connectivity (mesh.conn) 
         // and nodes' coordinates (mesh.nods) is an isolated crack
         // i.e. the edge mated with only one element belongs to the tip
+        // (as found in the edge-to-element map, mesh.topo)
 
         il::int_t n_ele = mesh.conn.size(1);
-        bool is_ext_msh = ap_order > 0 &&
-                          mesh.nods.size(0) >= 5 && mesh.conn.size(0) >= 5;
         IL_EXPECT_FAST(ap_order >= 0);
+
+        // tip nodes & edges are taken from the mesh adjacency
+        // (built here if the mesh has been set up without it)
+        Mesh_Topo_T topo_l;
+        const Mesh_Topo_T *topo = &mesh.topo;
+        if (ap_order > 0 && mesh.topo.el_nbrs.size(1) != n_ele) {
+            topo_l = make_mesh_topo(mesh.conn, mesh.nods.size(1));
+            topo = &topo_l;
+        }
         // number of nodes per element (triangular)
         int nnpe = (ap_order + 1) * (ap_order + 2) / 2;
         int edge_nn = 0;
@@ -51,13 +61,9 @@ namespace hfp3d {
             for (il::int_t el = 0; el < n_ele; ++el) {
                 // status of vertices 1...3 (at the tip or not)
                 il::StaticArray<bool, 3> n_st{false};
-                if (is_ext_msh && mesh.conn(3, el) == mesh.conn(4, el)) {
-                    for (int v = 0; v < 3; ++v) {
-                        il::int_t n = mesh.conn(v, el);
-                        if (mesh.nods(3, n) == 1 && mesh.nods(4, n) == 1) {
-                            n_st[v] = true;
-                        }
-                    }
+                for (int v = 0; v < 3; ++v) {
+                    il::int_t n = mesh.conn(v, el);
+                    n_st[v] = (topo->is_tip_nod[n] != 0);
                 }
                 for (int v = 0; v < nnpe; ++v) {
                     // check if the node (vertex) v (v < 3) is_n_a at the tip
@@ -68,22 +74,16 @@ namespace hfp3d {
                             ++dof_dec;
                             d_h.dof_h(el, ldof) = -1;
                         }
-                    } else if (ap_order > 1 && tip_type == 2 && v >= 3) {
-                        // the vertex across the v-th node
-                        int w = (v - 3) / edge_nn;
-                        if (w < 3) {
-                            // the edge containing the v-th node
-                            int a = (w + 1) % 3;
-                            int b = (a + 1) % 3;
-                            // check if the edge ab is_n_a at the tip
-                            if (n_st[a] && n_st[b]) {
-                                for (int l = 0; l < 3; ++l) {
-                                    int ldof = v * 3 + l;
-                                    --d_h.n_dof;
-                                    ++dof_dec;
-                                    d_h.dof_h(el, ldof) = -1;
-                                }
-                            }
+                    } else if (ap_order > 1 && tip_type == 2 && v >= 3 &&
+                               (v - 3) / edge_nn < 3 &&
+                               topo->el_nbrs((v - 3) / edge_nn, el) == -1) {
+                        // the edge containing the v-th node
+                        // (across the vertex (v - 3) / edge_nn) is at the tip
+                        for (int l = 0; l < 3; ++l) {
+                            int ldof = v * 3 + l;
+                            --d_h.n_dof;
+                            ++dof_dec;
+                            d_h.dof_h(el, ldof) = -1;
                         }
                     } else {
                         for (int l = 0; l < 3; ++l) {
@@ -97,6 +97,284 @@ namespace hfp3d {
         return d_h;
     }
 
+    // DoF handle for the conforming scheme (shared nodes)
+    DoF_Handle_T make_dof_h_conforming
+            (const Mesh_Geom_T &mesh,
+             int tip_type) {
+        // This function numbers the "global" nodes of the mesh:
+        // the vertices (mesh nodes) and the edges (mid-edge nodes,
+        // see mesh.topo), and assigns 3 DoF to each free global node
+        // (in the order of their first appearance in the elements)
+
+        const il::int_t n_ele = mesh.conn.size(1);
+        const il::int_t n_nods = mesh.nods.size(1);
+
+        // edges & tip nodes are taken from the mesh adjacency
+        // (built here if the mesh has been set up without it)
+        Mesh_Topo_T topo_l;
+        const Mesh_Topo_T *topo = &mesh.topo;
+        if (mesh.topo.el_nbrs.size(1) != n_ele) {
+            topo_l = make_mesh_topo(mesh.conn, n_nods);
+            topo = &topo_l;
+        }
+
+        // 1st DoF of each global node (vertices, then edges);
+        // -1: not numbered yet, -2: fixed
+        il::Array<il::int_t> g_dof{n_nods + topo->n_edges, -1};
+        DoF_Handle_T d_h;
+        d_h.n_dof = 0;
+        d_h.dof_h = il::Array2D<il::int_t> {n_ele, 18, -1};
+        for (il::int_t el = 0; el < n_ele; ++el) {
+            for (int v = 0; v < 6; ++v) {
+                // node v < 3 is the vertex v, node v >= 3 is the middle
+                // of the edge across the vertex v - 3
+                il::int_t g_n;
+                bool is_fixed;
+                if (v < 3) {
+                    g_n = mesh.conn(v, el);
+                    is_fixed = tip_type >= 1 && topo->is_tip_nod[g_n] != 0;
+                } else {
+                    g_n = n_nods + topo->el_edges(v - 3, el);
+                    is_fixed = tip_type == 2 &&
+                               topo->el_nbrs(v - 3, el) == -1;
+                }
+                if (g_dof[g_n] == -1) {
+                    if (is_fixed) {
+                        g_dof[g_n] = -2;
+                    } else {
+                        g_dof[g_n] = d_h.n_dof;
+                        d_h.n_dof += 3;
+                    }
+                }
+                if (g_dof[g_n] >= 0) {
+                    for (int l = 0; l < 3; ++l) {
+                        d_h.dof_h(el, v * 3 + l) = g_dof[g_n] + l;
+                    }
+                }
+            }
+        }
+        return d_h;
+    }
+
+    bool is_dof_h_shared(const DoF_Handle_T &dof_hndl) {
+        il::Array<int> is_used{dof_hndl.n_dof, 0};
+        for (il::int_t el = 0; el < dof_hndl.dof_h.size(0); ++el) {
+            for (il::int_t i = 0; i < dof_hndl.dof_h.size(1); ++i) {
+                il::int_t dof = dof_hndl.dof_h(el, i);
+                if (dof < 0) continue;
+                if (is_used[dof] != 0) {
+                    return true;
+                }
+                is_used[dof] = 1;
+            }
+        }
+        return false;
+    }
+
+    // DoF handle for a grown mesh
+    DoF_Handle_T extend_dof_h_crack
+            (const Mesh_Geom_T &mesh,
+             const DoF_Handle_T &old_dof_h,
+             int ap_order,
+             int tip_type) {
+        // This function fills up the DoF handle matrix for a mesh
+        // with elements appended to the ones of old_dof_h
+        // (see grow_mesh_at_tip). The free DoF of the old elements
+        // keep their numbers; the DoF of new elements and the DoF
+        // freed by the growth (old tip nodes) are numbered
+        // after old_dof_h.n_dof, element by element.
+        // Fixed (tip) DoF are defined by make_dof_h_crack
+
+        const il::int_t n_ele = mesh.conn.size(1);
+        const il::int_t n_ele_old = old_dof_h.dof_h.size(0);
+        IL_EXPECT_FAST(n_ele_old <= n_ele);
+
+        // fixed DoF of the grown mesh
+        DoF_Handle_T d_h_f = make_dof_h_crack(mesh, ap_order, tip_type);
+        const il::int_t ndpe = d_h_f.dof_h.size(1);
+        IL_EXPECT_FAST(old_dof_h.dof_h.size(1) == ndpe);
+
+        DoF_Handle_T d_h;
+        d_h.n_dof = old_dof_h.n_dof;
+        d_h.dof_h = il::Array2D<il::int_t> {n_ele, ndpe, -1};
+        for (il::int_t el = 0; el < n_ele; ++el) {
+            for (int ldof = 0; ldof < ndpe; ++ldof) {
+                if (el < n_ele_old && old_dof_h.dof_h(el, ldof) >= 0) {
+                    // old DoF stay free
+                    d_h.dof_h(el, ldof) = old_dof_h.dof_h(el, ldof);
+                } else if (d_h_f.dof_h(el, ldof) >= 0) {
+                    d_h.dof_h(el, ldof) = d_h.n_dof;
+                    ++d_h.n_dof;
+                }
+            }
+        }
+        return d_h;
+    }
+
+    // Adds a layer of elements at the front edges
+    il::int_t grow_mesh_at_tip
+            (const il::Array2D<il::int_t> &tip_set,
+             const il::Array<double> &adv_l,
+             il::io_t, Mesh_Geom_T &mesh) {
+        // This function advances the front edges listed in tip_set
+        // (rows: elem No; node a; node b; ...) by adv_l:
+        // the end nodes a, b of each advancing edge are offset outwards
+        // (in the plane of the element behind the edge) to new nodes
+        // a', b' (shared by consecutive edges), and the quadrangle
+        // a, b, b', a' is split into 2 elements: (b, a, a') & (b, a', b')
+        // having the same orientation as the element behind the edge.
+        // New nodes and elements are appended to mesh.nods & mesh.conn,
+        // mesh.topo is rebuilt
+
+        const il::int_t n_tip = tip_set.size(0);
+        IL_EXPECT_FAST(adv_l.size() == n_tip);
+        IL_EXPECT_FAST(tip_set.size(1) >= 3);
+        const il::int_t n_ele = mesh.conn.size(1);
+        const il::int_t n_nods = mesh.nods.size(1);
+        const il::int_t n_c_r = mesh.conn.size(0);
+        const il::int_t n_n_r = mesh.nods.size(0);
+        if (mesh.topo.el_nbrs.size(1) != n_ele) {
+            mesh.topo = make_mesh_topo(mesh.conn, n_nods);
+        }
+
+        // sum of nodal offsets & number of advancing edges at each node
+        il::Array2D<double> n_offs{3, n_nods, 0.0};
+        il::Array<il::int_t> n_cnt{n_nods, 0};
+        il::Array<int> is_adv{n_tip, 0};
+        il::int_t n_adv = 0;
+        for (il::int_t t = 0; t < n_tip; ++t) {
+            if (adv_l[t] <= 0.0) continue;
+            il::int_t el = tip_set(t, 0);
+            il::int_t a = tip_set(t, 1);
+            il::int_t b = tip_set(t, 2);
+            // only the edges at the tip of the mesh can advance
+            if (mesh.topo.el_nbrs(3 - a - b, el) != -1) continue;
+            is_adv[t] = 1;
+            ++n_adv;
+            // edge vector & element normal
+            il::StaticArray<double, 3> e_ab, e_ac, e_nrm, e_out;
+            for (int k = 0; k < 3; ++k) {
+                e_ab[k] = mesh.nods(k, mesh.conn(b, el)) -
+                          mesh.nods(k, mesh.conn(a, el));
+                e_ac[k] = mesh.nods(k, mesh.conn(3 - a - b, el)) -
+                          mesh.nods(k, mesh.conn(a, el));
+            }
+            for (int k = 0; k < 3; ++k) {
+                e_nrm[k] = e_ab[(k + 1) % 3] * e_ac[(k + 2) % 3] -
+                           e_ab[(k + 2) % 3] * e_ac[(k + 1) % 3];
+            }
+            // outward normal to the edge (e_ab x e_nrm)
+            double out_norm = 0.0;
+            for (int k = 0; k < 3; ++k) {
+                e_out[k] = e_ab[(k + 1) % 3] * e_nrm[(k + 2) % 3] -
+                           e_ab[(k + 2) % 3] * e_nrm[(k + 1) % 3];
+                out_norm += e_out[k] * e_out[k];
+            }
+            out_norm = std::sqrt(out_norm);
+            IL_EXPECT_FAST(out_norm > 0.0);
+            for (int j = 1; j < 3; ++j) {
+                il::int_t n = mesh.conn(tip_set(t, j), el);
+                for (int k = 0; k < 3; ++k) {
+                    n_offs(k, n) += adv_l[t] * e_out[k] / out_norm;
+                }
+                ++n_cnt[n];
+            }
+        }
+        if (n_adv == 0) {
+            return n_ele;
+        }
+
+        // new nodes (offset by the average over adjacent edges)
+        il::Array<il::int_t> new_nod{n_nods, -1};
+        il::int_t n_new_nods = 0;
+        for (il::int_t n = 0; n < n_nods; ++n) {
+            if (n_cnt[n] > 0) {
+                new_nod[n] = n_nods + n_new_nods;
+                ++n_new_nods;
+            }
+        }
+        il::Array2D<double> nods{n_n_r, n_nods + n_new_nods, 0.0};
+        for (il::int_t n = 0; n < n_nods; ++n) {
+            for (il::int_t k = 0; k < n_n_r; ++k) {
+                nods(k, n) = mesh.nods(k, n);
+            }
+            if (new_nod[n] >= 0) {
+                for (int k = 0; k < 3; ++k) {
+                    nods(k, new_nod[n]) = mesh.nods(k, n) +
+                            n_offs(k, n) / static_cast<double>(n_cnt[n]);
+                }
+            }
+        }
+
+        // new elements
+        il::Array2D<il::int_t> conn{n_c_r, n_ele + 2 * n_adv, 0};
+        for (il::int_t el = 0; el < n_ele; ++el) {
+            for (il::int_t k = 0; k < n_c_r; ++k) {
+                conn(k, el) = mesh.conn(k, el);
+            }
+        }
+        il::int_t el_n = n_ele;
+        for (il::int_t t = 0; t < n_tip; ++t) {
+            if (is_adv[t] == 0) continue;
+            il::int_t el = tip_set(t, 0);
+            il::int_t n_a = mesh.conn(tip_set(t, 1), el);
+            il::int_t n_b = mesh.conn(tip_set(t, 2), el);
+            conn(0, el_n) = n_b;
+            conn(1, el_n) = n_a;
+            conn(2, el_n) = new_nod[n_a];
+            ++el_n;
+            conn(0, el_n) = n_b;
+            conn(1, el_n) = new_nod[n_a];
+            conn(2, el_n) = new_nod[n_b];
+            ++el_n;
+        }
+
+        // new nodes inherit the weights (see Mesh_Geom_T)
+        if (mesh.vert_wts.size() > 0) {
+            IL_EXPECT_FAST(mesh.vert_wts.size() == n_nods);
+            // (numbered in the order of the old nodes)
+            for (il::int_t n = 0; n < n_nods; ++n) {
+                if (new_nod[n] >= 0) {
+                    mesh.vert_wts.append(mesh.vert_wts[n]);
+                }
+            }
+        }
+
+        mesh.nods = std::move(nods);
+        mesh.conn = std::move(conn);
+        mesh.topo = make_mesh_topo(mesh.conn, mesh.nods.size(1));
+        return n_ele;
+    }
+
+    il::Array<double> make_graded_vert_wts(const Mesh_Geom_T &mesh) {
+// Unused nodes get the weight 1
+        const il::int_t n_nods = mesh.nods.size(1);
+        const Mesh_Topo_T topo = (mesh.topo.n_edges > 0) ? mesh.topo :
+                                 make_mesh_topo(mesh.conn, n_nods);
+        il::Array<double> l_sum{n_nods, 0.0};
+        il::Array<il::int_t> n_edg{n_nods, 0};
+        for (il::int_t e = 0; e < topo.n_edges; ++e) {
+            il::int_t n_a = topo.edges(0, e), n_b = topo.edges(1, e);
+            double l2 = 0.0;
+            for (int k = 0; k < 3; ++k) {
+                double d = mesh.nods(k, n_b) - mesh.nods(k, n_a);
+                l2 += d * d;
+            }
+            double l = std::sqrt(l2);
+            l_sum[n_a] += l;
+            l_sum[n_b] += l;
+            ++n_edg[n_a];
+            ++n_edg[n_b];
+        }
+        il::Array<double> vert_wts{n_nods, 1.0};
+        for (il::int_t n = 0; n < n_nods; ++n) {
+            if (n_edg[n] > 0) {
+                vert_wts[n] = static_cast<double>(n_edg[n]) / l_sum[n];
+            }
+        }
+        return vert_wts;
+    }
+
     // mesh (solution) data initialization for an undisturbed fault
     Mesh_Data_T init_mesh_data_p_fault
             (const Mesh_Geom_T &i_mesh,
@@ -158,12 +436,12 @@ namespace hfp3d {
                 il::int_t i_n = inj_loc(i_el, n + 1);
                 // look if pressure is applied at the node
                 if (i_n != -1) {
-                    ++g_pp_dof;
                     m_data.dof_h_pp.dof_h(el, n) = g_pp_dof;
+                    ++g_pp_dof;
                     for (int l = 0; l < 3; ++l) {
                         int ldof = n * 3 + l;
-                        ++g_dd_dof;
                         m_data.dof_h_dd.dof_h(el, ldof) = g_dd_dof;
+                        ++g_dd_dof;
                     }
                 }
             }
@@ -171,6 +449,16 @@ namespace hfp3d {
         m_data.dof_h_dd.n_dof = g_dd_dof;
         m_data.dof_h_pp.n_dof = g_pp_dof;
 
+        // front of the active set (to propagate from)
+        if (i_mesh.topo.el_nbrs.size(1) == n_el) {
+            m_data.tip_set = make_tip_set(i_mesh.topo, i_mesh.conn,
+                                          m_data.ae_set);
+        } else {
+            Mesh_Topo_T topo = make_mesh_topo
+                    (i_mesh.conn, i_mesh.nods.size(1));
+            m_data.tip_set = make_tip_set(topo, i_mesh.conn, m_data.ae_set);
+        }
+
         return m_data;
     }
 
@@ -17,6 +17,7 @@
 #include <il/Array2D.h>
 #include <il/StaticArray.h>
 #include <il/StaticArray2D.h>
+#include "mesh_topology.h"
 
 namespace hfp3d {
 
@@ -28,6 +29,14 @@ namespace hfp3d {
         // mesh connectivity
         il::Array2D<il::int_t> conn;
 
+        // edge-to-element adjacency (see make_mesh_topo)
+        Mesh_Topo_T topo{};
+
+        // nodes' "weights" defining the positions of edge nodes
+        // (see Element_Struct_T) for graded meshes;
+        // empty means trivial (middle) edge partitioning
+        il::Array<double> vert_wts{};
+
         // material ID
         //il::Array<int> mat_id;
     };
@@ -67,6 +76,11 @@ namespace hfp3d {
 
         // how to partition edges
         // bool is_part_uniform = true;
+
+        // tolerance (quantization step) for edge length ratios
+        // of "similar" elements sharing the self-influence block
+        // (see Self_Block_Cache_T); 0 -> no sharing
+        double self_blk_tol = 1e-8;
     };
 
     // DoF handle structure
@@ -101,7 +115,8 @@ namespace hfp3d {
 
         // list of next-to-tip elements & edges (to propagate from)
         il::Array2D<il::int_t> tip_set;
-        // elem No; node a (1..3); node b (1..3); prev. edge No; next edge No
+        // elem No; node a (0..2); node b (0..2); prev. edge No; next edge No
+        // (see make_tip_set)
 
         // element-wise DoF handles for DD and pressure
         DoF_Handle_T dof_h_dd{};
@@ -129,6 +144,39 @@ namespace hfp3d {
              int ap_order,
              int tip_type);
 
+    // DoF handle of the conforming (continuous) 2nd order scheme:
+    // the vertex and edge nodes shared by neighbouring elements
+    // share their DoF (about 3 times fewer DoF than in make_dof_h_crack);
+    // fixed DoF at the tip are defined by tip_type as in make_dof_h_crack.
+    // DD have to be in the reference coordinates (is_dd_local = false)
+    DoF_Handle_T make_dof_h_conforming
+            (const Mesh_Geom_T &mesh,
+             int tip_type);
+
+    // true if some DoF are shared by several element nodes
+    bool is_dof_h_shared(const DoF_Handle_T &dof_hndl);
+
+    // DoF handle for a grown mesh: DoF of the old elements keep
+    // their numbers, new (and newly freed) DoF are numbered after them
+    DoF_Handle_T extend_dof_h_crack
+            (const Mesh_Geom_T &mesh,
+             const DoF_Handle_T &old_dof_h,
+             int ap_order,
+             int tip_type);
+
+    // Adds a layer of elements at the front edges (rows of tip_set,
+    // see make_tip_set) advanced by adv_l (adv_l[t] <= 0: no advance);
+    // returns the number of the first new element
+    il::int_t grow_mesh_at_tip
+            (const il::Array2D<il::int_t> &tip_set,
+             const il::Array<double> &adv_l,
+             il::io_t, Mesh_Geom_T &mesh);
+
+    // Nodes' weights for a graded mesh (see Mesh_Geom_T): the inverse
+    // average length of the edges at the node, so that the edge nodes
+    // shift towards the finer side (e.g. towards the tip)
+    il::Array<double> make_graded_vert_wts(const Mesh_Geom_T &mesh);
+
     // mesh (solution) data initialization for an undisturbed fault
     Mesh_Data_T init_mesh_data_p_fault
             (const Mesh_Geom_T &mesh,
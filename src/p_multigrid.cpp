@@ -0,0 +1,469 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cmath>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/Status.h>
+#include <il/linear_algebra.h>
+#include "system_assembly.h"
+#include "p_multigrid.h"
+
+namespace hfp3d {
+
+    namespace {
+
+        // barycentric coordinates of the n-th node of an element
+        // of order p (see El_Order_T)
+        il::StaticArray<double, 3> el_node_bc(int p, int n) {
+            il::StaticArray<double, 3> bc{0.0};
+            if (p == 0) {
+                for (int v = 0; v < 3; ++v) bc[v] = 1.0 / 3.0;
+            } else if (n < 3) {
+                bc[n] = 1.0;
+            } else {
+                bc[(n + 1) % 3] = 0.5;
+                bc[(n + 2) % 3] = 0.5;
+            }
+            return bc;
+        }
+
+        // the same for the n-th CP (see el_cp_p, el_cp_uniform)
+        il::StaticArray<double, 3> el_cp_bc(int p, int n, double beta) {
+            if (p == 0) {
+                return el_node_bc(0, 0);
+            }
+            const double b = (p == 1) ? 0.5 : beta;
+            il::StaticArray<double, 3> bc{b / 3.0};
+            if (n < 3) {
+                bc[n] += 1.0 - b;
+            } else {
+                bc[(n + 1) % 3] += 0.5 * (1.0 - b);
+                bc[(n + 2) % 3] += 0.5 * (1.0 - b);
+            }
+            return bc;
+        }
+
+        // m-th nodal SF of order p (0 or 1) at a point
+        double el_sf_p01(int p, int m, const il::StaticArray<double, 3> &bc) {
+            return (p == 0) ? 1.0 : bc[m];
+        }
+
+        int el_nnpe(int p) {
+            return (p + 1) * (p + 2) / 2;
+        }
+
+        il::Array<double> mat_vec
+                (const il::Array2D<double> &a,
+                 const il::Array<double> &x) {
+            const il::int_t n = a.size(0);
+            il::Array<double> y{n, 0.0};
+            for (il::int_t j = 0; j < a.size(1); ++j) {
+                const double x_j = x[j];
+                if (x_j == 0.0) continue;
+                for (il::int_t i = 0; i < n; ++i) {
+                    y[i] += a(i, j) * x_j;
+                }
+            }
+            return y;
+        }
+
+        double l2norm(const il::Array<double> &x) {
+            double s = 0.0;
+            for (il::int_t i = 0; i < x.size(); ++i) {
+                s += x[i] * x[i];
+            }
+            return std::sqrt(s);
+        }
+
+        il::Array2D<double> inverse(const il::Array2D<double> &a) {
+            const il::int_t n = a.size(0);
+            il::Status status{};
+            il::LU<il::Array2D<double>> lu{a, il::io, status};
+            status.abort_on_error();
+            il::Array2D<double> a_inv{n, n};
+            for (il::int_t j = 0; j < n; ++j) {
+                il::Array<double> e{n, 0.0};
+                e[j] = 1.0;
+                il::Array<double> c = lu.solve(e);
+                for (il::int_t i = 0; i < n; ++i) {
+                    a_inv(i, j) = c[i];
+                }
+            }
+            return a_inv;
+        }
+
+    }
+
+    P_Multigrid_Prec::P_Multigrid_Prec
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const il::Array2D<double> &vc_matrix,
+             const DoF_Handle_T &dof_hndl,
+             const il::Array<int> &c_order,
+             double omega,
+             int n_smooth) :
+            a_f_(vc_matrix),
+            lev_{},
+            c_solver_{},
+            omega_{omega},
+            n_smooth_{n_smooth} {
+// The coarse matrices are assembled here (make_3dbem_matrix_vc_p),
+// the coarsest one is factorized
+        IL_EXPECT_FAST(c_order.size() >= 1);
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(1) == 18);
+        IL_EXPECT_FAST(vc_matrix.size(0) == dof_hndl.n_dof + 1);
+        const il::int_t num_ele = mesh.conn.size(1);
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(0) == num_ele);
+
+        const il::int_t n_lev = c_order.size() + 1;
+        lev_.resize(static_cast<std::size_t>(n_lev));
+        lev_[0].p = 2;
+        lev_[0].dof_hndl = dof_hndl;
+        for (il::int_t l = 1; l < n_lev; ++l) {
+            Level_T &lev = lev_[l];
+            lev.p = c_order[l - 1];
+            IL_EXPECT_FAST(lev.p >= 0 && lev.p < lev_[l - 1].p);
+            if (lev.p == 1) {
+                lev.matrix = make_3dbem_matrix_vc_p<1>
+                        (mu, nu, mesh, n_par, il::io, lev.dof_hndl);
+            } else {
+                lev.matrix = make_3dbem_matrix_vc_p<0>
+                        (mu, nu, mesh, n_par, il::io, lev.dof_hndl);
+            }
+        }
+
+        for (il::int_t l = 0; l < n_lev; ++l) {
+            Level_T &lev = lev_[l];
+            const il::Array2D<double> &a = matrix_(l);
+            const il::int_t n_dof = lev.dof_hndl.n_dof;
+            const il::int_t ndpe = lev.dof_hndl.dof_h.size(1);
+
+            // weights of shared DoF (see make_dof_h_conforming)
+            lev.w_dof = il::Array<double>{n_dof, 0.0};
+            for (il::int_t el = 0; el < num_ele; ++el) {
+                for (il::int_t i = 0; i < ndpe; ++i) {
+                    il::int_t dof = lev.dof_hndl.dof_h(el, i);
+                    if (dof >= 0) lev.w_dof[dof] += 1.0;
+                }
+            }
+            for (il::int_t j = 0; j < n_dof; ++j) {
+                lev.w_dof[j] = 1.0 / lev.w_dof[j];
+            }
+
+            if (l == n_lev - 1) {
+                c_solver_ = std::unique_ptr<VC_Solver>{new VC_Solver{a}};
+                break;
+            }
+
+            // element-block Jacobi
+            lev.blk_inv = il::Array<il::Array2D<double>>{num_ele};
+            for (il::int_t el = 0; el < num_ele; ++el) {
+                il::Array<il::int_t> f_dof{};
+                for (il::int_t i = 0; i < ndpe; ++i) {
+                    il::int_t dof = lev.dof_hndl.dof_h(el, i);
+                    if (dof >= 0) f_dof.append(dof);
+                }
+                const il::int_t n_f = f_dof.size();
+                if (n_f == 0) continue;
+                il::Array2D<double> blk{n_f, n_f};
+                for (il::int_t j = 0; j < n_f; ++j) {
+                    for (il::int_t i = 0; i < n_f; ++i) {
+                        blk(i, j) = a(f_dof[i], f_dof[j]);
+                    }
+                }
+                lev.blk_inv[el] = inverse(blk);
+            }
+
+            // transfer from the next level:
+            // prl(n, m) = m-th coarse SF at the n-th node,
+            // rst = dot(e_c, inv(s^T s), s^T), s(n, m) = m-th coarse SF
+            // at the n-th CP (least squares fit of coarse SF to tractions),
+            // e_c(m, k) = k-th coarse SF at the m-th coarse CP
+            const int p_c = lev_[l + 1].p;
+            const int nn_f = el_nnpe(lev.p), nn_c = el_nnpe(p_c);
+            lev.prl = il::Array2D<double>{nn_f, nn_c};
+            il::Array2D<double> s{nn_f, nn_c}, s_t_s{nn_c, nn_c, 0.0},
+                    e_c{nn_c, nn_c};
+            for (int n = 0; n < nn_f; ++n) {
+                il::StaticArray<double, 3> bc_n = el_node_bc(lev.p, n),
+                        bc_cp = el_cp_bc(lev.p, n, n_par.beta);
+                for (int m = 0; m < nn_c; ++m) {
+                    lev.prl(n, m) = el_sf_p01(p_c, m, bc_n);
+                    s(n, m) = el_sf_p01(p_c, m, bc_cp);
+                }
+            }
+            for (int m = 0; m < nn_c; ++m) {
+                il::StaticArray<double, 3> bc_cp =
+                        el_cp_bc(p_c, m, n_par.beta);
+                for (int k = 0; k < nn_c; ++k) {
+                    e_c(m, k) = el_sf_p01(p_c, k, bc_cp);
+                    for (int n = 0; n < nn_f; ++n) {
+                        s_t_s(m, k) += s(n, m) * s(n, k);
+                    }
+                }
+            }
+            il::Array2D<double> s_t_s_inv = inverse(s_t_s);
+            lev.rst = il::Array2D<double>{nn_c, nn_f, 0.0};
+            for (int n = 0; n < nn_f; ++n) {
+                for (int m = 0; m < nn_c; ++m) {
+                    for (int k = 0; k < nn_c; ++k) {
+                        for (int q = 0; q < nn_c; ++q) {
+                            lev.rst(m, n) += e_c(m, k) * s_t_s_inv(k, q) *
+                                             s(n, q);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void P_Multigrid_Prec::smooth_
+            (std::size_t l,
+             const il::Array<double> &rhs,
+             il::io_t, il::Array<double> &x) const {
+// Element-block Jacobi (additive over elements for shared DoF);
+// the pressure is not changed
+        const Level_T &lev = lev_[l];
+        const il::Array2D<double> &a = matrix_(l);
+        const il::int_t num_ele = lev.dof_hndl.dof_h.size(0);
+        const il::int_t ndpe = lev.dof_hndl.dof_h.size(1);
+        for (int sweep = 0; sweep < n_smooth_; ++sweep) {
+            il::Array<double> res = mat_vec(a, x);
+            for (il::int_t i = 0; i < res.size(); ++i) {
+                res[i] = rhs[i] - res[i];
+            }
+            for (il::int_t el = 0; el < num_ele; ++el) {
+                const il::Array2D<double> &b_inv = lev.blk_inv[el];
+                const il::int_t n_f = b_inv.size(0);
+                if (n_f == 0) continue;
+                il::StaticArray<il::int_t, 18> f_dof;
+                il::int_t k = 0;
+                for (il::int_t i = 0; i < ndpe; ++i) {
+                    il::int_t dof = lev.dof_hndl.dof_h(el, i);
+                    if (dof >= 0) f_dof[k++] = dof;
+                }
+                for (il::int_t i = 0; i < n_f; ++i) {
+                    double d = 0.0;
+                    for (il::int_t j = 0; j < n_f; ++j) {
+                        d += b_inv(i, j) * res[f_dof[j]];
+                    }
+                    x[f_dof[i]] += omega_ * lev.w_dof[f_dof[i]] * d;
+                }
+            }
+        }
+    }
+
+    il::Array<double> P_Multigrid_Prec::v_cycle_
+            (std::size_t l,
+             const il::Array<double> &rhs) const {
+        if (l + 1 == lev_.size()) {
+            return c_solver_->solve(rhs);
+        }
+        const Level_T &lev = lev_[l];
+        const Level_T &lev_c = lev_[l + 1];
+        const il::int_t num_ele = lev.dof_hndl.dof_h.size(0);
+        const il::int_t n_f = lev.dof_hndl.n_dof;
+        const il::int_t n_c = lev_c.dof_hndl.n_dof;
+        const int nn_f = el_nnpe(lev.p), nn_c = el_nnpe(lev_c.p);
+
+        // pre-smoothing
+        il::Array<double> x{n_f + 1, 0.0};
+        smooth_(l, rhs, il::io, x);
+
+        // restriction of the residual
+        il::Array<double> res = mat_vec(matrix_(l), x);
+        for (il::int_t i = 0; i <= n_f; ++i) {
+            res[i] = rhs[i] - res[i];
+        }
+        il::Array<double> rhs_c{n_c + 1, 0.0};
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            for (int m = 0; m < nn_c; ++m) {
+                for (int k = 0; k < 3; ++k) {
+                    il::int_t dof_c = lev_c.dof_hndl.dof_h(el, 3 * m + k);
+                    if (dof_c < 0) continue;
+                    double r = 0.0;
+                    for (int n = 0; n < nn_f; ++n) {
+                        il::int_t dof = lev.dof_hndl.dof_h(el, 3 * n + k);
+                        if (dof >= 0) {
+                            r += lev.rst(m, n) * lev.w_dof[dof] * res[dof];
+                        }
+                    }
+                    rhs_c[dof_c] += r;
+                }
+            }
+        }
+        // volume
+        rhs_c[n_c] = res[n_f];
+
+        // coarse correction
+        il::Array<double> x_c = v_cycle_(l + 1, rhs_c);
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            for (int n = 0; n < nn_f; ++n) {
+                for (int k = 0; k < 3; ++k) {
+                    il::int_t dof = lev.dof_hndl.dof_h(el, 3 * n + k);
+                    if (dof < 0) continue;
+                    double d = 0.0;
+                    for (int m = 0; m < nn_c; ++m) {
+                        il::int_t dof_c =
+                                lev_c.dof_hndl.dof_h(el, 3 * m + k);
+                        if (dof_c >= 0) d += lev.prl(n, m) * x_c[dof_c];
+                    }
+                    x[dof] += lev.w_dof[dof] * d;
+                }
+            }
+        }
+        // pressure
+        x[n_f] += x_c[n_c];
+
+        // post-smoothing
+        smooth_(l, rhs, il::io, x);
+        return x;
+    }
+
+    il::Array<double> P_Multigrid_Prec::apply
+            (const il::Array<double> &r) const {
+        IL_EXPECT_FAST(r.size() == a_f_.size(0));
+        return v_cycle_(0, r);
+    }
+
+    il::Array<double> gmres_solve
+            (const il::Array2D<double> &matrix,
+             const il::Array<double> &rhs,
+             const P_Multigrid_Prec *prec,
+             double rel_tol,
+             int max_it,
+             int restart,
+             il::io_t, int &n_it) {
+        il::Array<double> x_0{rhs.size(), 0.0};
+        return gmres_solve(matrix, rhs, x_0, prec, rel_tol, max_it, restart,
+                           il::io, n_it);
+    }
+
+    il::Array<double> gmres_solve
+            (const il::Array2D<double> &matrix,
+             const il::Array<double> &rhs,
+             const il::Array<double> &x_0,
+             const P_Multigrid_Prec *prec,
+             double rel_tol,
+             int max_it,
+             int restart,
+             il::io_t, int &n_it) {
+// GMRES(restart) with modified Gram-Schmidt orthogonalization
+// and Givens rotations; x = inv(M) * y, y being the Krylov solution
+// of dot(A, inv(M), y) = rhs
+        const il::int_t n = rhs.size();
+        IL_EXPECT_FAST(matrix.size(0) == n && matrix.size(1) == n);
+        IL_EXPECT_FAST(restart >= 1);
+        IL_EXPECT_FAST(x_0.size() == n);
+        il::Array<double> x = x_0;
+        n_it = 0;
+        const double rhs_n = l2norm(rhs);
+        if (rhs_n == 0.0) {
+            return x;
+        }
+        const double tol = rel_tol * rhs_n;
+
+        const il::int_t m = restart;
+        std::vector<il::Array<double>> v_b{}, z_b{};
+        il::Array2D<double> h_m{m + 1, m};
+        il::Array<double> c_s{m}, s_n{m}, g{m + 1};
+        while (n_it < max_it) {
+            il::Array<double> r = mat_vec(matrix, x);
+            for (il::int_t i = 0; i < n; ++i) {
+                r[i] = rhs[i] - r[i];
+            }
+            const double beta = l2norm(r);
+            if (beta <= tol) {
+                break;
+            }
+            v_b.clear();
+            z_b.clear();
+            for (il::int_t i = 0; i < n; ++i) {
+                r[i] /= beta;
+            }
+            v_b.push_back(std::move(r));
+            for (il::int_t i = 0; i <= m; ++i) {
+                g[i] = 0.0;
+            }
+            g[0] = beta;
+
+            il::int_t k = 0;
+            bool is_conv = false;
+            for (il::int_t j = 0; j < m && n_it < max_it; ++j) {
+                z_b.push_back((prec != nullptr) ?
+                              prec->apply(v_b[j]) : v_b[j]);
+                il::Array<double> w = mat_vec(matrix, z_b[j]);
+                for (il::int_t i = 0; i <= j; ++i) {
+                    double h = 0.0;
+                    for (il::int_t q = 0; q < n; ++q) {
+                        h += w[q] * v_b[i][q];
+                    }
+                    h_m(i, j) = h;
+                    for (il::int_t q = 0; q < n; ++q) {
+                        w[q] -= h * v_b[i][q];
+                    }
+                }
+                const double h_n = l2norm(w);
+                h_m(j + 1, j) = h_n;
+                if (h_n > 0.0) {
+                    for (il::int_t q = 0; q < n; ++q) {
+                        w[q] /= h_n;
+                    }
+                }
+                v_b.push_back(std::move(w));
+
+                // Givens rotations
+                for (il::int_t i = 0; i < j; ++i) {
+                    double t = c_s[i] * h_m(i, j) + s_n[i] * h_m(i + 1, j);
+                    h_m(i + 1, j) = -s_n[i] * h_m(i, j) +
+                                    c_s[i] * h_m(i + 1, j);
+                    h_m(i, j) = t;
+                }
+                const double d = std::sqrt(h_m(j, j) * h_m(j, j) +
+                                           h_m(j + 1, j) * h_m(j + 1, j));
+                c_s[j] = h_m(j, j) / d;
+                s_n[j] = h_m(j + 1, j) / d;
+                h_m(j, j) = d;
+                h_m(j + 1, j) = 0.0;
+                g[j + 1] = -s_n[j] * g[j];
+                g[j] = c_s[j] * g[j];
+
+                ++n_it;
+                k = j + 1;
+                if (std::fabs(g[j + 1]) <= tol || h_n == 0.0) {
+                    is_conv = true;
+                    break;
+                }
+            }
+
+            // y = inv(H) * g (upper triangular), x += dot(Z, y)
+            il::Array<double> y{k, 0.0};
+            for (il::int_t i = k - 1; i >= 0; --i) {
+                double t = g[i];
+                for (il::int_t q = i + 1; q < k; ++q) {
+                    t -= h_m(i, q) * y[q];
+                }
+                y[i] = t / h_m(i, i);
+            }
+            for (il::int_t i = 0; i < k; ++i) {
+                for (il::int_t q = 0; q < n; ++q) {
+                    x[q] += y[i] * z_b[i][q];
+                }
+            }
+            if (is_conv) {
+                break;
+            }
+        }
+        return x;
+    }
+
+}
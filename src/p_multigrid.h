@@ -0,0 +1,117 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// p-multigrid preconditioner for the VC system of 2nd order elements:
+// the coarse levels are the VC systems of lower order elements
+// (see make_3dbem_matrix_vc_p) on the same mesh, the coarsest one
+// is solved directly; element-block Jacobi smoothing
+// (the transfer between levels assumes mid-edge nodes: for graded
+// meshes, see Mesh_Geom_T, it is approximate).
+// The preconditioned system is solved by restarted GMRES
+
+#ifndef INC_HFPX3D_P_MULTIGRID_H
+#define INC_HFPX3D_P_MULTIGRID_H
+
+#include <memory>
+#include <vector>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include "mesh_utilities.h"
+#include "bordered_solver.h"
+
+namespace hfp3d {
+
+    class P_Multigrid_Prec {
+    private:
+        struct Level_T {
+            // element order
+            int p = 2;
+            DoF_Handle_T dof_hndl{};
+            // VC matrix (not stored for the finest level)
+            il::Array2D<double> matrix{};
+            // inverses of the diagonal (element) blocks for free DoF
+            il::Array<il::Array2D<double>> blk_inv{};
+            // 1 / (number of element nodes sharing the DoF)
+            il::Array<double> w_dof{};
+            // transfer from the next (coarser) level, for each DD
+            // component: DD at the nodes = dot(prl, coarse DD),
+            // tractions at the coarse CP = dot(rst, tractions at the CP)
+            il::Array2D<double> prl{};
+            il::Array2D<double> rst{};
+        };
+
+        // VC matrix of the finest level
+        const il::Array2D<double> &a_f_;
+        std::vector<Level_T> lev_;
+        // direct solver at the coarsest level
+        std::unique_ptr<VC_Solver> c_solver_;
+        // smoothing: relaxation factor and number of sweeps
+        double omega_;
+        int n_smooth_;
+
+        const il::Array2D<double> &matrix_(std::size_t l) const {
+            return (l == 0) ? a_f_ : lev_[l].matrix;
+        };
+
+        void smooth_
+                (std::size_t l,
+                 const il::Array<double> &rhs,
+                 il::io_t, il::Array<double> &x) const;
+
+        il::Array<double> v_cycle_
+                (std::size_t l,
+                 const il::Array<double> &rhs) const;
+
+    public:
+        // vc_matrix and dof_hndl: the VC system of 2nd order elements
+        // (see make_3dbem_matrix_vc; vc_matrix has to outlive
+        // the preconditioner); c_order: orders of the coarse levels
+        // (decreasing, e.g. {1, 0} or {0})
+        P_Multigrid_Prec
+                (double mu, double nu,
+                 const Mesh_Geom_T &mesh,
+                 const Num_Param_T &n_par,
+                 const il::Array2D<double> &vc_matrix,
+                 const DoF_Handle_T &dof_hndl,
+                 const il::Array<int> &c_order,
+                 double omega = 0.8,
+                 int n_smooth = 1);
+
+        il::int_t size() const { return a_f_.size(0); };
+
+        // one V-cycle for the residual r (approximately inv(A) * r)
+        il::Array<double> apply(const il::Array<double> &r) const;
+    };
+
+    // Restarted GMRES with right preconditioning (prec may be null);
+    // stops when |rhs - A * x| <= rel_tol * |rhs| or after max_it
+    // iterations (their number is returned in n_it)
+    il::Array<double> gmres_solve
+            (const il::Array2D<double> &matrix,
+             const il::Array<double> &rhs,
+             const P_Multigrid_Prec *prec,
+             double rel_tol,
+             int max_it,
+             int restart,
+             il::io_t, int &n_it);
+
+    // The same starting from the initial iterate x_0
+    il::Array<double> gmres_solve
+            (const il::Array2D<double> &matrix,
+             const il::Array<double> &rhs,
+             const il::Array<double> &x_0,
+             const P_Multigrid_Prec *prec,
+             double rel_tol,
+             int max_it,
+             int restart,
+             il::io_t, int &n_it);
+
+}
+
+#endif //INC_HFPX3D_P_MULTIGRID_H
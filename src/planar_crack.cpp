@@ -0,0 +1,288 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include <il/linear_algebra.h>
+#include "element_utilities.h"
+#include "tensor_utilities.h"
+#include "system_assembly.h"
+#include "planar_crack.h"
+
+namespace hfp3d {
+
+    bool is_mesh_planar
+            (const Mesh_Geom_T &mesh,
+             double rel_tol,
+             il::io_t, il::StaticArray2D<double, 3, 3> &r_plane) {
+// This function takes the plane of the 1st element and checks
+// the distance of all nodes (used by the mesh) to it
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.conn.size(1) >= 1);
+        const il::int_t num_ele = mesh.conn.size(1);
+
+        il::StaticArray2D<double, 3, 3> el_vert;
+        for (int j = 0; j < 3; ++j) {
+            il::int_t n = mesh.conn(j, 0);
+            for (int k = 0; k < 3; ++k) {
+                el_vert(k, j) = mesh.nods(k, n);
+            }
+        }
+        r_plane = make_el_r_tensor(el_vert);
+
+        // mesh size (bounding box diagonal)
+        il::StaticArray<double, 3> x_min, x_max;
+        for (int k = 0; k < 3; ++k) {
+            x_min[k] = el_vert(k, 0);
+            x_max[k] = el_vert(k, 0);
+        }
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            for (int j = 0; j < 3; ++j) {
+                il::int_t n = mesh.conn(j, el);
+                for (int k = 0; k < 3; ++k) {
+                    x_min[k] = std::min(x_min[k], mesh.nods(k, n));
+                    x_max[k] = std::max(x_max[k], mesh.nods(k, n));
+                }
+            }
+        }
+        il::StaticArray<double, 3> diag;
+        for (int k = 0; k < 3; ++k) {
+            diag[k] = x_max[k] - x_min[k];
+        }
+        const double tol = rel_tol * l2norm(diag);
+
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            for (int j = 0; j < 3; ++j) {
+                il::int_t n = mesh.conn(j, el);
+                double h = 0.0;
+                for (int k = 0; k < 3; ++k) {
+                    h += r_plane(2, k) * (mesh.nods(k, n) - el_vert(k, 0));
+                }
+                if (std::fabs(h) > tol) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    Planar_VC_T make_3dbem_matrix_vc_planar
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const il::StaticArray2D<double, 3, 3> &r_plane,
+             il::io_t, DoF_Handle_T &dof_hndl) {
+// This function assembles the opening and shear blocks of the VC matrix
+// for a planar crack (see is_mesh_planar). All CP are on the plane
+// of the source element (h = 0), so that only the limit kernels
+// are used (see make_local_3dbem_submatrices); the normal-to-shear
+// coupling terms vanish and are not stored.
+// For a source element with the local coordinates r_s
+// and q_s = dot(r_plane, transpose(r_s)), the block of tractions
+// vs DD (both in plane's coordinates) is dot(q_s, t_loc, transpose(q_s)),
+// t_loc being the tractions vs DD in the source element's coordinates
+
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.conn.size(1) >= 1); // at least 1 element
+
+        if (dof_hndl.n_dof == 0 || dof_hndl.dof_h.size(0) == 0) {
+            dof_hndl = make_dof_h_crack(mesh, 2, n_par.tip_type);
+        }
+
+        const il::int_t num_ele = mesh.conn.size(1);
+        const il::int_t num_dof = dof_hndl.n_dof;
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        IL_EXPECT_FAST(ndpe == 18);
+
+        Planar_VC_T p_vc;
+        p_vc.r_plane = r_plane;
+        p_vc.n_dof = num_dof;
+
+        // splitting the DoF into the opening & shear blocks
+        p_vc.dof_2_blk = il::Array<il::int_t>{num_dof, -1};
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            for (int i = 0; i < ndpe; ++i) {
+                il::int_t dof = dof_hndl.dof_h(el, i);
+                if (dof < 0 || p_vc.dof_2_blk[dof] >= 0) continue;
+                if (i % 3 == 2) {
+                    p_vc.dof_2_blk[dof] = p_vc.dof_n.size();
+                    p_vc.dof_n.append(dof);
+                } else {
+                    p_vc.dof_2_blk[dof] = p_vc.dof_s.size();
+                    p_vc.dof_s.append(dof);
+                }
+            }
+        }
+        const il::int_t n_n = p_vc.dof_n.size();
+        const il::int_t n_s = p_vc.dof_s.size();
+        p_vc.m_n = il::Array2D<double>{n_n + 1, n_n + 1, 0.0};
+        p_vc.m_s = il::Array2D<double>{n_s, n_s, 0.0};
+
+        // Element properties (vertices, CP, shape functions, rotation)
+        il::Array<Element_Struct_T> ele_l = make_ele_struct_list(mesh, n_par);
+
+        // normal to the plane
+        il::StaticArray<double, 3> nrm_p;
+        for (int j = 0; j < 3; ++j) {
+            nrm_p[j] = -r_plane(2, j);
+        }
+
+        // Number of "target" elements evaluated at once
+        const il::int_t t_chunk = 64;
+
+        // Loop over "source" elements
+        for (il::int_t source_elem = 0;
+             source_elem < num_ele; ++source_elem) {
+            const Element_Struct_T &ele_s = ele_l[source_elem];
+            Src_El_Prep_T prep = make_src_el_prep
+                    (1, mu, nu, make_el_tau_crd(ele_s.vert, ele_s.r_tensor),
+                     ele_s.sf_m);
+
+            // plane's normal in the source element's coordinates
+            il::StaticArray<double, 3> nrm_loc = il::dot(ele_s.r_tensor, nrm_p);
+            // source element's to plane's coordinates
+            il::StaticArray2D<double, 3, 3> q_s;
+            for (int j = 0; j < 3; ++j) {
+                for (int k = 0; k < 3; ++k) {
+                    q_s(k, j) = 0.0;
+                    for (int l = 0; l < 3; ++l) {
+                        q_s(k, j) += r_plane(k, l) * ele_s.r_tensor(j, l);
+                    }
+                }
+            }
+
+            // Loop over "Target" elements (by chunks)
+            for (il::int_t t_0 = 0; t_0 < num_ele; t_0 += t_chunk) {
+                const il::int_t n_t_el = std::min(t_chunk, num_ele - t_0);
+                // all CP on the plane (h = 0)
+                il::Array<double> h_cp{6 * n_t_el, 0.0};
+                il::Array<std::complex<double>> z_cp{6 * n_t_el};
+                for (il::int_t t = 0; t < n_t_el; ++t) {
+                    const Element_Struct_T &ele_t = ele_l[t_0 + t];
+                    for (int n_t = 0; n_t < 6; ++n_t) {
+                        HZ hz = make_el_pt_hz
+                                (ele_s.vert, ele_t.cp_crd[n_t],
+                                 ele_s.r_tensor);
+                        z_cp[6 * t + n_t] = hz.z;
+                    }
+                }
+                il::Array<il::StaticArray2D<double, 6, 18>> stress_infl =
+                        make_local_3dbem_submatrices(prep, h_cp, z_cp);
+
+                for (il::int_t t = 0; t < n_t_el; ++t) {
+                    il::int_t target_elem = t_0 + t;
+                    for (int n_t = 0; n_t < 6; ++n_t) {
+                        il::StaticArray2D<double, 3, 18> trac_loc =
+                                nv_dot_sim(nrm_loc, stress_infl[6 * t + n_t]);
+                        for (int n_s = 0; n_s < 6; ++n_s) {
+                            // dot(q_s, t_loc, transpose(q_s))
+                            il::StaticArray2D<double, 3, 3> t_q{0.0}, t_p{0.0};
+                            for (int j = 0; j < 3; ++j) {
+                                for (int k = 0; k < 3; ++k) {
+                                    for (int l = 0; l < 3; ++l) {
+                                        t_q(k, j) += q_s(k, l) *
+                                                trac_loc(l, 3 * n_s + j);
+                                    }
+                                }
+                            }
+                            for (int j = 0; j < 3; ++j) {
+                                for (int k = 0; k < 3; ++k) {
+                                    for (int l = 0; l < 3; ++l) {
+                                        t_p(k, j) += t_q(k, l) * q_s(j, l);
+                                    }
+                                }
+                            }
+                            for (int j = 0; j < 3; ++j) {
+                                il::int_t d_s = dof_hndl.dof_h
+                                        (source_elem, 3 * n_s + j);
+                                if (d_s < 0) continue;
+                                il::int_t b_s = p_vc.dof_2_blk[d_s];
+                                for (int k = 0; k < 3; ++k) {
+                                    il::int_t d_t = dof_hndl.dof_h
+                                            (target_elem, 3 * n_t + k);
+                                    if (d_t < 0) continue;
+                                    il::int_t b_t = p_vc.dof_2_blk[d_t];
+                                    if (j == 2 && k == 2) {
+                                        p_vc.m_n(b_t, b_s) += t_p(k, j);
+                                    } else if (j < 2 && k < 2) {
+                                        p_vc.m_s(b_t, b_s) += t_p(k, j);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            // Volume vs opening & tractions vs pressure
+            // (see set_el_vc_border)
+            const double area = el_area(ele_s.vert);
+            const il::StaticArray<double, 6> sf_int_ref =
+                    el_p2_sf_integral_ref(ele_s.vert_wts);
+            for (int n = 0; n < 6; ++n) {
+                il::int_t dof = dof_hndl.dof_h(source_elem, 3 * n + 2);
+                if (dof < 0) continue;
+                il::int_t b = p_vc.dof_2_blk[dof];
+                // q_s(2, 2) = +/-1: (anti)parallel normals
+                p_vc.m_n(n_n, b) += area * sf_int_ref[n] * q_s(2, 2);
+                p_vc.m_n(b, n_n) -= 1.0;
+            }
+        }
+        return p_vc;
+    }
+
+    Planar_VC_Solver::Planar_VC_Solver(const Planar_VC_T &p_vc) :
+            n_dof_{p_vc.n_dof},
+            status_{},
+            dof_n_{p_vc.dof_n},
+            dof_s_{p_vc.dof_s},
+            vc_n_{p_vc.m_n},
+            lu_s_{p_vc.m_s, il::io, status_} {
+// Both blocks are factorized (the shear one has 4 times as many entries
+// as the opening one, the full matrix has 9 times as many)
+        status_.abort_on_error();
+    }
+
+    il::Array<double> Planar_VC_Solver::solve
+            (const il::Array<double> &rhs) const {
+        const il::int_t n = n_dof_;
+        IL_EXPECT_FAST(rhs.size() == n + 1);
+        const il::int_t n_n = dof_n_.size();
+        const il::int_t n_s = dof_s_.size();
+
+        il::Array<double> rhs_n{n_n + 1};
+        for (il::int_t j = 0; j < n_n; ++j) {
+            rhs_n[j] = rhs[dof_n_[j]];
+        }
+        rhs_n[n_n] = rhs[n];
+        il::Array<double> x_n = vc_n_.solve(rhs_n);
+
+        il::Array<double> rhs_s{n_s};
+        for (il::int_t j = 0; j < n_s; ++j) {
+            rhs_s[j] = rhs[dof_s_[j]];
+        }
+        il::Array<double> x_s = lu_s_.solve(rhs_s);
+
+        il::Array<double> x{n + 1};
+        for (il::int_t j = 0; j < n_n; ++j) {
+            x[dof_n_[j]] = x_n[j];
+        }
+        for (il::int_t j = 0; j < n_s; ++j) {
+            x[dof_s_[j]] = x_s[j];
+        }
+        x[n] = x_n[n_n];
+        return x;
+    }
+
+}
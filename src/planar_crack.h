@@ -0,0 +1,90 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Planar crack (all elements in one plane): for DD and tractions
+// in terms of the plane's coordinates, the opening (mode I) and the shear
+// (in-plane) problems decouple, so that the VC matrix is assembled
+// as 2 independent blocks and the blocks are solved separately
+
+#ifndef INC_HFPX3D_PLANAR_CRACK_H
+#define INC_HFPX3D_PLANAR_CRACK_H
+
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/Status.h>
+#include <il/StaticArray2D.h>
+#include <il/linear_algebra.h>
+#include "mesh_utilities.h"
+#include "bordered_solver.h"
+
+namespace hfp3d {
+
+    // Decoupled VC matrix of a planar crack.
+    // DD at the nodes and tractions at the CP are in terms of the plane's
+    // coordinate system (rows of r_plane; the 3rd one is the normal);
+    // tractions are w.r. to the plane's normal (-r_plane(2, :)) for all
+    // elements; DoF are numbered by the DoF handle (see make_dof_h_crack),
+    // those of the 3rd (normal) component form the opening block
+    struct Planar_VC_T {
+        // rotation tensor (reference to plane's coordinates)
+        il::StaticArray2D<double, 3, 3> r_plane{};
+        // number of DD DoF (opening & shear)
+        il::int_t n_dof = 0;
+        // DoF No to its No in the block it belongs to
+        il::Array<il::int_t> dof_2_blk{};
+        // DoF in the opening (dof_n) and shear (dof_s) blocks
+        il::Array<il::int_t> dof_n{};
+        il::Array<il::int_t> dof_s{};
+        // opening block with the VC row & column (size dof_n.size() + 1)
+        il::Array2D<double> m_n{};
+        // shear block
+        il::Array2D<double> m_s{};
+    };
+
+    // Checks whether all nodes of the mesh are in the plane of
+    // the 1st element (within rel_tol * mesh size); sets the plane's
+    // rotation tensor (that of the 1st element)
+    bool is_mesh_planar
+            (const Mesh_Geom_T &mesh,
+             double rel_tol,
+             il::io_t, il::StaticArray2D<double, 3, 3> &r_plane);
+
+    // Assembly of the decoupled VC matrix (limit kernels only)
+    Planar_VC_T make_3dbem_matrix_vc_planar
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const il::StaticArray2D<double, 3, 3> &r_plane,
+             il::io_t, DoF_Handle_T &dof_hndl);
+
+    // Solver for the decoupled VC system: the opening block is solved
+    // as a VC system (see VC_Solver), the shear block independently
+    class Planar_VC_Solver {
+    private:
+        il::int_t n_dof_;
+        il::Status status_;
+        il::Array<il::int_t> dof_n_;
+        il::Array<il::int_t> dof_s_;
+        VC_Solver vc_n_;
+        il::LU<il::Array2D<double>> lu_s_;
+
+    public:
+        explicit Planar_VC_Solver(const Planar_VC_T &p_vc);
+
+        il::int_t n_dof() const { return n_dof_; };
+
+        // solution for tractions (rhs[0 .. n_dof)) and volume
+        // (rhs[n_dof]) in the conventions of Planar_VC_T;
+        // the pressure is the last entry of the result
+        il::Array<double> solve(const il::Array<double> &rhs) const;
+    };
+
+}
+
+#endif //INC_HFPX3D_PLANAR_CRACK_H
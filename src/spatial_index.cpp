@@ -0,0 +1,422 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <utility>
+#include <vector>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include "spatial_index.h"
+
+namespace hfp3d {
+
+    namespace {
+
+        // squared distance between a point and a box
+        double box_pt_dist2
+                (const il::Array2D<double> &b_min,
+                 const il::Array2D<double> &b_max,
+                 il::int_t j,
+                 const il::StaticArray<double, 3> &pt) {
+            double d2 = 0.0;
+            for (int k = 0; k < 3; ++k) {
+                double t = 0.0;
+                if (pt[k] < b_min(k, j)) {
+                    t = b_min(k, j) - pt[k];
+                } else if (pt[k] > b_max(k, j)) {
+                    t = pt[k] - b_max(k, j);
+                }
+                d2 += t * t;
+            }
+            return d2;
+        }
+
+        // squared distance between two boxes
+        double box_box_dist2
+                (const il::Array2D<double> &b_min,
+                 const il::Array2D<double> &b_max,
+                 il::int_t j,
+                 const il::StaticArray<double, 3> &c_min,
+                 const il::StaticArray<double, 3> &c_max) {
+            double d2 = 0.0;
+            for (int k = 0; k < 3; ++k) {
+                double t = 0.0;
+                if (c_max[k] < b_min(k, j)) {
+                    t = b_min(k, j) - c_max[k];
+                } else if (c_min[k] > b_max(k, j)) {
+                    t = c_min[k] - b_max(k, j);
+                }
+                d2 += t * t;
+            }
+            return d2;
+        }
+
+    }
+
+    El_BVH_T make_el_bvh
+            (const Mesh_Geom_T &mesh,
+             il::int_t leaf_size) {
+// This function builds the bounding volume hierarchy
+// splitting the element set at the median of centroids
+// along the longest axis of the centroids' bounding box
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
+        IL_EXPECT_FAST(leaf_size >= 1);
+        IL_EXPECT_FAST(mesh.conn.size(1) >= 1);
+
+        const il::int_t n_el = mesh.conn.size(1);
+        El_BVH_T bvh;
+        bvh.el_min = il::Array2D<double>{3, n_el};
+        bvh.el_max = il::Array2D<double>{3, n_el};
+        bvh.el_cnt = il::Array2D<double>{3, n_el};
+        bvh.el_order = il::Array<il::int_t>{n_el};
+        for (il::int_t el = 0; el < n_el; ++el) {
+            bvh.el_order[el] = el;
+            for (int k = 0; k < 3; ++k) {
+                double x = mesh.nods(k, mesh.conn(0, el));
+                bvh.el_min(k, el) = x;
+                bvh.el_max(k, el) = x;
+                bvh.el_cnt(k, el) = x / 3.0;
+                for (int v = 1; v < 3; ++v) {
+                    x = mesh.nods(k, mesh.conn(v, el));
+                    bvh.el_min(k, el) = std::min(bvh.el_min(k, el), x);
+                    bvh.el_max(k, el) = std::max(bvh.el_max(k, el), x);
+                    bvh.el_cnt(k, el) += x / 3.0;
+                }
+            }
+        }
+
+        // a binary tree w. leaves of >= 1 element has < 2 * n_el nodes
+        const il::int_t max_bvn = 2 * n_el;
+        il::Array2D<double> bvn_min{3, max_bvn}, bvn_max{3, max_bvn};
+        il::Array2D<il::int_t> bvn_child{2, max_bvn, -1};
+        il::Array2D<il::int_t> bvn_range{2, max_bvn, 0};
+
+        il::int_t n_bvn = 1;
+        bvn_range(0, 0) = 0;
+        bvn_range(1, 0) = n_el;
+        std::vector<il::int_t> stack;
+        stack.push_back(0);
+        while (!stack.empty()) {
+            il::int_t j = stack.back();
+            stack.pop_back();
+            il::int_t b = bvn_range(0, j), e = bvn_range(1, j);
+
+            // bounding box of the node and of the centroids
+            il::StaticArray<double, 3> c_min{0.0}, c_max{0.0};
+            for (int k = 0; k < 3; ++k) {
+                il::int_t el = bvh.el_order[b];
+                bvn_min(k, j) = bvh.el_min(k, el);
+                bvn_max(k, j) = bvh.el_max(k, el);
+                c_min[k] = bvh.el_cnt(k, el);
+                c_max[k] = c_min[k];
+            }
+            for (il::int_t i = b + 1; i < e; ++i) {
+                il::int_t el = bvh.el_order[i];
+                for (int k = 0; k < 3; ++k) {
+                    bvn_min(k, j) = std::min(bvn_min(k, j), bvh.el_min(k, el));
+                    bvn_max(k, j) = std::max(bvn_max(k, j), bvh.el_max(k, el));
+                    c_min[k] = std::min(c_min[k], bvh.el_cnt(k, el));
+                    c_max[k] = std::max(c_max[k], bvh.el_cnt(k, el));
+                }
+            }
+            if (e - b <= leaf_size) {
+                continue;
+            }
+
+            // splitting along the longest axis at the median
+            int ax = 0;
+            for (int k = 1; k < 3; ++k) {
+                if (c_max[k] - c_min[k] > c_max[ax] - c_min[ax]) {
+                    ax = k;
+                }
+            }
+            il::int_t m = b + (e - b) / 2;
+            il::int_t *first = bvh.el_order.data();
+            const il::Array2D<double> &cnt = bvh.el_cnt;
+            std::nth_element(first + b, first + m, first + e,
+                             [&cnt, ax](il::int_t l, il::int_t r) {
+                                 return cnt(ax, l) < cnt(ax, r);
+                             });
+
+            IL_EXPECT_FAST(n_bvn + 2 <= max_bvn);
+            for (int c = 0; c < 2; ++c) {
+                il::int_t ch = n_bvn + c;
+                bvn_child(c, j) = ch;
+                bvn_range(0, ch) = (c == 0) ? b : m;
+                bvn_range(1, ch) = (c == 0) ? m : e;
+                stack.push_back(ch);
+            }
+            n_bvn += 2;
+        }
+
+        // trimming the tree arrays
+        bvh.n_bvn = n_bvn;
+        bvh.bvn_min = il::Array2D<double>{3, n_bvn};
+        bvh.bvn_max = il::Array2D<double>{3, n_bvn};
+        bvh.bvn_child = il::Array2D<il::int_t>{2, n_bvn};
+        bvh.bvn_range = il::Array2D<il::int_t>{2, n_bvn};
+        for (il::int_t j = 0; j < n_bvn; ++j) {
+            for (int k = 0; k < 3; ++k) {
+                bvh.bvn_min(k, j) = bvn_min(k, j);
+                bvh.bvn_max(k, j) = bvn_max(k, j);
+            }
+            for (int c = 0; c < 2; ++c) {
+                bvh.bvn_child(c, j) = bvn_child(c, j);
+                bvh.bvn_range(c, j) = bvn_range(c, j);
+            }
+        }
+        return bvh;
+    }
+
+    double el_pt_dist2
+            (const Mesh_Geom_T &mesh,
+             il::int_t el,
+             const il::StaticArray<double, 3> &pt) {
+// This function calculates the squared distance from the point pt
+// to the triangle el (closest point by Voronoi regions of the triangle)
+        il::StaticArray<double, 3> a, b, c, ab, ac, ap;
+        for (int k = 0; k < 3; ++k) {
+            a[k] = mesh.nods(k, mesh.conn(0, el));
+            b[k] = mesh.nods(k, mesh.conn(1, el));
+            c[k] = mesh.nods(k, mesh.conn(2, el));
+            ab[k] = b[k] - a[k];
+            ac[k] = c[k] - a[k];
+            ap[k] = pt[k] - a[k];
+        }
+        auto dot3 = [](const il::StaticArray<double, 3> &u,
+                       const il::StaticArray<double, 3> &w) {
+            return u[0] * w[0] + u[1] * w[1] + u[2] * w[2];
+        };
+        // closest point (cl) as a + v * ab + w * ac
+        double v = 0.0, w = 0.0;
+        double d1 = dot3(ab, ap), d2 = dot3(ac, ap);
+        il::StaticArray<double, 3> bp, cp;
+        for (int k = 0; k < 3; ++k) {
+            bp[k] = pt[k] - b[k];
+            cp[k] = pt[k] - c[k];
+        }
+        double d3 = dot3(ab, bp), d4 = dot3(ac, bp);
+        double d5 = dot3(ab, cp), d6 = dot3(ac, cp);
+        double va = d3 * d6 - d5 * d4;
+        double vb = d5 * d2 - d1 * d6;
+        double vc = d1 * d4 - d3 * d2;
+        if (d1 <= 0.0 && d2 <= 0.0) {
+            // vertex a
+        } else if (d3 >= 0.0 && d4 <= d3) {
+            // vertex b
+            v = 1.0;
+        } else if (d6 >= 0.0 && d5 <= d6) {
+            // vertex c
+            w = 1.0;
+        } else if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+            // edge ab
+            v = d1 / (d1 - d3);
+        } else if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+            // edge ac
+            w = d2 / (d2 - d6);
+        } else if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+            // edge bc
+            double t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            v = 1.0 - t;
+            w = t;
+        } else {
+            // inside the triangle
+            double denom = 1.0 / (va + vb + vc);
+            v = vb * denom;
+            w = vc * denom;
+        }
+        double dist2 = 0.0;
+        for (int k = 0; k < 3; ++k) {
+            double t = ap[k] - v * ab[k] - w * ac[k];
+            dist2 += t * t;
+        }
+        return dist2;
+    }
+
+    il::Array<il::int_t> bvh_radius_query
+            (const Mesh_Geom_T &mesh,
+             const El_BVH_T &bvh,
+             const il::StaticArray<double, 3> &pt,
+             double radius) {
+// This function lists the elements within the distance "radius"
+// from the point pt (boxes are used for pruning)
+        IL_EXPECT_FAST(bvh.n_bvn > 0);
+        const double r2 = radius * radius;
+        il::Array<il::int_t> found{};
+        std::vector<il::int_t> stack;
+        stack.push_back(0);
+        while (!stack.empty()) {
+            il::int_t j = stack.back();
+            stack.pop_back();
+            if (box_pt_dist2(bvh.bvn_min, bvh.bvn_max, j, pt) > r2) {
+                continue;
+            }
+            if (bvh.bvn_child(0, j) == -1) {
+                for (il::int_t i = bvh.bvn_range(0, j);
+                     i < bvh.bvn_range(1, j); ++i) {
+                    il::int_t el = bvh.el_order[i];
+                    if (box_pt_dist2(bvh.el_min, bvh.el_max, el, pt) <= r2 &&
+                        el_pt_dist2(mesh, el, pt) <= r2) {
+                        found.append(el);
+                    }
+                }
+            } else {
+                stack.push_back(bvh.bvn_child(0, j));
+                stack.push_back(bvh.bvn_child(1, j));
+            }
+        }
+        return found;
+    }
+
+    il::Array<il::int_t> bvh_knn_query
+            (const Mesh_Geom_T &mesh,
+             const El_BVH_T &bvh,
+             const il::StaticArray<double, 3> &pt,
+             il::int_t k) {
+// This function finds k elements closest to the point pt
+// (best-first traversal of the tree)
+        IL_EXPECT_FAST(bvh.n_bvn > 0);
+        IL_EXPECT_FAST(k >= 1);
+        typedef std::pair<double, il::int_t> D_I;
+        // tree nodes to visit, closest first
+        std::priority_queue<D_I, std::vector<D_I>, std::greater<D_I>> to_do;
+        // k best elements so far, farthest on top
+        std::priority_queue<D_I> best;
+        to_do.push(D_I(box_pt_dist2(bvh.bvn_min, bvh.bvn_max, 0, pt), 0));
+        while (!to_do.empty()) {
+            D_I top = to_do.top();
+            to_do.pop();
+            if (static_cast<il::int_t>(best.size()) == k &&
+                top.first > best.top().first) {
+                break;
+            }
+            il::int_t j = top.second;
+            if (bvh.bvn_child(0, j) == -1) {
+                for (il::int_t i = bvh.bvn_range(0, j);
+                     i < bvh.bvn_range(1, j); ++i) {
+                    il::int_t el = bvh.el_order[i];
+                    double d2 = el_pt_dist2(mesh, el, pt);
+                    if (static_cast<il::int_t>(best.size()) < k) {
+                        best.push(D_I(d2, el));
+                    } else if (d2 < best.top().first) {
+                        best.pop();
+                        best.push(D_I(d2, el));
+                    }
+                }
+            } else {
+                for (int c = 0; c < 2; ++c) {
+                    il::int_t ch = bvh.bvn_child(c, j);
+                    to_do.push(D_I(box_pt_dist2
+                            (bvh.bvn_min, bvh.bvn_max, ch, pt), ch));
+                }
+            }
+        }
+        il::Array<il::int_t> found{static_cast<il::int_t>(best.size())};
+        for (il::int_t i = found.size() - 1; i >= 0; --i) {
+            found[i] = best.top().second;
+            best.pop();
+        }
+        return found;
+    }
+
+    il::Array<il::int_t> bvh_box_query
+            (const El_BVH_T &bvh,
+             const il::StaticArray<double, 3> &b_min,
+             const il::StaticArray<double, 3> &b_max,
+             double radius) {
+// This function lists the elements whose bounding boxes are
+// within the distance "radius" from the box [b_min, b_max]
+        IL_EXPECT_FAST(bvh.n_bvn > 0);
+        const double r2 = radius * radius;
+        il::Array<il::int_t> found{};
+        std::vector<il::int_t> stack;
+        stack.push_back(0);
+        while (!stack.empty()) {
+            il::int_t j = stack.back();
+            stack.pop_back();
+            if (box_box_dist2(bvh.bvn_min, bvh.bvn_max, j,
+                              b_min, b_max) > r2) {
+                continue;
+            }
+            if (bvh.bvn_child(0, j) == -1) {
+                for (il::int_t i = bvh.bvn_range(0, j);
+                     i < bvh.bvn_range(1, j); ++i) {
+                    il::int_t el = bvh.el_order[i];
+                    if (box_box_dist2(bvh.el_min, bvh.el_max, el,
+                                      b_min, b_max) <= r2) {
+                        found.append(el);
+                    }
+                }
+            } else {
+                stack.push_back(bvh.bvn_child(0, j));
+                stack.push_back(bvh.bvn_child(1, j));
+            }
+        }
+        return found;
+    }
+
+    void make_near_field_list
+            (const El_BVH_T &bvh,
+             double eta,
+             il::io_t,
+             il::Array<il::int_t> &near_ptr,
+             il::Array<il::int_t> &near_el) {
+// This function classifies element pairs as near (listed) or far;
+// the pair (t, s) is near if dist(box_t, box_s) <= eta * max(diam)
+        IL_EXPECT_FAST(eta > 0.0);
+        const il::int_t n_el = bvh.el_order.size();
+
+        // box diameters and the largest one
+        il::Array<double> diam{n_el, 0.0};
+        double max_diam = 0.0;
+        for (il::int_t el = 0; el < n_el; ++el) {
+            double d2 = 0.0;
+            for (int k = 0; k < 3; ++k) {
+                double t = bvh.el_max(k, el) - bvh.el_min(k, el);
+                d2 += t * t;
+            }
+            diam[el] = std::sqrt(d2);
+            max_diam = std::max(max_diam, diam[el]);
+        }
+
+        near_ptr = il::Array<il::int_t>{n_el + 1, 0};
+        std::vector<il::int_t> list;
+        list.reserve(static_cast<std::size_t>(16 * n_el));
+        for (il::int_t t = 0; t < n_el; ++t) {
+            il::StaticArray<double, 3> t_min, t_max;
+            for (int k = 0; k < 3; ++k) {
+                t_min[k] = bvh.el_min(k, t);
+                t_max[k] = bvh.el_max(k, t);
+            }
+            // candidates w.r. to the largest source element,
+            // then the exact criterion for each pair
+            il::Array<il::int_t> cand = bvh_box_query
+                    (bvh, t_min, t_max, eta * std::max(diam[t], max_diam));
+            for (il::int_t i = 0; i < cand.size(); ++i) {
+                il::int_t s = cand[i];
+                double r = eta * std::max(diam[t], diam[s]);
+                if (box_box_dist2(bvh.el_min, bvh.el_max, s,
+                                  t_min, t_max) <= r * r) {
+                    list.push_back(s);
+                }
+            }
+            std::sort(list.begin() + near_ptr[t], list.end());
+            near_ptr[t + 1] = static_cast<il::int_t>(list.size());
+        }
+        near_el = il::Array<il::int_t>{near_ptr[n_el]};
+        for (il::int_t i = 0; i < near_el.size(); ++i) {
+            near_el[i] = list[i];
+        }
+    }
+
+}
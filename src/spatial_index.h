@@ -0,0 +1,95 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Bounding volume hierarchy (BVH) over triangular elements
+// for near-field classification and proximity queries
+
+#ifndef INC_HFPX3D_SPATIAL_INDEX_H
+#define INC_HFPX3D_SPATIAL_INDEX_H
+
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include "mesh_utilities.h"
+
+namespace hfp3d {
+
+    // binary tree of axis-aligned bounding boxes
+    struct El_BVH_T {
+        // number of tree nodes (node 0 is the root)
+        il::int_t n_bvn = 0;
+
+        // bounding box of each tree node (lower and upper corners)
+        il::Array2D<double> bvn_min{};
+        il::Array2D<double> bvn_max{};
+
+        // children of each tree node (-1 for leaves)
+        il::Array2D<il::int_t> bvn_child{};
+
+        // range of el_order covered by each tree node: [begin, end)
+        il::Array2D<il::int_t> bvn_range{};
+
+        // element numbers, ordered so that each tree node
+        // covers a contiguous range
+        il::Array<il::int_t> el_order{};
+
+        // bounding boxes and centroids of the elements
+        il::Array2D<double> el_min{};
+        il::Array2D<double> el_max{};
+        il::Array2D<double> el_cnt{};
+    };
+
+    // Top-down construction, median split along the longest axis
+    // (O(N log N)); leaf_size is the max. number of elements in a leaf;
+    // the mesh must have at least one element
+    El_BVH_T make_el_bvh
+            (const Mesh_Geom_T &mesh,
+             il::int_t leaf_size);
+
+    // Elements within the distance "radius" from the point
+    il::Array<il::int_t> bvh_radius_query
+            (const Mesh_Geom_T &mesh,
+             const El_BVH_T &bvh,
+             const il::StaticArray<double, 3> &pt,
+             double radius);
+
+    // k elements closest to the point (sorted by distance)
+    il::Array<il::int_t> bvh_knn_query
+            (const Mesh_Geom_T &mesh,
+             const El_BVH_T &bvh,
+             const il::StaticArray<double, 3> &pt,
+             il::int_t k);
+
+    // Elements with bounding boxes within the distance "radius"
+    // from the box [b_min, b_max]
+    il::Array<il::int_t> bvh_box_query
+            (const El_BVH_T &bvh,
+             const il::StaticArray<double, 3> &b_min,
+             const il::StaticArray<double, 3> &b_max,
+             double radius);
+
+    // Near-field (source) elements for each (target) element in CSR form:
+    // near_el[near_ptr[t] .. near_ptr[t+1]) are the elements whose boxes
+    // are closer to the box of t than eta * (the larger box diameter)
+    void make_near_field_list
+            (const El_BVH_T &bvh,
+             double eta,
+             il::io_t,
+             il::Array<il::int_t> &near_ptr,
+             il::Array<il::int_t> &near_el);
+
+    // Squared distance from a point to a triangular element
+    double el_pt_dist2
+            (const Mesh_Geom_T &mesh,
+             il::int_t el,
+             const il::StaticArray<double, 3> &pt);
+
+}
+
+#endif //INC_HFPX3D_SPATIAL_INDEX_H
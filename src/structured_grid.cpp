@@ -0,0 +1,324 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+#include <cmath>
+#include <complex>
+#include <utility>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include <il/StaticArray.h>
+#include <il/StaticArray2D.h>
+#include <il/linear_algebra.h>
+#include "element_utilities.h"
+#include "tensor_utilities.h"
+#include "system_assembly.h"
+#include "structured_grid.h"
+
+namespace hfp3d {
+
+    namespace {
+
+        // smallest power of 2 >= n
+        il::int_t pow2_ceil(il::int_t n) {
+            il::int_t l = 1;
+            while (l < n) l <<= 1;
+            return l;
+        }
+
+        // exp(-2 * pi * I * k / n), k < n / 2
+        il::Array<std::complex<double>> make_twiddles(il::int_t n) {
+            il::Array<std::complex<double>> tw{n / 2 > 0 ? n / 2 : 1};
+            for (il::int_t k = 0; k < n / 2; ++k) {
+                tw[k] = std::polar(1.0, -2.0 * M_PI * k / n);
+            }
+            return tw;
+        }
+
+        // in-place radix-2 FFT of a[0], a[s], ..., a[(n - 1) * s]
+        // (unscaled; inverse = with conjugate twiddles)
+        void fft_1d
+                (const il::Array<std::complex<double>> &tw,
+                 il::int_t n, il::int_t s, bool inverse,
+                 il::io_t, std::complex<double> *a) {
+            for (il::int_t i = 1, j = 0; i < n; ++i) {
+                il::int_t bit = n >> 1;
+                for (; j & bit; bit >>= 1) j ^= bit;
+                j ^= bit;
+                if (i < j) std::swap(a[i * s], a[j * s]);
+            }
+            for (il::int_t len = 2; len <= n; len <<= 1) {
+                il::int_t h = len / 2, step = n / len;
+                for (il::int_t i = 0; i < n; i += len) {
+                    for (il::int_t j = 0; j < h; ++j) {
+                        std::complex<double> w = inverse ?
+                                std::conj(tw[j * step]) : tw[j * step];
+                        std::complex<double> u = a[(i + j) * s],
+                                v = a[(i + j + h) * s] * w;
+                        a[(i + j) * s] = u + v;
+                        a[(i + j + h) * s] = u - v;
+                    }
+                }
+            }
+        }
+
+        // 2D FFT of l_x * l_y values a[(ix + l_x * iy) * s]
+        void fft_2d
+                (const il::Array<std::complex<double>> &tw_x,
+                 const il::Array<std::complex<double>> &tw_y,
+                 il::int_t l_x, il::int_t l_y, il::int_t s, bool inverse,
+                 il::io_t, std::complex<double> *a) {
+            for (il::int_t iy = 0; iy < l_y; ++iy) {
+                fft_1d(tw_x, l_x, s, inverse, il::io, a + l_x * iy * s);
+            }
+            for (il::int_t ix = 0; ix < l_x; ++ix) {
+                fft_1d(tw_y, l_y, l_x * s, inverse, il::io, a + ix * s);
+            }
+        }
+
+        // vertices of the element of type t in the cell (ix, iy)
+        il::StaticArray2D<double, 3, 3> str_grid_el_vert
+                (const Str_Grid_T &grid, il::int_t ix, il::int_t iy, int t) {
+            // corners: p00, p10, p11 (t = 0); p00, p11, p01 (t = 1)
+            const int c_x[2][3] = {{0, 1, 1}, {0, 1, 0}};
+            const int c_y[2][3] = {{0, 0, 1}, {0, 1, 1}};
+            il::StaticArray2D<double, 3, 3> el_vert{0.0};
+            for (int v = 0; v < 3; ++v) {
+                el_vert(0, v) = (ix + c_x[t][v]) * grid.d_x;
+                el_vert(1, v) = (iy + c_y[t][v]) * grid.d_y;
+            }
+            return el_vert;
+        }
+
+    }
+
+    Mesh_Geom_T make_str_grid_mesh(const Str_Grid_T &grid) {
+// This function sets the nodes and connectivity of the grid
+// (see str_grid_el_vert)
+        IL_EXPECT_FAST(grid.n_x >= 1 && grid.n_y >= 1);
+        const il::int_t n_nx = grid.n_x + 1;
+        Mesh_Geom_T mesh;
+        mesh.nods = il::Array2D<double>{3, n_nx * (grid.n_y + 1), 0.0};
+        for (il::int_t iy = 0; iy <= grid.n_y; ++iy) {
+            for (il::int_t ix = 0; ix <= grid.n_x; ++ix) {
+                mesh.nods(0, ix + n_nx * iy) = ix * grid.d_x;
+                mesh.nods(1, ix + n_nx * iy) = iy * grid.d_y;
+            }
+        }
+        mesh.conn = il::Array2D<il::int_t>{3, 2 * grid.n_x * grid.n_y};
+        for (il::int_t iy = 0; iy < grid.n_y; ++iy) {
+            for (il::int_t ix = 0; ix < grid.n_x; ++ix) {
+                il::int_t el = 2 * (ix + grid.n_x * iy);
+                il::int_t p00 = ix + n_nx * iy, p10 = p00 + 1,
+                        p01 = p00 + n_nx, p11 = p01 + 1;
+                mesh.conn(0, el) = p00;
+                mesh.conn(1, el) = p10;
+                mesh.conn(2, el) = p11;
+                mesh.conn(0, el + 1) = p00;
+                mesh.conn(1, el + 1) = p11;
+                mesh.conn(2, el + 1) = p01;
+            }
+        }
+        return mesh;
+    }
+
+    Str_Grid_Op::Str_Grid_Op
+            (double mu, double nu,
+             const Str_Grid_T &grid,
+             const Num_Param_T &n_par) :
+            grid_{grid},
+            l_x_{pow2_ceil(2 * grid.n_x - 1)},
+            l_y_{pow2_ceil(2 * grid.n_y - 1)},
+            tw_x_{}, tw_y_{}, k_n_{}, k_s_{} {
+// The blocks of tractions vs DD in the plane's coordinates
+// (see make_3dbem_matrix_vc_planar) are calculated for the 2 elements
+// of the cell (0, 0) as sources and the CP of both elements of the cells
+// (ox, oy), |ox| < n_x, |oy| < n_y, as targets; the normal-to-shear
+// coupling terms vanish. The blocks are placed at (ox mod l_x, oy mod l_y)
+// of the padded grid (circular convolution = linear one) and transformed
+        IL_EXPECT_FAST(grid.n_x >= 1 && grid.n_y >= 1);
+        const il::int_t n_x = grid.n_x, n_y = grid.n_y;
+        const il::int_t l_f = l_x_ * l_y_;
+        tw_x_ = make_twiddles(l_x_);
+        tw_y_ = make_twiddles(l_y_);
+        k_n_ = il::Array2D<std::complex<double>>{144, l_f, 0.0};
+        k_s_ = il::Array2D<std::complex<double>>{576, l_f, 0.0};
+
+        // CP of both elements of the cell (0, 0)
+        il::StaticArray<Element_Struct_T, 2> ele_0;
+        for (int t = 0; t < 2; ++t) {
+            il::StaticArray2D<double, 3, 3> el_vert =
+                    str_grid_el_vert(grid, 0, 0, t);
+            ele_0[t] = set_ele_struct(el_vert, n_par.beta);
+        }
+        // the plane's normal
+        il::StaticArray<double, 3> nrm_p{0.0};
+        nrm_p[2] = -1.0;
+
+        const il::int_t n_ox = 2 * n_x - 1;
+        for (int t_s = 0; t_s < 2; ++t_s) {
+            const Element_Struct_T &ele_s = ele_0[t_s];
+            Src_El_Prep_T prep = make_src_el_prep
+                    (1, mu, nu, make_el_tau_crd(ele_s.vert, ele_s.r_tensor),
+                     ele_s.sf_m);
+            il::StaticArray<double, 3> nrm_loc = il::dot(ele_s.r_tensor, nrm_p);
+            // source element's to plane's (reference) coordinates
+            const il::StaticArray2D<double, 3, 3> &r_s = ele_s.r_tensor;
+
+            // by rows of offsets
+            for (il::int_t oy = 1 - n_y; oy < n_y; ++oy) {
+                il::Array<double> h_cp{12 * n_ox, 0.0};
+                il::Array<std::complex<double>> z_cp{12 * n_ox};
+                for (il::int_t ox = 1 - n_x; ox < n_x; ++ox) {
+                    for (int t_t = 0; t_t < 2; ++t_t) {
+                        for (int n_t = 0; n_t < 6; ++n_t) {
+                            il::StaticArray<double, 3> cp =
+                                    ele_0[t_t].cp_crd[n_t];
+                            cp[0] += ox * grid.d_x;
+                            cp[1] += oy * grid.d_y;
+                            HZ hz = make_el_pt_hz(ele_s.vert, cp, r_s);
+                            z_cp[12 * (ox + n_x - 1) + 6 * t_t + n_t] = hz.z;
+                        }
+                    }
+                }
+                il::Array<il::StaticArray2D<double, 6, 18>> stress_infl =
+                        make_local_3dbem_submatrices(prep, h_cp, z_cp);
+
+                il::int_t f_y = (oy + l_y_) % l_y_;
+                for (il::int_t ox = 1 - n_x; ox < n_x; ++ox) {
+                    il::int_t f = (ox + l_x_) % l_x_ + l_x_ * f_y;
+                    for (int t_t = 0; t_t < 2; ++t_t) {
+                        for (int n_t = 0; n_t < 6; ++n_t) {
+                            il::StaticArray2D<double, 3, 18> trac_loc =
+                                    nv_dot_sim(nrm_loc, stress_infl
+                                    [12 * (ox + n_x - 1) + 6 * t_t + n_t]);
+                            for (int n_s = 0; n_s < 6; ++n_s) {
+                                // dot(transpose(r_s), t_loc, r_s)
+                                il::StaticArray2D<double, 3, 3> t_q{0.0},
+                                        t_p{0.0};
+                                for (int j = 0; j < 3; ++j) {
+                                    for (int k = 0; k < 3; ++k) {
+                                        for (int l = 0; l < 3; ++l) {
+                                            t_q(k, j) += r_s(l, k) *
+                                                    trac_loc(l, 3 * n_s + j);
+                                        }
+                                    }
+                                }
+                                for (int j = 0; j < 3; ++j) {
+                                    for (int k = 0; k < 3; ++k) {
+                                        for (int l = 0; l < 3; ++l) {
+                                            t_p(k, j) += t_q(k, l) * r_s(l, j);
+                                        }
+                                    }
+                                }
+                                // opening: row 6 * t_t + n_t,
+                                // column 6 * t_s + n_s
+                                k_n_(6 * t_t + n_t + 12 * (6 * t_s + n_s),
+                                     f) = t_p(2, 2);
+                                // shear: row 12 * t_t + 2 * n_t + k,
+                                // column 12 * t_s + 2 * n_s + j
+                                for (int j = 0; j < 2; ++j) {
+                                    for (int k = 0; k < 2; ++k) {
+                                        k_s_(12 * t_t + 2 * n_t + k + 24 *
+                                             (12 * t_s + 2 * n_s + j), f) =
+                                                t_p(k, j);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // spectra of all block entries
+        for (il::int_t i = 0; i < 144; ++i) {
+            fft_2d(tw_x_, tw_y_, l_x_, l_y_, 144, false,
+                   il::io, k_n_.data() + i);
+        }
+        for (il::int_t i = 0; i < 576; ++i) {
+            fft_2d(tw_x_, tw_y_, l_x_, l_y_, 576, false,
+                   il::io, k_s_.data() + i);
+        }
+    }
+
+    il::Array<double> Str_Grid_Op::dot(const il::Array<double> &dd) const {
+// 36 forward and 36 inverse FFT of the padded grid, and a 12 x 12
+// (opening) and a 24 x 24 (shear) complex matrix-vector product
+// for each frequency
+        IL_EXPECT_FAST(dd.size() == size());
+        const il::int_t n_x = grid_.n_x, n_y = grid_.n_y;
+        const il::int_t l_f = l_x_ * l_y_;
+
+        // DD (per cell) on the padded grid
+        il::Array2D<std::complex<double>> x_n{12, l_f, 0.0}, x_s{24, l_f, 0.0};
+        for (il::int_t iy = 0; iy < n_y; ++iy) {
+            for (il::int_t ix = 0; ix < n_x; ++ix) {
+                il::int_t f = ix + l_x_ * iy;
+                il::int_t c = ix + n_x * iy;
+                for (int t = 0; t < 2; ++t) {
+                    for (int n = 0; n < 6; ++n) {
+                        il::int_t d_0 = 18 * (2 * c + t) + 3 * n;
+                        x_n(6 * t + n, f) = dd[d_0 + 2];
+                        x_s(12 * t + 2 * n, f) = dd[d_0];
+                        x_s(12 * t + 2 * n + 1, f) = dd[d_0 + 1];
+                    }
+                }
+            }
+        }
+        for (il::int_t i = 0; i < 12; ++i) {
+            fft_2d(tw_x_, tw_y_, l_x_, l_y_, 12, false, il::io, x_n.data() + i);
+        }
+        for (il::int_t i = 0; i < 24; ++i) {
+            fft_2d(tw_x_, tw_y_, l_x_, l_y_, 24, false, il::io, x_s.data() + i);
+        }
+
+        // products of the spectra
+        il::Array2D<std::complex<double>> y_n{12, l_f, 0.0}, y_s{24, l_f, 0.0};
+        for (il::int_t f = 0; f < l_f; ++f) {
+            for (int j = 0; j < 12; ++j) {
+                std::complex<double> x_j = x_n(j, f);
+                for (int i = 0; i < 12; ++i) {
+                    y_n(i, f) += k_n_(i + 12 * j, f) * x_j;
+                }
+            }
+            for (int j = 0; j < 24; ++j) {
+                std::complex<double> x_j = x_s(j, f);
+                for (int i = 0; i < 24; ++i) {
+                    y_s(i, f) += k_s_(i + 24 * j, f) * x_j;
+                }
+            }
+        }
+        for (il::int_t i = 0; i < 12; ++i) {
+            fft_2d(tw_x_, tw_y_, l_x_, l_y_, 12, true, il::io, y_n.data() + i);
+        }
+        for (il::int_t i = 0; i < 24; ++i) {
+            fft_2d(tw_x_, tw_y_, l_x_, l_y_, 24, true, il::io, y_s.data() + i);
+        }
+
+        // tractions at CP (the inverse FFT is unscaled)
+        const double sc = 1.0 / l_f;
+        il::Array<double> tr{size()};
+        for (il::int_t iy = 0; iy < n_y; ++iy) {
+            for (il::int_t ix = 0; ix < n_x; ++ix) {
+                il::int_t f = ix + l_x_ * iy;
+                il::int_t c = ix + n_x * iy;
+                for (int t = 0; t < 2; ++t) {
+                    for (int n = 0; n < 6; ++n) {
+                        il::int_t d_0 = 18 * (2 * c + t) + 3 * n;
+                        tr[d_0] = sc * std::real(y_s(12 * t + 2 * n, f));
+                        tr[d_0 + 1] = sc * std::real(y_s(12 * t + 2 * n + 1, f));
+                        tr[d_0 + 2] = sc * std::real(y_n(6 * t + n, f));
+                    }
+                }
+            }
+        }
+        return tr;
+    }
+
+}
@@ -0,0 +1,75 @@
+//
+// This file is part of HFPx3D_VC.
+//
+// Created by agent on 10/19/2026.
+// Copyright (c) ECOLE POLYTECHNIQUE FEDERALE DE LAUSANNE, Switzerland,
+// Geo-Energy Laboratory, 2026.  All rights reserved.
+// See the LICENSE.TXT file for more details.
+//
+
+// Structured planar grid: n_x * n_y rectangular cells in the x-y plane,
+// each split into 2 triangles. The influence of an element on another
+// one depends only on their types and the offset between their cells,
+// so that the traction-vs-DD operator is a (2-level) block-Toeplitz one
+// and is applied by FFT in O(N log N) operations with O(N) memory
+
+#ifndef INC_HFPX3D_STRUCTURED_GRID_H
+#define INC_HFPX3D_STRUCTURED_GRID_H
+
+#include <complex>
+#include <il/Array.h>
+#include <il/Array2D.h>
+#include "mesh_utilities.h"
+
+namespace hfp3d {
+
+    // grid parameters
+    struct Str_Grid_T {
+        // number of cells along x and y
+        il::int_t n_x = 0;
+        il::int_t n_y = 0;
+        // cell size
+        double d_x = 1.0;
+        double d_y = 1.0;
+    };
+
+    // The grid as a mesh: node ix + (n_x + 1) * iy at (ix * d_x, iy * d_y);
+    // element 2 * (ix + n_x * iy) + t, t = 0: (p00, p10, p11),
+    // t = 1: (p00, p11, p01), pij being the corners of the cell
+    Mesh_Geom_T make_str_grid_mesh(const Str_Grid_T &grid);
+
+    // Traction-vs-DD operator on the grid (all DoF free).
+    // DD at the nodes and tractions at the CP are in terms of
+    // the reference coordinates, tractions are w.r. to the normal (0, 0, -1)
+    // (see Planar_VC_T); the unknowns are numbered as
+    // 18 * element + 3 * node + component (see make_dof_h_crack)
+    class Str_Grid_Op {
+    private:
+        Str_Grid_T grid_;
+        // size of the (zero-padded) periodic grid
+        il::int_t l_x_;
+        il::int_t l_y_;
+        // FFT twiddle factors
+        il::Array<std::complex<double>> tw_x_;
+        il::Array<std::complex<double>> tw_y_;
+        // spectra of cell-to-cell blocks: opening (12 x 12)
+        // and shear (24 x 24), column-wise, for each frequency
+        il::Array2D<std::complex<double>> k_n_;
+        il::Array2D<std::complex<double>> k_s_;
+
+    public:
+        // the distinct influence blocks (2 source elements vs
+        // all offsets of the target cell) are calculated here
+        Str_Grid_Op(double mu, double nu,
+                    const Str_Grid_T &grid,
+                    const Num_Param_T &n_par);
+
+        il::int_t size() const { return 36 * grid_.n_x * grid_.n_y; };
+
+        // tractions at all CP for given DD
+        il::Array<double> dot(const il::Array<double> &dd) const;
+    };
+
+}
+
+#endif //INC_HFPX3D_STRUCTURED_GRID_H
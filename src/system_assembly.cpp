@@ -7,7 +7,11 @@
 // See the LICENSE.TXT file for more details. 
 //
 
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
 #include <iostream>
+#include <utility>
 #include <complex>
 #include <il/math.h>
 #include <il/Array2D.h>
@@ -41,160 +45,289 @@ namespace hfp3d {
         // in terms of the element's own local coordinate system (tau-coordinates);
         // h and z define the position of the (collocation) point x
         // in the same coordinates
+        // (see make_src_el_prep and make_local_3dbem_submatrices)
+
+        il::Array<double> h_l{1, h};
+        il::Array<std::complex<double>> z_l{1, z};
+        il::Array<il::StaticArray2D<double, 6, 18>> stress_el_2_el_infl =
+                make_local_3dbem_submatrices
+                        (make_src_el_prep(kernel_id, mu, nu, tau, sfm),
+                         h_l, z_l);
+        return stress_el_2_el_infl[0];
+    }
 
-        il::StaticArray2D<double, 6, 18> stress_el_2_el_infl{0.0};
+    // Source element preparation
+    Src_El_Prep_T make_src_el_prep
+            (const int kernel_id,
+             double mu, double nu,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm) {
+        // This function sets the quantities of make_local_3dbem_submatrix
+        // which depend on the source element only
+        Src_El_Prep_T prep;
+        prep.kernel_id = kernel_id;
+        prep.nu = nu;
+        // scaling ("-" sign comes from traction Somigliana ID, H-term)
+        prep.scale = -mu / (4.0 * M_PI * (1.0 - nu));
+        prep.tau = tau;
+        for (int j = 0; j < 3; ++j) {
+            int q = (j + 1) % 3;
+            std::complex<double> dtau = tau[q] - tau[j];
+            prep.ntau2[j] = dtau / std::conj(dtau);
+        }
+        prep.sfm = sfm;
+        return prep;
+    }
 
-        // const std::complex<double> I(0.0, 1.0);
+    // Element-to-point influence matrices for a span of points
+    il::Array<il::StaticArray2D<double, 6, 18>> make_local_3dbem_submatrices
+            (const Src_El_Prep_T &prep,
+             const il::Array<double> &h,
+             const il::Array<std::complex<double>> &z) {
+        // This function assembles local "stiffness" sub-matrices
+        // (see make_local_3dbem_submatrix) for n_pt points (h[k], z[k])
+        // in terms of the source element's local coordinates.
+        // The constituing functions of all (point, edge) pairs
+        // are evaluated in batches (integral_cst_fun_batch),
+        // the shape functions are shifted to each point analytically
+
+        const il::int_t n_pt = h.size();
+        IL_EXPECT_FAST(z.size() == n_pt);
+        const int kernel_id = prep.kernel_id;
+        const double nu = prep.nu;
 
-        // scaling ("-" sign comes from traction Somigliana ID, H-term)
-        double scale = -mu / (4.0 * M_PI * (1.0 - nu));
         // tolerance parameters
         const double h_tol = 1.0E-16, a_tol = 1.0E-8;
 
-        // tz[m] and d[m] can be calculated here
-        il::StaticArray<std::complex<double>, 3> tz, d, dtau;
-        std::complex<double> ntau2;
-        for (int j = 0; j < 3; ++j) {
-            int q = (j + 1) % 3;
-            tz[j] = tau[j] - z;
-            dtau[j] = tau[q] - tau[j];
-            ntau2 = dtau[j] / std::conj(dtau[j]);
-            d[j] = 0.5 * (tz[j] - ntau2 * std::conj(tz[j]));
-        }
-        // also, "shifted" sfm from z, tau[m], and local sfm
-        il::StaticArray2D<std::complex<double>, 6, 6> shft_z = shift_el_sfm(z);
-        il::StaticArray2D<std::complex<double>, 6, 6> sfm_z =
-                il::dot(sfm, shft_z);
-
-        // searching for "degenerate" edges:
-        // point x (collocation pt) projects onto an edge line or a vertex
-        bool IsDegen = std::abs(d[0]) < h_tol || std::abs(d[1]) < h_tol ||
-                       std::abs(d[2]) < h_tol; // (d[0]*d[1]*d[2]==0);
-        il::StaticArray2D<bool, 2, 3> is_90_ang{false};
-
-        // calculating angles (phi, psi, chi)
-        il::StaticArray<double, 3> phi{0.0}, psi{0.0};
-        il::StaticArray2D<double, 2, 3> chi{0.0};
-        for (int j = 0; j < 3; ++j) {
-            phi[j] = std::arg(tz[j]);
-            psi[j] = std::arg(d[j]);
+        // geometry of (point, edge) pairs, k = 3 * point + edge:
+        // d (normal projection of tz onto the edge line) and |d|,
+        // exp(I * chi) at both ends of the edge (n: next vertex, m: this one),
+        // signed distances from the projection to the ends (an, am),
+        // case (0: skipped, 1: limit case h = 0, 2: general case)
+        il::Array<std::complex<double>> d_e{3 * n_pt}, eixn_e{3 * n_pt},
+                eixm_e{3 * n_pt}, e_tz{3 * n_pt};
+        il::Array<double> abs_d_e{3 * n_pt}, an_e{3 * n_pt}, am_e{3 * n_pt};
+        il::Array<int> case_e{3 * n_pt}, is_degen{n_pt};
+        il::int_t n_gen = 0, n_red = 0;
+        for (il::int_t p = 0; p < n_pt; ++p) {
+            il::StaticArray<std::complex<double>, 3> tz;
+            // calculating angles (phi, psi, chi)
+            // (exp(I * chi) formed from the ratios of tz and d instead,
+            // even normalized, is less accurate for chi close to 90 degrees,
+            // where the limit case amplifies its error)
+            il::StaticArray<double, 3> phi{0.0}, psi{0.0};
+            for (int j = 0; j < 3; ++j) {
+                il::int_t k = 3 * p + j;
+                tz[j] = prep.tau[j] - z[p];
+                d_e[k] = 0.5 * (tz[j] - prep.ntau2[j] * std::conj(tz[j]));
+                abs_d_e[k] = std::abs(d_e[k]);
+                phi[j] = std::arg(tz[j]);
+                psi[j] = std::arg(d_e[k]);
+                // exp(I * phi[j])
+                e_tz[k] = std::exp(std::complex<double>(0.0, phi[j]));
+            }
+
+            // searching for "degenerate" edges:
+            // point x (collocation pt) projects onto an edge line or a vertex
+            bool IsDegen = abs_d_e[3 * p] < h_tol ||
+                           abs_d_e[3 * p + 1] < h_tol ||
+                           abs_d_e[3 * p + 2] < h_tol;
+            il::StaticArray2D<bool, 2, 3> is_90_ang{false};
+            il::StaticArray2D<double, 2, 3> chi{0.0};
+            for (int j = 0; j < 3; ++j) {
+                for (int k = 0; k < 2; ++k) {
+                    int q = (j + k) % 3;
+                    chi(k, j) = phi[q] - psi[j];
+                    // make sure it's between -pi and pi (add or subtract 2*pi)
+                    if (chi(k, j) <= -M_PI)
+                        while (chi(k, j) <= -M_PI)
+                            chi(k, j) += 2.0 * M_PI;
+                    else if (chi(k, j) > M_PI)
+                        while (chi(k, j) > M_PI)
+                            chi(k, j) -= 2.0 * M_PI;
+                    // reprooving for "degenerate" edges
+                    // (chi angles too close to 90 degrees)
+                    if (fabs(M_PI_2 - std::fabs(chi(k, j))) < a_tol) {
+                        is_90_ang(k, j) = true;
+                        IsDegen = true;
+                    }
+                }
+            }
+            is_degen[p] = IsDegen ? 1 : 0;
+
+            for (int m = 0; m < 3; ++m) {
+                il::int_t k = 3 * p + m;
+                int n = (m + 1) % 3;
+                // exp(I * chi(0, m)), exp(I * chi(1, m))
+                eixm_e[k] = std::exp(std::complex<double>(0.0, chi(0, m)));
+                eixn_e[k] = std::exp(std::complex<double>(0.0, chi(1, m)));
+                case_e[k] = 0;
+                if (abs_d_e[k] >= h_tol &&
+                    !is_90_ang(0, m) && !is_90_ang(1, m)) {
+                    if (std::fabs(h[p]) < h_tol) {
+                        case_e[k] = 1;
+                    } else {
+                        case_e[k] = 2;
+                        double an = std::abs(tz[n] - d_e[k]),
+                                am = std::abs(tz[m] - d_e[k]);
+                        an_e[k] = (chi(1, m) < 0) ? -an : an;
+                        am_e[k] = (chi(0, m) < 0) ? -am : am;
+                        ++n_gen;
+                        if (IsDegen) ++n_red;
+                    }
+                }
+            }
         }
-        for (int j = 0; j < 3; ++j) {
-            for (int k = 0; k < 2; ++k) {
-                int q = (j + k) % 3;
-                chi(k, j) = phi[q] - psi[j];
-                // make sure it's between -pi and pi (add or subtract 2*pi)
-                if (chi(k, j) <= -M_PI)
-                    while (chi(k, j) <= -M_PI)
-                        chi(k, j) += 2.0 * M_PI;
-                else if (chi(k, j) > M_PI)
-                    while (chi(k, j) > M_PI)
-                        chi(k, j) -= 2.0 * M_PI;
-                // reprooving for "degenerate" edges
-                // (chi angles too close to 90 degrees)
-                if (fabs(M_PI_2 - std::fabs(chi(k, j))) < a_tol) {
-                    is_90_ang(k, j) = true;
-                    IsDegen = true;
-                }
-            }
-        }
-
-        // DD-to-stress influence
-        // [(S11+S22)/2; (S11-S22)/2+i*S12; (S13+i*S23)/2; S33]
-        // vs SF monomials (s_ij_infl_mon) and nodal values (s_ij_infl_nod)
-        il::StaticArray3D<std::complex<double>, 6, 4, 3> s_ij_infl_mon{0.0};
-
-        // summation over edges
-        for (int m = 0; m < 3; ++m) {
-            int n = (m + 1) % 3;
-            std::complex<double> dm = d[m];
-            if (std::abs(dm) >= h_tol && ~is_90_ang(0, m) && ~is_90_ang(1, m)) {
-                std::complex<double>
-                // exp(I * chi(0, m))
-                        eixm = std::exp(std::complex<double>(0.0, chi(0, m))),
-                // exp(I * chi(1, m))
-                        eixn = std::exp(std::complex<double>(0.0, chi(1, m)));
-                // limit case (point x on the element's plane)
-                if (std::fabs(h) < h_tol) {
-                    il::StaticArray3D<std::complex<double>, 6, 4, 3>
-                            s_incr_n =
-                            s_integral_lim(kernel_id, nu, eixn, dm),
-                            s_incr_m =
-                            s_integral_lim(kernel_id, nu, eixm, dm);
-                    for (int j = 0; j < 6; ++j) {
-                        for (int k = 0; k < 4; ++k) {
-                            for (int l = 0; l < 3; ++l) {
-                                s_ij_infl_mon(j, k, l) += s_incr_n(j, k, l) -
-                                                          s_incr_m(j, k, l);
-                            }
-                        }
+
+        // constituing functions of the integrals (real-valued)
+        // for both ends of the edges, in batches;
+        // rows 2 * (i-th general case) + 0 (n) or 1 (m)
+        il::Array<double> h_b{2 * n_gen}, abs_d_b{2 * n_gen}, a_b{2 * n_gen};
+        il::Array<std::complex<double>> eix_b{2 * n_gen};
+        il::Array<double> h_rb{2 * n_red}, abs_d_rb{2 * n_red},
+                a_rb{2 * n_red};
+        il::int_t i_g = 0, i_r = 0;
+        for (il::int_t k = 0; k < 3 * n_pt; ++k) {
+            if (case_e[k] != 2) continue;
+            il::int_t p = k / 3;
+            h_b[2 * i_g] = h[p];
+            h_b[2 * i_g + 1] = h[p];
+            abs_d_b[2 * i_g] = abs_d_e[k];
+            abs_d_b[2 * i_g + 1] = abs_d_e[k];
+            a_b[2 * i_g] = an_e[k];
+            a_b[2 * i_g + 1] = am_e[k];
+            eix_b[2 * i_g] = eixn_e[k];
+            eix_b[2 * i_g + 1] = eixm_e[k];
+            ++i_g;
+            if (is_degen[p] == 1) {
+                h_rb[2 * i_r] = h[p];
+                h_rb[2 * i_r + 1] = h[p];
+                abs_d_rb[2 * i_r] = abs_d_e[k];
+                abs_d_rb[2 * i_r + 1] = abs_d_e[k];
+                a_rb[2 * i_r] = an_e[k];
+                a_rb[2 * i_r + 1] = am_e[k];
+                ++i_r;
+            }
+        }
+        // (arguments of atan and atanh: scratch for both batches)
+        il::Array2D<double> f_b{2 * n_gen, 9}, f_rb{2 * n_red, 5};
+        il::Array<double> g_arg{2 * n_gen}, f_arg{2 * n_gen};
+        integral_cst_fun_batch(h_b, abs_d_b, a_b, eix_b,
+                               il::io, f_b, g_arg, f_arg);
+        integral_cst_fun_red_batch(h_rb, abs_d_rb, a_rb, il::io, f_rb, f_arg);
+
+        il::Array<il::StaticArray2D<double, 6, 18>> stress_el_2_el_infl{n_pt};
+        i_g = 0;
+        i_r = 0;
+        for (il::int_t p = 0; p < n_pt; ++p) {
+            // DD-to-stress influence
+            // [(S11+S22)/2; (S11-S22)/2+i*S12; (S13+i*S23)/2; S33]
+            // vs SF monomials (s_mon_re + I * s_mon_im)
+            // and nodal values (s_ij_infl_nod);
+            // only the independent real quantities are accumulated
+            // (see s_ij_gen_h_contr_r in h_potential.h)
+            il::StaticArray3D<double, 6, 4, 3> s_mon_re{0.0}, s_mon_im{0.0};
+
+            // summation over edges
+            for (int m = 0; m < 3; ++m) {
+                il::int_t k = 3 * p + m;
+                int n = (m + 1) % 3;
+                std::complex<double> dm = d_e[k];
+                if (case_e[k] == 1) {
+                    // limit case (point x on the element's plane)
+                    s_integral_lim_contr_r(kernel_id, nu, eixn_e[k], dm,
+                                           1.0, il::io, s_mon_re, s_mon_im);
+                    s_integral_lim_contr_r(kernel_id, nu, eixm_e[k], dm,
+                                           -1.0, il::io, s_mon_re, s_mon_im);
+                } else if (case_e[k] == 2) { // out-of-plane case
+                    il::StaticArray<double, 9> f_n, f_m;
+                    for (int l = 0; l < 9; ++l) {
+                        f_n[l] = f_b(2 * i_g, l);
+                        f_m[l] = f_b(2 * i_g + 1, l);
                     }
-                    // il::blas(1.0, s_incr_n, 1.0, il::io, s_ij_infl_mon);
-                    // il::blas(-1.0, s_incr_m, 1.0, il::io, s_ij_infl_mon);
-                } else { // out-of-plane case
-                    double an = std::abs(tz[n] - dm),
-                            am = std::abs(tz[m] - dm);
-                    an = (chi(1, m) < 0) ? -an : an;
-                    am = (chi(0, m) < 0) ? -am : am;
-                    // constituing functions of the integrals
-                    il::StaticArray<std::complex<double>, 9>
-                            f_n = integral_cst_fun(h, dm, an, chi(1, m), eixn),
-                            f_m = integral_cst_fun(h, dm, am, chi(0, m), eixm);
-                    // coefficients, by 2nd index:
-                    // 0: S11+S22; 1: S11-S22+2*I*S12; 2: S13+S23; 3: S33
-                    il::StaticArray4D<std::complex<double>, 6, 4, 3, 9>
-                            c_n = s_integral_gen(kernel_id, nu, eixn, h, dm),
-                            c_m = s_integral_gen(kernel_id, nu, eixm, h, dm);
+                    ++i_g;
                     // combining constituing functions & coefficients
-                    il::blas(1.0, c_n, f_n, 1.0, il::io, s_ij_infl_mon);
-                    il::blas(-1.0, c_m, f_m, 1.0, il::io, s_ij_infl_mon);
+                    // (by 2nd index: 0: S11+S22; 1: S11-S22+2*I*S12;
+                    // 2: S13+S23; 3: S33) without forming the latter
+                    s_integral_gen_contr_r(kernel_id, nu, eixn_e[k], h[p],
+                                           dm, f_n, 1.0,
+                                           il::io, s_mon_re, s_mon_im);
+                    s_integral_gen_contr_r(kernel_id, nu, eixm_e[k], h[p],
+                                           dm, f_m, -1.0,
+                                           il::io, s_mon_re, s_mon_im);
                     // additional terms for "degenerate" case
-                    if (IsDegen) {
-                        std::complex<double>
-                        // exp(I * phi[n])
-                                eipn = std::exp(std::complex<double>
-                                                        (0.0, phi[n])),
-                        // exp(I * phi[m])
-                                eipm = std::exp(std::complex<double>
-                                                        (0.0, phi[m]));
-                        il::StaticArray<std::complex<double>, 5>
-                                f_n_red = integral_cst_fun_red(h, dm, an),
-                                f_m_red = integral_cst_fun_red(h, dm, am);
-                        il::StaticArray4D<std::complex<double>, 6, 4, 3, 5>
-                                c_n_red = s_integral_red(kernel_id, nu, eipn, h),
-                                c_m_red = s_integral_red(kernel_id, nu, eipm, h);
-                        il::blas(1.0, c_n_red, f_n_red, 1.0,
-                                 il::io, s_ij_infl_mon);
-                        il::blas(-1.0, c_m_red, f_m_red, 1.0,
-                                 il::io, s_ij_infl_mon);
+                    if (is_degen[p] == 1) {
+                        il::StaticArray<double, 5> f_n_red, f_m_red;
+                        for (int l = 0; l < 5; ++l) {
+                            f_n_red[l] = f_rb(2 * i_r, l);
+                            f_m_red[l] = f_rb(2 * i_r + 1, l);
+                        }
+                        ++i_r;
+                        // exp(I * phi[n]), exp(I * phi[m])
+                        s_integral_red_contr_r(kernel_id, nu,
+                                               e_tz[3 * p + n], h[p], f_n_red,
+                                               1.0, il::io, s_mon_re, s_mon_im);
+                        s_integral_red_contr_r(kernel_id, nu,
+                                               e_tz[3 * p + m], h[p], f_m_red,
+                                               -1.0, il::io, s_mon_re, s_mon_im);
                     }
                 }
             }
-        }
 
-        // contraction with "shifted" sfm (left)
-        il::StaticArray3D<std::complex<double>, 6, 4, 3>
-                s_ij_infl_nod = il::dot(sfm_z, s_ij_infl_mon);
+            // contraction with "shifted" sfm (left);
+            // the SFs are real: sfm(j, 2) = conj(sfm(j, 1)),
+            // sfm(j, 4) = conj(sfm(j, 3)), sfm(j, 0) and sfm(j, 5) are real
+            il::StaticArray2D<std::complex<double>, 6, 6> sfm_z =
+                    shift_el_sfm(prep.sfm, z[p]);
+            il::StaticArray3D<std::complex<double>, 6, 4, 3> s_ij_infl_nod;
+            for (int j = 0; j < 6; ++j) {
+                for (int k = 0; k < 3; ++k) {
+                    // real stress combinations (2nd index 0, 3)
+                    for (int l = 0; l < 4; l += 3) {
+                        double v = std::real(sfm_z(j, 0)) * s_mon_re(0, l, k) +
+                                std::real(sfm_z(j, 5)) * s_mon_re(5, l, k);
+                        for (int a = 1; a < 4; a += 2) {
+                            v += 2.0 * (std::real(sfm_z(j, a)) *
+                                        s_mon_re(a, l, k) -
+                                        std::imag(sfm_z(j, a)) *
+                                        s_mon_im(a, l, k));
+                        }
+                        s_ij_infl_nod(j, l, k) = v;
+                    }
+                    // complex ones (2nd index 1, 2)
+                    for (int l = 1; l < 3; ++l) {
+                        std::complex<double> v = 0.0;
+                        for (int a = 0; a < 6; ++a) {
+                            v += sfm_z(j, a) * std::complex<double>
+                                    (s_mon_re(a, l, k), s_mon_im(a, l, k));
+                        }
+                        s_ij_infl_nod(j, l, k) = v;
+                    }
+                }
+            }
 
-        // re-shaping and scaling of the resulting matrix
-        for (int j = 0; j < 6; ++j) {
-            int q = j * 3;
-            for (int k = 0; k < 3; ++k) {
-                // [S11; S22; S33; S12; S13; S23] vs \delta{u}_k at j-th node
-                stress_el_2_el_infl(0, q + k) =
-                        scale * (std::real(s_ij_infl_nod(j, 0, k)) +
-                                 std::real(s_ij_infl_nod(j, 1, k)));
-                stress_el_2_el_infl(1, q + k) =
-                        scale * (std::real(s_ij_infl_nod(j, 0, k)) -
-                                 std::real(s_ij_infl_nod(j, 1, k)));
-                stress_el_2_el_infl(2, q + k) =
-                        scale * std::real(s_ij_infl_nod(j, 3, k));
-                stress_el_2_el_infl(3, q + k) =
-                        scale * std::imag(s_ij_infl_nod(j, 1, k));
-                stress_el_2_el_infl(4, q + k) =
-                        scale * 2.0 * std::real(s_ij_infl_nod(j, 2, k));
-                stress_el_2_el_infl(5, q + k) =
-                        scale * 2.0 * std::imag(s_ij_infl_nod(j, 2, k));
+            // re-shaping and scaling of the resulting matrix
+            const double scale = prep.scale;
+            il::StaticArray2D<double, 6, 18> &st_infl = stress_el_2_el_infl[p];
+            for (int j = 0; j < 6; ++j) {
+                int q = j * 3;
+                for (int k = 0; k < 3; ++k) {
+                    // [S11; S22; S33; S12; S13; S23] vs \delta{u}_k at j-th node
+                    st_infl(0, q + k) =
+                            scale * (std::real(s_ij_infl_nod(j, 0, k)) +
+                                     std::real(s_ij_infl_nod(j, 1, k)));
+                    st_infl(1, q + k) =
+                            scale * (std::real(s_ij_infl_nod(j, 0, k)) -
+                                     std::real(s_ij_infl_nod(j, 1, k)));
+                    st_infl(2, q + k) =
+                            scale * std::real(s_ij_infl_nod(j, 3, k));
+                    st_infl(3, q + k) =
+                            scale * std::imag(s_ij_infl_nod(j, 1, k));
+                    st_infl(4, q + k) =
+                            scale * 2.0 * std::real(s_ij_infl_nod(j, 2, k));
+                    st_infl(5, q + k) =
+                            scale * 2.0 * std::imag(s_ij_infl_nod(j, 2, k));
+                }
             }
         }
         return stress_el_2_el_infl;
@@ -229,6 +362,10 @@ namespace hfp3d {
         //IL_EXPECT_FAST(global_matrix.size(0) == 18*num_ele);
         //IL_EXPECT_FAST(global_matrix.size(1) == 18*num_ele);
 
+        // non-trivial edge partitioning (see Mesh_Geom_T)
+        const bool is_graded = mesh.vert_wts.size() > 0;
+        IL_EXPECT_FAST(!is_graded || mesh.vert_wts.size() == mesh.nods.size(1));
+
         il::Array2D<double> global_matrix {num_dof, num_dof, 0.0};
         //il::StaticArray2D<double, num_dof, num_dof> global_matrix;
         //il::StaticArray<double, num_dof> right_hand_side;
@@ -239,21 +376,21 @@ namespace hfp3d {
              source_elem < num_ele; ++source_elem) {
             // Vertices' coordinates
             il::StaticArray2D<double, 3, 3> el_vert_s;
-            //il::StaticArray<double, 3> vert_wts_s;
+            il::StaticArray<double, 3> vert_wts_s{1.0};
             for (il::int_t j = 0; j < 3; ++j) {
                 il::int_t n = mesh.conn(j, source_elem);
                 for (il::int_t k = 0; k < 3; ++k) {
                     el_vert_s(k, j) = mesh.nods(k, n);
                 }
-                // set vert_wts_s[j]
+                if (is_graded) vert_wts_s[j] = mesh.vert_wts[n];
             }
 
             // Basis (shape) functions and rotation tensor of the el-t
             il::StaticArray2D<double, 3, 3> r_tensor_s;
-            il::StaticArray2D<std::complex<double>, 6, 6> sfm =
+            il::StaticArray2D<std::complex<double>, 6, 6> sfm = is_graded ?
+                    make_el_sfm_nonuniform
+                            (el_vert_s, vert_wts_s, il::io, r_tensor_s) :
                     make_el_sfm_uniform(el_vert_s, il::io, r_tensor_s);
-            //il::StaticArray2D<std::complex<double>, 6, 6> sfm =
-            // make_el_sfm_nonuniform(r_tensor, el_vert, vert_wts_s);
 
             // Complex-valued positions of "source" element nodes
             il::StaticArray<std::complex<double>, 3> tau =
@@ -264,13 +401,13 @@ namespace hfp3d {
                  target_elem < num_ele; ++target_elem) {
                 // Vertices' coordinates
                 il::StaticArray2D<double, 3, 3> el_vert_t;
-                //il::StaticArray<double, 3> vert_wts_t;
+                il::StaticArray<double, 3> vert_wts_t{1.0};
                 for (il::int_t j = 0; j < 3; ++j) {
                     il::int_t n = mesh.conn(j, target_elem);
                     for (il::int_t k = 0; k < 3; ++k) {
                         el_vert_t(k, j) = mesh.nods(k, n);
                     }
-                    // set vert_wts_t[j]
+                    if (is_graded) vert_wts_t[j] = mesh.vert_wts[n];
                 }
 
                 // Rotation tensor for the target element
@@ -285,9 +422,7 @@ namespace hfp3d {
 
                 // Collocation points' coordinates
                 il::StaticArray<il::StaticArray<double, 3>, 6> el_cp_crd =
-                        el_cp_uniform(el_vert_t, n_par.beta);
-                //il::StaticArray<il::StaticArray<double, 3>, 6> el_cp_crd =
-                // el_cp_nonuniform(el_vert_t,vert_wts_t,beta);
+                        el_cp_nonuniform(el_vert_t, vert_wts_t, n_par.beta);
 
                 il::StaticArray2D<double, 18, 18> trac_infl_el2el;
                 // Loop over nodes of the "target" element
@@ -401,27 +536,31 @@ namespace hfp3d {
 
         il::Array2D<double> stress_infl_matrix(6 * num_of_m_pts, num_dof);
 
+        // non-trivial edge partitioning (see Mesh_Geom_T)
+        const bool is_graded = mesh.vert_wts.size() > 0;
+        IL_EXPECT_FAST(!is_graded || mesh.vert_wts.size() == mesh.nods.size(1));
+
         // Loop over elements
 //#pragma omp parallel for
         for (il::int_t source_elem = 0; source_elem < num_ele; ++source_elem) {
             // Vertices' coordinates
             il::StaticArray2D<double, 3, 3> el_vert_s;
-            //il::StaticArray<double, 3> vert_wts_t;
+            il::StaticArray<double, 3> vert_wts_s{1.0};
             for (il::int_t j = 0; j < 3; ++j) {
                 il::int_t n = mesh.conn(j, source_elem);
                 for (il::int_t k = 0; k < 3; ++k) {
                     el_vert_s(k, j) = mesh.nods(k, n);
                 }
-                // get vert_wts_s[j]
+                if (is_graded) vert_wts_s[j] = mesh.vert_wts[n];
             }
 
             // Basis (shape) functions and
             // rotation tensor (r_tensor_s) of the element (source_elem)
             il::StaticArray2D<double, 3, 3> r_tensor_s;
-            il::StaticArray2D<std::complex<double>, 6, 6> sfm =
+            il::StaticArray2D<std::complex<double>, 6, 6> sfm = is_graded ?
+                    make_el_sfm_nonuniform
+                            (el_vert_s, vert_wts_s, il::io, r_tensor_s) :
                     make_el_sfm_uniform(el_vert_s, il::io, r_tensor_s);
-            //il::StaticArray2D<std::complex<double>, 6, 6> sfm =
-            // make_el_sfm_nonuniform(r_tensor, el_vert, vert_wts_s);
 
             // Complex-valued positions of "source" element nodes
             il::StaticArray<std::complex<double>, 3> tau =
@@ -515,6 +654,326 @@ namespace hfp3d {
         // return stress_array;
     }
 
+    // Element properties for all elements of the mesh
+    il::Array<Element_Struct_T> make_ele_struct_list
+            (const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par) {
+// This function sets vertices, rotation tensor, collocation points
+// and shape functions (see set_ele_struct) for each element
+// so that they are calculated once per assembly;
+// the edge nodes are defined by mesh.vert_wts if not empty
+        const il::int_t num_ele = mesh.conn.size(1);
+        const bool is_graded = mesh.vert_wts.size() > 0;
+        IL_EXPECT_FAST(!is_graded || mesh.vert_wts.size() == mesh.nods.size(1));
+        il::Array<Element_Struct_T> ele_l{num_ele};
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            // Vertices' coordinates
+            il::StaticArray2D<double, 3, 3> el_vert;
+            il::StaticArray<double, 3> vert_wts;
+            for (il::int_t j = 0; j < 3; ++j) {
+                il::int_t n = mesh.conn(j, el);
+                for (il::int_t k = 0; k < 3; ++k) {
+                    el_vert(k, j) = mesh.nods(k, n);
+                }
+                if (is_graded) vert_wts[j] = mesh.vert_wts[n];
+            }
+            ele_l[el] = is_graded ?
+                        set_ele_struct(el_vert, vert_wts, n_par.beta) :
+                        set_ele_struct(el_vert, n_par.beta);
+        }
+        return ele_l;
+    }
+
+    // VC row & column entries of one element
+    void set_el_vc_border
+            (const Element_Struct_T &ele_s,
+             il::int_t source_elem,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             il::io_t, il::Array2D<double> &global_matrix) {
+// This function adds the influence of DD of the element (ele_s)
+// on the fluid volume (last row of the VC matrix)
+// and of pressure on tractions at its collocation points (last column);
+// DoF shared by several elements (see make_dof_h_conforming)
+// get the sum of their contributions
+        const il::int_t num_dof = dof_hndl.n_dof;
+        const double area = el_area(ele_s.vert);
+        il::StaticArray<double, 6> el_sf_integral =
+                el_p2_sf_integral_ref(ele_s.vert_wts);
+        for (int n_s = 0; n_s < 6; ++n_s) {
+            // Integral of n_s-th shape function over the s-element
+            double sf_integral = area * el_sf_integral[n_s];
+            il::StaticArray<double, 3> sf_i_v {0.0};
+            // Integral of normal DD (opening) over the element
+            // for the n_s-th shape function
+            if (!n_par.is_dd_local) {
+                // dot([0, 0, sf_integral], r_tensor_s)
+                for (int j = 0; j < 3; ++j) {
+                    sf_i_v[j] = sf_integral * ele_s.r_tensor(2, j);
+                }
+            } else {
+                // [0, 0, sf_integral]
+                sf_i_v[2] = sf_integral;
+            }
+            for (int j = 0; j < 3; ++j) {
+                int l = n_s * 3 + j;
+                il::int_t s_dof = dof_hndl.dof_h(source_elem, l);
+                if (s_dof >= 0) {
+                    // Volume vs DD
+                    global_matrix(num_dof, s_dof) += sf_i_v[j];
+                    // Tractions vs pressure
+                    global_matrix(s_dof, num_dof) -=
+                            ele_s.r_tensor(2, j); // Normal at element
+                }
+            }
+        }
+    }
+
+    // Element-to-element traction influence matrix (VC matrix block)
+    il::StaticArray2D<double, 18, 18> make_el2el_vc_submatrix
+            (double mu, double nu,
+             const Element_Struct_T &ele_s,
+             const Element_Struct_T &ele_t,
+             bool is_dd_local) {
+// This function calculates the influence of DD at the nodes
+// of the "source" element (ele_s) to tractions at the collocation points
+// of the "target" element (ele_t); tractions are in terms of
+// the reference coordinate system, DD are either in terms of
+// the same system (is_dd_local == false)
+// or w.r. to the source element's local coordinates
+
+        // Complex-valued positions of "source" element nodes
+        il::StaticArray<std::complex<double>, 3> tau =
+                make_el_tau_crd(ele_s.vert, ele_s.r_tensor);
+        Src_El_Prep_T prep = make_src_el_prep(1, mu, nu, tau, ele_s.sf_m);
+
+        il::Array<Element_Struct_T> ele_l{1, ele_t};
+        il::Array<il::int_t> t_el_l{1, 0};
+        il::Array<il::StaticArray2D<double, 18, 18>> trac_infl_el2el =
+                make_el2el_vc_submatrices(prep, ele_s, ele_l, t_el_l,
+                                          is_dd_local);
+        return trac_infl_el2el[0];
+    }
+
+    // The same for a list of "target" elements
+    il::Array<il::StaticArray2D<double, 18, 18>> make_el2el_vc_submatrices
+            (const Src_El_Prep_T &prep,
+             const Element_Struct_T &ele_s,
+             const il::Array<Element_Struct_T> &ele_l,
+             const il::Array<il::int_t> &t_el_l,
+             bool is_dd_local) {
+// This function calculates the blocks of make_el2el_vc_submatrix
+// for the "source" element ele_s (prepared as prep)
+// and the "target" elements ele_l[t_el_l[t]];
+// the stress influence at all their collocation points is evaluated
+// at once (see make_local_3dbem_submatrices)
+
+        const il::int_t n_t_el = t_el_l.size();
+
+        // Shifting to the collocation pts of all "target" elements
+        il::Array<double> h_cp{6 * n_t_el};
+        il::Array<std::complex<double>> z_cp{6 * n_t_el};
+        for (il::int_t t = 0; t < n_t_el; ++t) {
+            const Element_Struct_T &ele_t = ele_l[t_el_l[t]];
+            for (int n_t = 0; n_t < 6; ++n_t) {
+                HZ hz = make_el_pt_hz
+                        (ele_s.vert, ele_t.cp_crd[n_t], ele_s.r_tensor);
+                h_cp[6 * t + n_t] = hz.h;
+                z_cp[6 * t + n_t] = hz.z;
+            }
+        }
+
+        // Calculating DD-to stress influence
+        // w.r. to the source element's local coordinate system
+        il::Array<il::StaticArray2D<double, 6, 18>> stress_infl_el2p_loc_h =
+                make_local_3dbem_submatrices(prep, h_cp, z_cp);
+
+        il::Array<il::StaticArray2D<double, 18, 18>> trac_infl_el2el{n_t_el};
+        for (il::int_t t = 0; t < n_t_el; ++t) {
+            const Element_Struct_T &ele_t = ele_l[t_el_l[t]];
+
+            // Normal vector at collocation point (x)
+            il::StaticArray<double, 3> nrm_cp_glob;
+            for (int j = 0; j < 3; ++j) {
+                nrm_cp_glob[j] = -ele_t.r_tensor(2, j);
+            }
+
+            // Alternative 2: rotating nrm_cp_glob to
+            // the source element's local coordinate system
+            il::StaticArray<double, 3> nrm_cp_loc =
+                    il::dot(ele_s.r_tensor, nrm_cp_glob);
+
+            // Loop over nodes of the "target" element
+            for (int n_t = 0; n_t < 6; ++n_t) {
+                // Multiplication by normal at CP
+                il::StaticArray2D<double, 3, 18> trac_el2p_loc =
+                        nv_dot_sim(nrm_cp_loc,
+                                   stress_infl_el2p_loc_h[6 * t + n_t]);
+                il::StaticArray2D<double, 3, 18> trac_cp_glob = il::dot
+                        (ele_s.r_tensor, il::Blas::transpose, trac_el2p_loc);
+
+                if (!is_dd_local) {
+                    // Re-relating DD-to traction influence to DD
+                    // w.r. to the reference coordinate system
+                    il::StaticArray2D<double, 3, 3> trac_infl_n2p,
+                            trac_infl_n2p_glob;
+                    for (int n_s = 0; n_s < 6; ++n_s) {
+                        // taking a block (one node of the "source" element)
+                        for (int j = 0; j < 3; ++j) {
+                            for (int k = 0; k < 3; ++k) {
+                                trac_infl_n2p(k, j) =
+                                        trac_cp_glob(k, 3 * n_s + j);
+                            }
+                        }
+
+                        // Coordinate rotation (for the unknown)
+                        trac_infl_n2p_glob = il::dot(trac_infl_n2p,
+                                                     ele_s.r_tensor);
+
+                        // Adding the block to the element-to-element
+                        // influence sub-matrix
+                        for (int j = 0; j < 3; ++j) {
+                            for (int k = 0; k < 3; ++k) {
+                                trac_infl_el2el[t](3 * n_t + k, 3 * n_s + j) =
+                                        trac_infl_n2p_glob(k, j);
+                            }
+                        }
+                    }
+                } else {
+                    for (int dof_s = 0; dof_s < 18; ++dof_s) {
+                        for (int k = 0; k < 3; ++k) {
+                            trac_infl_el2el[t](3 * n_t + k, dof_s) =
+                                    trac_cp_glob(k, dof_s);
+                        }
+                    }
+                }
+            }
+        }
+        return trac_infl_el2el;
+    }
+
+    // Self-influence block from the cache
+    il::StaticArray2D<double, 18, 18> make_el2el_vc_self_submatrix
+            (double mu, double nu,
+             const Element_Struct_T &ele_s,
+             double beta,
+             bool is_dd_local,
+             il::io_t, Self_Block_Cache_T &cache) {
+// This function calculates the influence of DD at the nodes of the element
+// on tractions at its own collocation points (see make_el2el_vc_submatrix).
+// In terms of local coordinates, this block depends only on the shape
+// of the element, while tractions scale as 1/size: the block is calculated
+// once for the element with relabeled vertices (the longest edge first)
+// and the longest edge of unit length, and is shared by all elements with
+// the same (quantized with cache.tol) ratios of edge lengths;
+// elements with unequal vertices' weights are not cached
+        IL_EXPECT_FAST(cache.tol >= 1e-9);
+        if (ele_s.vert_wts[1] != ele_s.vert_wts[0] ||
+            ele_s.vert_wts[2] != ele_s.vert_wts[0]) {
+            return make_el2el_vc_submatrix(mu, nu, ele_s, ele_s, is_dd_local);
+        }
+
+        // edge lengths (edge v: from vertex v to vertex v + 1)
+        il::StaticArray<double, 3> el_l;
+        for (int v = 0; v < 3; ++v) {
+            il::StaticArray<double, 3> e;
+            for (int j = 0; j < 3; ++j) {
+                e[j] = ele_s.vert(j, (v + 1) % 3) - ele_s.vert(j, v);
+            }
+            el_l[v] = l2norm(e);
+        }
+        // cyclic relabeling of vertices: the c-th one becomes the 1st
+        int c = 0;
+        for (int v = 1; v < 3; ++v) {
+            if (el_l[v] > el_l[c]) c = v;
+        }
+        const double l_0 = el_l[c];
+        std::uint64_t q_1 = static_cast<std::uint64_t>
+                (std::llround(el_l[(c + 1) % 3] / l_0 / cache.tol));
+        std::uint64_t q_2 = static_cast<std::uint64_t>
+                (std::llround(el_l[(c + 2) % 3] / l_0 / cache.tol));
+        std::uint64_t key = (q_1 << 32) | q_2;
+
+        il::StaticArray2D<double, 3, 3> vert_c;
+        for (int v = 0; v < 3; ++v) {
+            for (int j = 0; j < 3; ++j) {
+                vert_c(j, v) = ele_s.vert(j, (v + c) % 3);
+            }
+        }
+        // rotation tensor for the relabeled element
+        il::StaticArray2D<double, 3, 3> r_c = make_el_r_tensor(vert_c);
+
+        auto it = cache.blk.find(key);
+        if (it == cache.blk.end()) {
+            Element_Struct_T ele_c = set_ele_struct(vert_c, beta);
+            Src_El_Prep_T prep = make_src_el_prep
+                    (1, mu, nu, make_el_tau_crd(ele_c.vert, ele_c.r_tensor),
+                     ele_c.sf_m);
+            il::Array<Element_Struct_T> ele_l{1, ele_c};
+            il::Array<il::int_t> t_el_l{1, 0};
+            // tractions in reference coordinates vs local DD
+            il::StaticArray2D<double, 18, 18> blk_c =
+                    make_el2el_vc_submatrices
+                            (prep, ele_c, ele_l, t_el_l, true)[0];
+            // tractions to local coordinates; scaling to unit size
+            il::StaticArray2D<double, 18, 18> blk_loc;
+            for (int n_t = 0; n_t < 6; ++n_t) {
+                for (int dof_s = 0; dof_s < 18; ++dof_s) {
+                    for (int k = 0; k < 3; ++k) {
+                        double t_k = 0.0;
+                        for (int l = 0; l < 3; ++l) {
+                            t_k += ele_c.r_tensor(k, l) *
+                                   blk_c(3 * n_t + l, dof_s);
+                        }
+                        blk_loc(3 * n_t + k, dof_s) = l_0 * t_k;
+                    }
+                }
+            }
+            it = cache.blk.emplace(key, blk_loc).first;
+        } else {
+            ++cache.n_hit;
+        }
+        const il::StaticArray2D<double, 18, 18> &blk_loc = it->second;
+
+        // DD rotation: from the reference (or the element's local)
+        // coordinates to the local ones of the relabeled element
+        il::StaticArray2D<double, 3, 3> r_dd = r_c;
+        if (is_dd_local) {
+            // dot(r_c, transpose(ele_s.r_tensor))
+            for (int j = 0; j < 3; ++j) {
+                for (int k = 0; k < 3; ++k) {
+                    r_dd(k, j) = 0.0;
+                    for (int l = 0; l < 3; ++l) {
+                        r_dd(k, j) += r_c(k, l) * ele_s.r_tensor(j, l);
+                    }
+                }
+            }
+        }
+
+        il::StaticArray2D<double, 18, 18> trac_infl_el2el;
+        for (int n_t = 0; n_t < 6; ++n_t) {
+            // node (CP) No after relabeling
+            int p_t = (n_t < 3) ? (n_t + 3 - c) % 3 : 3 + (n_t - c) % 3;
+            for (int n_s = 0; n_s < 6; ++n_s) {
+                int p_s = (n_s < 3) ? (n_s + 3 - c) % 3 : 3 + (n_s - c) % 3;
+                il::StaticArray2D<double, 3, 3> b;
+                for (int j = 0; j < 3; ++j) {
+                    for (int k = 0; k < 3; ++k) {
+                        b(k, j) = blk_loc(3 * p_t + k, 3 * p_s + j) / l_0;
+                    }
+                }
+                // tractions to reference coordinates, DD rotation
+                b = il::dot(il::dot(r_c, il::Blas::transpose, b), r_dd);
+                for (int j = 0; j < 3; ++j) {
+                    for (int k = 0; k < 3; ++k) {
+                        trac_infl_el2el(3 * n_t + k, 3 * n_s + j) = b(k, j);
+                    }
+                }
+            }
+        }
+        return trac_infl_el2el;
+    }
+
     // Volume Control matrix assembly (additional row $ column)
     il::Array2D<double> make_3dbem_matrix_vc
             (double mu, double nu,
@@ -540,156 +999,270 @@ namespace hfp3d {
         const il::int_t num_dof = dof_hndl.n_dof;
         const il::int_t ndpe = dof_hndl.dof_h.size(1);
         IL_EXPECT_FAST(ndpe == 18);
+        // DoF shared by elements (see make_dof_h_conforming)
+        // only for DD in the reference coordinates
+        // (checked in release builds as well)
+        if (n_par.is_dd_local && is_dof_h_shared(dof_hndl)) {
+            std::abort();
+        }
 
         il::Array2D<double> global_matrix {num_dof + 1, num_dof + 1, 0.0};
-        //il::Array<double> right_hand_side {num_dof, 0.0};
-        //Alg_Sys_T alg_system;
-        //alg_sys.matrix = il::Array2D<double>{num_dof+1, num_dof+1, 0.0};
-        //alg_sys.rhside = il::Array<double>{num_dof+1, 0.0};
+
+        // Element properties (vertices, CP, shape functions, rotation)
+        il::Array<Element_Struct_T> ele_l = make_ele_struct_list(mesh, n_par);
+
+        // Number of "target" elements evaluated at once
+        const il::int_t t_chunk = 64;
+
+        // Self-influence blocks shared by similar elements
+        const bool use_self_cache = n_par.self_blk_tol > 0.0;
+        Self_Block_Cache_T self_cache;
+        self_cache.tol = n_par.self_blk_tol;
 
         // Loop over "source" elements
 //#pragma omp parallel for
         for (il::int_t source_elem = 0;
              source_elem < num_ele; ++source_elem) {
-            // Vertices' coordinates
-            il::StaticArray2D<double, 3, 3> el_vert_s;
-            //il::StaticArray<double, 3> vert_wts_s;
-            for (il::int_t j = 0; j < 3; ++j) {
-                il::int_t n = mesh.conn(j, source_elem);
-                for (il::int_t k = 0; k < 3; ++k) {
-                    el_vert_s(k, j) = mesh.nods(k, n);
+            const Element_Struct_T &ele_s = ele_l[source_elem];
+            // Source element's data independent of the target
+            Src_El_Prep_T prep = make_src_el_prep
+                    (1, mu, nu, make_el_tau_crd(ele_s.vert, ele_s.r_tensor),
+                     ele_s.sf_m);
+
+            // Loop over "Target" elements (by chunks)
+            for (il::int_t t_0 = 0; t_0 < num_ele; t_0 += t_chunk) {
+                il::int_t n_t_el = std::min(t_chunk, num_ele - t_0);
+                il::Array<il::int_t> t_el_l{};
+                t_el_l.reserve(n_t_el);
+                for (il::int_t t = t_0; t < t_0 + n_t_el; ++t) {
+                    // the self-influence block is taken from the cache
+                    if (t != source_elem || !use_self_cache) {
+                        t_el_l.append(t);
+                    }
                 }
-                // set vert_wts_s[j]
-            }
-
-            // Basis (shape) functions and rotation tensor of the el-t
-            il::StaticArray2D<double, 3, 3> r_tensor_s;
-            il::StaticArray2D<std::complex<double>, 6, 6> sfm = 
-                    make_el_sfm_uniform(el_vert_s, il::io, r_tensor_s);
-            //il::StaticArray2D<std::complex<double>, 6, 6> sfm = 
-            // make_el_sfm_nonuniform(r_tensor, el_vert, vert_wts_s);
+                n_t_el = t_el_l.size();
+                il::Array<il::StaticArray2D<double, 18, 18>> trac_infl_el2el =
+                        make_el2el_vc_submatrices
+                                (prep, ele_s, ele_l, t_el_l,
+                                 n_par.is_dd_local);
 
-            // Complex-valued positions of "source" element nodes
-            il::StaticArray<std::complex<double>, 3> tau = 
-                    make_el_tau_crd(el_vert_s, r_tensor_s);
+                // Adding the element-to-element influence sub-matrices
+                // to the global influence matrix
+                for (il::int_t t = 0; t < n_t_el; ++t) {
+                    il::int_t target_elem = t_el_l[t];
+                    for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+                        il::int_t j1 = dof_hndl.dof_h(source_elem, i1);
+                        for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
+                            il::int_t j0 = dof_hndl.dof_h(target_elem, i0);
+                            if (j0 >= 0 && j1 >= 0) {
+                                global_matrix(j0, j1) +=
+                                        trac_infl_el2el[t](i0, i1);
+                            }
+                        }
+                    }
+                }
+            }
 
-            // Loop over "Target" elements
-            for (il::int_t target_elem = 0; 
-                 target_elem < num_ele; ++target_elem) {
-                // Vertices' coordinates
-                il::StaticArray2D<double, 3, 3> el_vert_t;
-                //il::StaticArray<double, 3> vert_wts_t;
-                for (il::int_t j = 0; j < 3; ++j) {
-                    il::int_t n = mesh.conn(j, target_elem);
-                    for (il::int_t k = 0; k < 3; ++k) {
-                        el_vert_t(k, j) = mesh.nods(k, n);
+            if (use_self_cache) {
+                il::StaticArray2D<double, 18, 18> trac_infl_self =
+                        make_el2el_vc_self_submatrix
+                                (mu, nu, ele_s, n_par.beta,
+                                 n_par.is_dd_local, il::io, self_cache);
+                for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+                    il::int_t j1 = dof_hndl.dof_h(source_elem, i1);
+                    for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
+                        il::int_t j0 = dof_hndl.dof_h(source_elem, i0);
+                        if (j0 >= 0 && j1 >= 0) {
+                            global_matrix(j0, j1) += trac_infl_self(i0, i1);
+                        }
                     }
-                    // set vert_wts_t[j]
                 }
+            }
 
-                // Rotation tensor for the target element
-                il::StaticArray2D<double, 3, 3> r_tensor_t = 
-                        make_el_r_tensor(el_vert_t);
+            // Influence of DD & pressure on tractions & volume
+            set_el_vc_border(ele_l[source_elem], source_elem, n_par,
+                             dof_hndl, il::io, global_matrix);
+        }
+        // global_matrix(num_dof, num_dof) = compressibility * volume
+        return global_matrix;
+    }
 
-                // Normal vector at collocation point (x)
-                il::StaticArray<double, 3> nrm_cp_glob;
-                for (int j = 0; j < 3; ++j) {
-                    nrm_cp_glob[j] = -r_tensor_t(2, j);
-                }
+    // nu-independent parts of the VC matrix
+    VC_Matrix_Nu_T make_3dbem_matrix_vc_nu
+            (const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             il::io_t, DoF_Handle_T &dof_hndl) {
+// This function assembles the Volume Control BEM matrix
+// as a0 + nu * a1 (DD block) scaled by -mu / (4 * pi * (1 - nu)),
+// as all coefficients of the kernels (s_ij_gen_h etc.) are affine in nu;
+// a0 and a1 are found from 2 assemblies (nu = 0 and nu = 1/2)
+// so that the matrix for any (mu, nu) costs O(n_dof^2)
+// (see make_3dbem_matrix_vc(mu, nu, vc_nu))
+        const double nu_1 = 0.5;
+        // with mu = -4 * pi * (1 - nu) the scaling factor is 1
+        il::Array2D<double> b_0 = make_3dbem_matrix_vc
+                (-4.0 * M_PI, 0.0, mesh, n_par, il::io, dof_hndl);
+        il::Array2D<double> b_1 = make_3dbem_matrix_vc
+                (-4.0 * M_PI * (1.0 - nu_1), nu_1, mesh, n_par,
+                 il::io, dof_hndl);
 
-                // Collocation points' coordinates
-                il::StaticArray<il::StaticArray<double, 3>, 6> el_cp_crd = 
-                        el_cp_uniform(el_vert_t, n_par.beta);
-                //il::StaticArray<il::StaticArray<double, 3>, 6> el_cp_crd = 
-                // el_cp_nonuniform(el_vert_t,vert_wts_t,beta);
+        const il::int_t num_dof = dof_hndl.n_dof;
+        VC_Matrix_Nu_T vc_nu;
+        vc_nu.n_dof = num_dof;
+        vc_nu.a1 = il::Array2D<double>{num_dof + 1, num_dof + 1, 0.0};
+        for (il::int_t j1 = 0; j1 < num_dof; ++j1) {
+            for (il::int_t j0 = 0; j0 < num_dof; ++j0) {
+                vc_nu.a1(j0, j1) = (b_1(j0, j1) - b_0(j0, j1)) / nu_1;
+            }
+        }
+        vc_nu.a0 = std::move(b_0);
+        return vc_nu;
+    }
 
-                il::StaticArray2D<double, 18, 18> trac_infl_el2el;
-                // Loop over nodes of the "target" element
-                for (int n_t = 0; n_t < 6; ++n_t) {
-                    // Shifting to the n_t-th collocation pt
-                    HZ hz = make_el_pt_hz
-                            (el_vert_s, el_cp_crd[n_t], r_tensor_s);
+    // VC matrix from the nu-independent parts
+    il::Array2D<double> make_3dbem_matrix_vc
+            (double mu, double nu,
+             const VC_Matrix_Nu_T &vc_nu) {
+// This function combines the Volume Control BEM matrix
+// for given elastic constants (mu, nu) from a0 and a1
+// (see make_3dbem_matrix_vc_nu)
+        const il::int_t num_dof = vc_nu.n_dof;
+        IL_EXPECT_FAST(vc_nu.a0.size(0) == num_dof + 1);
+        IL_EXPECT_FAST(vc_nu.a1.size(0) == num_dof + 1);
+        // see make_src_el_prep
+        const double scale = -mu / (4.0 * M_PI * (1.0 - nu));
+
+        // the VC row & column do not depend on (mu, nu)
+        il::Array2D<double> global_matrix = vc_nu.a0;
+        for (il::int_t j1 = 0; j1 < num_dof; ++j1) {
+            for (il::int_t j0 = 0; j0 < num_dof; ++j0) {
+                global_matrix(j0, j1) = scale *
+                        (vc_nu.a0(j0, j1) + nu * vc_nu.a1(j0, j1));
+            }
+        }
+        return global_matrix;
+    }
 
-                    // Calculating DD-to stress influence
-                    // w.r. to the source element's local coordinate system
-                    il::StaticArray2D<double, 6, 18> stress_infl_el2p_loc_h =
-                            make_local_3dbem_submatrix
-                                    (1, mu, nu, hz.h, hz.z, tau, sfm);
-                    //stress_infl_el2p_loc_t = make_local_3dbem_submatrix
-                    // (0, mu, nu, hz.h, hz.z, tau, sfm);
+    // VC matrix extension for a grown mesh
+    il::Array2D<double> extend_3dbem_matrix_vc
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &old_dof_hndl,
+             const il::Array2D<double> &old_matrix,
+             il::io_t, DoF_Handle_T &dof_hndl) {
+// This function extends the Volume Control BEM matrix (old_matrix)
+// assembled for the first old_dof_hndl.dof_h.size(0) elements of the mesh
+// to the mesh with appended elements (see grow_mesh_at_tip).
+// The DoF numbers of the old elements are kept (see extend_dof_h_crack),
+// so that the old matrix is copied as the leading block,
+// and only the rows & columns of "changed" elements
+// (new elements & old elements with newly freed DoF)
+// are calculated, i.e. the cost is proportional to
+// (number of changed elements) * (total number of elements)
 
-                    // Multiplication by normal at CP
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(old_matrix.size(0) == old_matrix.size(1));
+        const il::int_t num_ele = mesh.conn.size(1);
+        const il::int_t old_num_ele = old_dof_hndl.dof_h.size(0);
+        const il::int_t old_num_dof = old_dof_hndl.n_dof;
+        IL_EXPECT_FAST(old_num_ele <= num_ele);
+        IL_EXPECT_FAST(old_matrix.size(0) == old_num_dof + 1);
 
-                    // Alternative 1: rotating stress at coll. pt.
-                    // to the reference ("global") coordinate system
-                    //stress_infl_el2p_glob = hfp3d::rotate_sim
-                    // (r_tensor_s, stress_infl_el2p_loc_h);
-                    //trac_cp_glob = hfp3d::nv_dot_sim(nrm_cp_glob, SIM_CP_G);
+        if (dof_hndl.n_dof == 0 || dof_hndl.dof_h.size(0) == 0) {
+            dof_hndl = extend_dof_h_crack(mesh, old_dof_hndl, 2, n_par.tip_type);
+        }
 
-                    // Alternative 2: rotating nrm_cp_glob to
-                    // the source element's local coordinate system
-                    il::StaticArray<double, 3> nrm_cp_loc = 
-                            il::dot(r_tensor_s, nrm_cp_glob);
-                    il::StaticArray2D<double, 3, 18> trac_el2p_loc =
-                            nv_dot_sim(nrm_cp_loc, stress_infl_el2p_loc_h);
-                    il::StaticArray2D<double, 3, 18> trac_cp_glob = il::dot
-                            (r_tensor_s, il::Blas::transpose, trac_el2p_loc);
+        const il::int_t num_dof = dof_hndl.n_dof;
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        IL_EXPECT_FAST(ndpe == 18);
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(0) == num_ele);
+        IL_EXPECT_FAST(num_dof >= old_num_dof);
+        // the blocks & the border of changed elements are overwritten,
+        // not accumulated: no DoF shared with unchanged elements
+        // (see make_dof_h_conforming)
+        if (is_dof_h_shared(old_dof_hndl) || is_dof_h_shared(dof_hndl)) {
+            std::abort();
+        }
 
-                    // Alternative 3: traction vector
-                    // in terms of local coordinates at CP
-                    //trac_cp_x_loc = il::dot
-                    // (r_tensor_t, il::Blas::transpose, trac_cp_glob);
+        il::Array2D<double> global_matrix {num_dof + 1, num_dof + 1, 0.0};
 
-                    if (!n_par.is_dd_local) {
-                        // Re-relating DD-to traction influence to DD
-                        // w.r. to the reference coordinate system
-                        il::StaticArray2D<double, 3, 3> trac_infl_n2p,
-                                trac_infl_n2p_glob;
-                        for (int n_s = 0; n_s < 6; ++n_s) {
-                            // taking a block (one node of the "source" element)
-                            for (int j = 0; j < 3; ++j) {
-                                for (int k = 0; k < 3; ++k) {
-                                    trac_infl_n2p(k, j) =
-                                            trac_cp_glob(k, 3 * n_s + j);
-                                }
-                            }
+        // Copying the old matrix (DD part & the VC row and column)
+        for (il::int_t j1 = 0; j1 < old_num_dof; ++j1) {
+            for (il::int_t j0 = 0; j0 < old_num_dof; ++j0) {
+                global_matrix(j0, j1) = old_matrix(j0, j1);
+            }
+            global_matrix(num_dof, j1) = old_matrix(old_num_dof, j1);
+            global_matrix(j1, num_dof) = old_matrix(j1, old_num_dof);
+        }
+        global_matrix(num_dof, num_dof) = old_matrix(old_num_dof, old_num_dof);
+
+        // Elements with DoF not covered by the old matrix
+        il::Array<il::int_t> ch_el_l{};
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            for (il::int_t i = 0; i < ndpe; ++i) {
+                if (dof_hndl.dof_h(el, i) >= old_num_dof) {
+                    ch_el_l.append(el);
+                    break;
+                }
+            }
+        }
+        const il::int_t num_ch_ele = ch_el_l.size();
+        if (num_ch_ele == 0) {
+            return global_matrix;
+        }
+        il::Array<int> is_ch{num_ele, 0};
+        for (il::int_t k = 0; k < num_ch_ele; ++k) {
+            is_ch[ch_el_l[k]] = 1;
+        }
 
-                            // Coordinate rotation (for the unknown)
-                            trac_infl_n2p_glob = il::dot(trac_infl_n2p,
-                                                         r_tensor_s);
-
-                            // Adding the block to the element-to-element
-                            // influence sub-matrix
-                            for (int j = 0; j < 3; ++j) {
-                                for (int k = 0; k < 3; ++k) {
-                                    trac_infl_el2el(3 * n_t + k, 3 * n_s + j) =
-                                            trac_infl_n2p_glob(k, j);
-                                }
-                            }
-                        }
-                    } else {
-                        for (int dof_s = 0; dof_s < ndpe; ++dof_s) {
-                            for (int n_t = 0; n_t < 6; ++n_t) {
-                                for (int k = 0; k < 3; ++k)
-                                trac_infl_el2el(3 * n_t + k, dof_s) =
-                                        trac_cp_glob(k, dof_s);
-                            }
+        // Element properties (vertices, CP, shape functions, rotation)
+        il::Array<Element_Struct_T> ele_l = make_ele_struct_list(mesh, n_par);
+
+        // Self-influence blocks shared by similar elements
+        // (as in make_3dbem_matrix_vc)
+        const bool use_self_cache = n_par.self_blk_tol > 0.0;
+        Self_Block_Cache_T self_cache;
+        self_cache.tol = n_par.self_blk_tol;
+
+        // Loop over "changed" elements
+//#pragma omp parallel for
+        for (il::int_t k = 0; k < num_ch_ele; ++k) {
+            il::int_t ch_elem = ch_el_l[k];
+            // Loop over all elements (as "source" and as "target")
+            for (il::int_t o_elem = 0; o_elem < num_ele; ++o_elem) {
+                // pairs of 2 changed elements are done once
+                if (is_ch[o_elem] == 1 && o_elem < ch_elem) continue;
+                // changed element as "target"
+                il::StaticArray2D<double, 18, 18> trac_infl_el2el =
+                        (o_elem == ch_elem && use_self_cache) ?
+                        make_el2el_vc_self_submatrix
+                                (mu, nu, ele_l[ch_elem], n_par.beta,
+                                 n_par.is_dd_local, il::io, self_cache) :
+                        make_el2el_vc_submatrix
+                                (mu, nu, ele_l[o_elem],
+                                 ele_l[ch_elem], n_par.is_dd_local);
+                for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+                    il::int_t j1 = dof_hndl.dof_h(o_elem, i1);
+                    for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
+                        il::int_t j0 = dof_hndl.dof_h(ch_elem, i0);
+                        if (j0 >= 0 && j1 >= 0) {
+                            global_matrix(j0, j1) =
+                                    trac_infl_el2el(i0, i1);
                         }
                     }
                 }
-
-                // Adding the element-to-element influence sub-matrix
-                // to the global influence matrix
-                //IL_EXPECT_FAST
-                // (ndpe * (target_elem + 1) <= global_matrix.size(0));
-                //IL_EXPECT_FAST
-                // (ndpe * (source_elem + 1) <= global_matrix.size(1));
+                if (o_elem == ch_elem) continue;
+                // changed element as "source"
+                trac_infl_el2el = make_el2el_vc_submatrix
+                        (mu, nu, ele_l[ch_elem],
+                         ele_l[o_elem], n_par.is_dd_local);
                 for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
-                    il::int_t j1 = dof_hndl.dof_h(source_elem, i1);
+                    il::int_t j1 = dof_hndl.dof_h(ch_elem, i1);
                     for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
-                        il::int_t j0 = dof_hndl.dof_h(target_elem, i0);
+                        il::int_t j0 = dof_hndl.dof_h(o_elem, i0);
                         if (j0 >= 0 && j1 >= 0) {
-                            global_matrix(j0, j1) +=
+                            global_matrix(j0, j1) =
                                     trac_infl_el2el(i0, i1);
                         }
                     }
@@ -697,40 +1270,282 @@ namespace hfp3d {
             }
 
             // Influence of DD & pressure on tractions & volume
-            il::StaticArray<double, 6> el_sf_integral =
-                    el_p2_sf_integral(sfm, tau);
-            for (int n_s = 0; n_s < 6; ++n_s) {
-                // Integral of n_s-th shape function over the s-element
-                double sf_integral = el_sf_integral[n_s];
-                il::StaticArray<double, 3> sf_i_v {0.0};
-                // Integral of normal DD (opening) over the element
-                // for the n_s-th shape function
+            // (the entries copied from the old matrix are replaced)
+            for (il::int_t i = 0; i < ndpe; ++i) {
+                il::int_t j = dof_hndl.dof_h(ch_elem, i);
+                if (j >= 0) {
+                    global_matrix(num_dof, j) = 0.0;
+                    global_matrix(j, num_dof) = 0.0;
+                }
+            }
+            set_el_vc_border(ele_l[ch_elem], ch_elem, n_par,
+                             dof_hndl, il::io, global_matrix);
+        }
+        return global_matrix;
+    }
+
+    // Element-to-element blocks for elements of order p
+    template <int p>
+    il::Array<il::StaticArray2D
+            <double, El_Order_T<p>::ndpe, El_Order_T<p>::ndpe>>
+    make_el2el_vc_submatrices_p
+            (const Src_El_Prep_T &prep,
+             const Element_Struct_T &ele_s,
+             const il::Array<Element_Struct_T> &ele_l,
+             const il::Array<il::int_t> &t_el_l,
+             bool is_dd_local) {
+// This function follows make_el2el_vc_submatrices: the stress
+// influence of the 2nd order nodal DD is evaluated at the CP of order p
+// and contracted with the values of the SF of order p
+// at the 2nd order nodes (see el_sf_p_at_p2_nodes)
+        const int nnpe = El_Order_T<p>::nnpe;
+        const int ndpe = El_Order_T<p>::ndpe;
+        const il::int_t n_t_el = t_el_l.size();
+        const il::StaticArray2D<double, 6, nnpe> sf_p2 =
+                el_sf_p_at_p2_nodes<p>(ele_s.vert_wts);
+
+        // Shifting to the collocation pts of all "target" elements
+        il::Array<double> h_cp{nnpe * n_t_el};
+        il::Array<std::complex<double>> z_cp{nnpe * n_t_el};
+        for (il::int_t t = 0; t < n_t_el; ++t) {
+            il::StaticArray<il::StaticArray<double, 3>, nnpe> cp_crd =
+                    el_cp_p<p>(ele_l[t_el_l[t]]);
+            for (int n_t = 0; n_t < nnpe; ++n_t) {
+                HZ hz = make_el_pt_hz
+                        (ele_s.vert, cp_crd[n_t], ele_s.r_tensor);
+                h_cp[nnpe * t + n_t] = hz.h;
+                z_cp[nnpe * t + n_t] = hz.z;
+            }
+        }
+
+        il::Array<il::StaticArray2D<double, 6, 18>> stress_infl_el2p_loc_h =
+                make_local_3dbem_submatrices(prep, h_cp, z_cp);
+
+        il::Array<il::StaticArray2D<double, ndpe, ndpe>>
+                trac_infl_el2el{n_t_el};
+        for (il::int_t t = 0; t < n_t_el; ++t) {
+            const Element_Struct_T &ele_t = ele_l[t_el_l[t]];
+
+            // Normal vector at collocation point (x)
+            il::StaticArray<double, 3> nrm_cp_glob;
+            for (int j = 0; j < 3; ++j) {
+                nrm_cp_glob[j] = -ele_t.r_tensor(2, j);
+            }
+            il::StaticArray<double, 3> nrm_cp_loc =
+                    il::dot(ele_s.r_tensor, nrm_cp_glob);
+
+            for (int n_t = 0; n_t < nnpe; ++n_t) {
+                il::StaticArray2D<double, 3, 18> trac_el2p_loc =
+                        nv_dot_sim(nrm_cp_loc,
+                                   stress_infl_el2p_loc_h[nnpe * t + n_t]);
+                il::StaticArray2D<double, 3, 18> trac_cp_glob = il::dot
+                        (ele_s.r_tensor, il::Blas::transpose, trac_el2p_loc);
+
+                for (int m_s = 0; m_s < nnpe; ++m_s) {
+                    // DD of order p at the node m_s
+                    il::StaticArray2D<double, 3, 3> trac_infl_n2p{0.0};
+                    for (int n_s = 0; n_s < 6; ++n_s) {
+                        const double sf = sf_p2(n_s, m_s);
+                        if (sf == 0.0) continue;
+                        for (int j = 0; j < 3; ++j) {
+                            for (int k = 0; k < 3; ++k) {
+                                trac_infl_n2p(k, j) +=
+                                        sf * trac_cp_glob(k, 3 * n_s + j);
+                            }
+                        }
+                    }
+                    if (!is_dd_local) {
+                        // DD w.r. to the reference coordinate system
+                        trac_infl_n2p = il::dot(trac_infl_n2p,
+                                                ele_s.r_tensor);
+                    }
+                    for (int j = 0; j < 3; ++j) {
+                        for (int k = 0; k < 3; ++k) {
+                            trac_infl_el2el[t](3 * n_t + k, 3 * m_s + j) =
+                                    trac_infl_n2p(k, j);
+                        }
+                    }
+                }
+            }
+        }
+        return trac_infl_el2el;
+    }
+
+    template <>
+    il::Array<il::StaticArray2D<double, 18, 18>>
+    make_el2el_vc_submatrices_p<2>
+            (const Src_El_Prep_T &prep,
+             const Element_Struct_T &ele_s,
+             const il::Array<Element_Struct_T> &ele_l,
+             const il::Array<il::int_t> &t_el_l,
+             bool is_dd_local) {
+        return make_el2el_vc_submatrices
+                (prep, ele_s, ele_l, t_el_l, is_dd_local);
+    }
+
+    // VC matrix for elements of order p
+    template <int p>
+    il::Array2D<double> make_3dbem_matrix_vc_p
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             il::io_t, DoF_Handle_T &dof_hndl) {
+// This function follows make_3dbem_matrix_vc (without the cache
+// of self-influence blocks)
+        IL_EXPECT_FAST(mesh.conn.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.conn.size(1) >= 1); // at least 1 element
+        IL_EXPECT_FAST(mesh.nods.size(0) >= 3);
+        IL_EXPECT_FAST(mesh.nods.size(1) >= 3); // at least 3 nodes
+
+        // no fixed DoF at the tip: for p < 2, the DD at the tip vertices
+        // would vanish over the whole tip edge (see the header)
+        if (dof_hndl.n_dof == 0 || dof_hndl.dof_h.size(0) == 0) {
+            dof_hndl = make_dof_h_crack(mesh, p, 0);
+        }
+
+        const int nnpe = El_Order_T<p>::nnpe;
+        const int ndpe = El_Order_T<p>::ndpe;
+        const il::int_t num_ele = mesh.conn.size(1);
+        const il::int_t num_dof = dof_hndl.n_dof;
+        IL_EXPECT_FAST(dof_hndl.dof_h.size(1) == ndpe);
+        // (see make_3dbem_matrix_vc)
+        if (n_par.is_dd_local && is_dof_h_shared(dof_hndl)) {
+            std::abort();
+        }
+
+        il::Array2D<double> global_matrix {num_dof + 1, num_dof + 1, 0.0};
+
+        il::Array<Element_Struct_T> ele_l = make_ele_struct_list(mesh, n_par);
+
+        // Number of "target" elements evaluated at once
+        const il::int_t t_chunk = 64 * 6 / nnpe;
+
+        // integrals of the SF of order p over an element of unit area
+        // (do not depend on the edge partitioning)
+        const il::StaticArray<double, 3> wts_1{1.0};
+        const il::StaticArray<double, 6> sf_int_ref = el_p2_sf_integral_ref();
+        const il::StaticArray2D<double, 6, nnpe> sf_p2 =
+                el_sf_p_at_p2_nodes<p>(wts_1);
+        il::StaticArray<double, nnpe> sf_int_p{0.0};
+        for (int m = 0; m < nnpe; ++m) {
+            for (int n = 0; n < 6; ++n) {
+                sf_int_p[m] += sf_p2(n, m) * sf_int_ref[n];
+            }
+        }
+
+        // Loop over "source" elements
+        for (il::int_t source_elem = 0;
+             source_elem < num_ele; ++source_elem) {
+            const Element_Struct_T &ele_s = ele_l[source_elem];
+            Src_El_Prep_T prep = make_src_el_prep
+                    (1, mu, nu, make_el_tau_crd(ele_s.vert, ele_s.r_tensor),
+                     ele_s.sf_m);
+
+            // Loop over "Target" elements (by chunks)
+            for (il::int_t t_0 = 0; t_0 < num_ele; t_0 += t_chunk) {
+                const il::int_t n_t_el = std::min(t_chunk, num_ele - t_0);
+                il::Array<il::int_t> t_el_l{n_t_el};
+                for (il::int_t t = 0; t < n_t_el; ++t) {
+                    t_el_l[t] = t_0 + t;
+                }
+                il::Array<il::StaticArray2D<double, ndpe, ndpe>>
+                        trac_infl_el2el = make_el2el_vc_submatrices_p<p>
+                        (prep, ele_s, ele_l, t_el_l, n_par.is_dd_local);
+
+                for (il::int_t t = 0; t < n_t_el; ++t) {
+                    il::int_t target_elem = t_el_l[t];
+                    for (il::int_t i1 = 0; i1 < ndpe; ++i1) {
+                        il::int_t j1 = dof_hndl.dof_h(source_elem, i1);
+                        for (il::int_t i0 = 0; i0 < ndpe; ++i0) {
+                            il::int_t j0 = dof_hndl.dof_h(target_elem, i0);
+                            if (j0 >= 0 && j1 >= 0) {
+                                global_matrix(j0, j1) +=
+                                        trac_infl_el2el[t](i0, i1);
+                            }
+                        }
+                    }
+                }
+            }
+
+            // Volume vs DD & tractions vs pressure (see set_el_vc_border)
+            const double area = el_area(ele_s.vert);
+            for (int n_s = 0; n_s < nnpe; ++n_s) {
+                il::StaticArray<double, 3> sf_i_v{0.0};
                 if (!n_par.is_dd_local) {
-                    // dot([0, 0, sf_integral], r_tensor_s)
                     for (int j = 0; j < 3; ++j) {
-                        sf_i_v[j] = sf_integral * r_tensor_s(2, j);
+                        sf_i_v[j] = area * sf_int_p[n_s] *
+                                    ele_s.r_tensor(2, j);
                     }
                 } else {
-                    // [0, 0, sf_integral]
-                    sf_i_v[2] = sf_integral;
+                    sf_i_v[2] = area * sf_int_p[n_s];
                 }
                 for (int j = 0; j < 3; ++j) {
-                    int l = n_s * 3 + j;
-                    il::int_t s_dof = dof_hndl.dof_h(source_elem, l);
+                    il::int_t s_dof = dof_hndl.dof_h(source_elem, 3 * n_s + j);
                     if (s_dof >= 0) {
-                        // Volume vs DD
-                        global_matrix(num_dof, s_dof) = sf_i_v[j];
-                        // Tractions vs pressure
-                        global_matrix(s_dof, num_dof) =
-                                -r_tensor_s(2, j); // Normal at element
+                        global_matrix(num_dof, s_dof) += sf_i_v[j];
+                        global_matrix(s_dof, num_dof) -= ele_s.r_tensor(2, j);
                     }
                 }
             }
         }
-        // global_matrix(num_dof, num_dof) = compressibility * volume
         return global_matrix;
     }
 
+    template <>
+    il::Array2D<double> make_3dbem_matrix_vc_p<2>
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             il::io_t, DoF_Handle_T &dof_hndl) {
+        return make_3dbem_matrix_vc(mu, nu, mesh, n_par, il::io, dof_hndl);
+    }
+
+    template il::Array<il::StaticArray2D<double, 3, 3>>
+    make_el2el_vc_submatrices_p<0>
+            (const Src_El_Prep_T &prep,
+             const Element_Struct_T &ele_s,
+             const il::Array<Element_Struct_T> &ele_l,
+             const il::Array<il::int_t> &t_el_l,
+             bool is_dd_local);
+    template il::Array<il::StaticArray2D<double, 9, 9>>
+    make_el2el_vc_submatrices_p<1>
+            (const Src_El_Prep_T &prep,
+             const Element_Struct_T &ele_s,
+             const il::Array<Element_Struct_T> &ele_l,
+             const il::Array<il::int_t> &t_el_l,
+             bool is_dd_local);
+    template il::Array2D<double> make_3dbem_matrix_vc_p<0>
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             il::io_t, DoF_Handle_T &dof_hndl);
+    template il::Array2D<double> make_3dbem_matrix_vc_p<1>
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             il::io_t, DoF_Handle_T &dof_hndl);
+
+    il::Array<double> make_vc_rhs_from_cp
+            (const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &t_cp,
+             double volume) {
+        const il::int_t num_ele = dof_hndl.dof_h.size(0);
+        const il::int_t ndpe = dof_hndl.dof_h.size(1);
+        const il::int_t num_dof = dof_hndl.n_dof;
+        IL_EXPECT_FAST(t_cp.size() == num_ele * ndpe);
+        il::Array<double> rhs{num_dof + 1, 0.0};
+        for (il::int_t el = 0; el < num_ele; ++el) {
+            for (il::int_t i = 0; i < ndpe; ++i) {
+                il::int_t dof = dof_hndl.dof_h(el, i);
+                if (dof >= 0) {
+                    rhs[dof] += t_cp[el * ndpe + i];
+                }
+            }
+        }
+        rhs[num_dof] = volume;
+        return rhs;
+    }
+
     // Volume Control system modification (for DD increments)
     SAE_T mod_3dbem_system_vc
             (const il::Array2D<double> &orig_matrix,
@@ -800,4 +1615,23 @@ namespace hfp3d {
         return alg_system;
     }
 
+    il::Array<double> dot_nonzero_dd
+            (const il::Array2D<double> &matrix,
+             const il::Array<double> &dd) {
+// The matrix is column-major: each column is contiguous,
+// so that the cost is O(n_rows * n_nonzero) instead of O(n_rows * n_cols)
+        const il::int_t n_rows = matrix.size(0);
+        const il::int_t n_cols = (matrix.size(1) < dd.size()) ?
+                                 matrix.size(1) : dd.size();
+        il::Array<double> prod{n_rows, 0.0};
+        for (il::int_t j = 0; j < n_cols; ++j) {
+            const double dd_j = dd[j];
+            if (dd_j == 0.0) continue;
+            for (il::int_t i = 0; i < n_rows; ++i) {
+                prod[i] += matrix(i, j) * dd_j;
+            }
+        }
+        return prod;
+    }
+
 }
\ No newline at end of file
@@ -15,10 +15,14 @@
 #define INC_HFPX3D_MATRIX_ASM_H
 
 #include <complex>
+#include <cstdint>
+#include <unordered_map>
+#include <il/Array.h>
 #include <il/Array2D.h>
 #include <il/StaticArray.h>
 #include <il/StaticArray2D.h>
 #include "mesh_utilities.h"
+#include "element_utilities.h"
 
 namespace hfp3d {
 
@@ -29,6 +33,47 @@ namespace hfp3d {
         il::Array<double> rhs_v{};
     };
 
+    // source element data which do not depend on the observation point
+    // (see make_local_3dbem_submatrix)
+    struct Src_El_Prep_T {
+        int kernel_id = 1;
+        double nu = 0.0;
+        // scaling of the influence matrix
+        double scale = 0.0;
+        // complex-valued positions of the vertices
+        il::StaticArray<std::complex<double>, 3> tau{};
+        // edge direction factors dtau/conj(dtau), dtau = tau[j+1] - tau[j]
+        il::StaticArray<std::complex<double>, 3> ntau2{};
+        // coefficients of shape functions (tau-coordinates)
+        il::StaticArray2D<std::complex<double>, 6, 6> sfm{};
+    };
+
+    // element self-influence blocks (see make_el2el_vc_self_submatrix)
+    // shared by elements of the same shape (up to rotation & scaling);
+    // valid for one set of (mu, nu, beta)
+    struct Self_Block_Cache_T {
+        // quantization step for edge length ratios
+        double tol = 1e-8;
+        // blocks (tractions vs DD, both in local coordinates)
+        // for the longest edge of unit length, by quantized ratios
+        // of the next 2 edges (counter-clockwise) to the longest one
+        std::unordered_map<std::uint64_t, il::StaticArray2D<double, 18, 18>>
+                blk{};
+        // number of blocks taken from the cache
+        il::int_t n_hit = 0;
+    };
+
+    // nu-independent parts of the VC matrix (see make_3dbem_matrix_vc_nu):
+    // DD block = -mu / (4 * pi * (1 - nu)) * (a0 + nu * a1),
+    // the VC row & column are stored in a0 (a1 is zero there)
+    struct VC_Matrix_Nu_T {
+        il::int_t n_dof = 0;
+        il::Array2D<double> a0{};
+        il::Array2D<double> a1{};
+    };
+
+    // packed list of DoF of "active" elements (see Mesh_Data_T::ae_set);
+    // DD at the other DoF are expected to be zero
 /////// Elastostatics utilities ///////
 
     // Element-to-point influence matrix (submatrix of the global one)
@@ -38,6 +83,19 @@ namespace hfp3d {
              const il::StaticArray<std::complex<double>, 3> &tau,
              const il::StaticArray2D<std::complex<double>, 6, 6> &sfm);
 
+    // Source element preparation (once per element)
+    Src_El_Prep_T make_src_el_prep
+            (const int kernel_id,
+             double mu, double nu,
+             const il::StaticArray<std::complex<double>, 3> &tau,
+             const il::StaticArray2D<std::complex<double>, 6, 6> &sfm);
+
+    // Element-to-point influence matrices for a span of points (h[k], z[k])
+    il::Array<il::StaticArray2D<double, 6, 18>> make_local_3dbem_submatrices
+            (const Src_El_Prep_T &prep,
+             const il::Array<double> &h,
+             const il::Array<std::complex<double>> &z);
+
     // Static matrix assembly
     il::Array2D<double> make_3dbem_matrix_s
             (double mu, double nu,
@@ -55,6 +113,44 @@ namespace hfp3d {
 
 /////// Volume Control scheme utilities ///////
 
+    // Element properties for all elements of the mesh
+    il::Array<Element_Struct_T> make_ele_struct_list
+            (const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par);
+
+    // Element-to-element traction influence matrix (VC matrix block)
+    il::StaticArray2D<double, 18, 18> make_el2el_vc_submatrix
+            (double mu, double nu,
+             const Element_Struct_T &ele_s,
+             const Element_Struct_T &ele_t,
+             bool is_dd_local);
+
+    // The same for a list of "target" elements (t_el_l, indices in ele_l)
+    // and one prepared "source" element
+    il::Array<il::StaticArray2D<double, 18, 18>> make_el2el_vc_submatrices
+            (const Src_El_Prep_T &prep,
+             const Element_Struct_T &ele_s,
+             const il::Array<Element_Struct_T> &ele_l,
+             const il::Array<il::int_t> &t_el_l,
+             bool is_dd_local);
+
+    // Self-influence block (the same as make_el2el_vc_submatrix
+    // for ele_t == ele_s) taken from the cache for similar elements
+    il::StaticArray2D<double, 18, 18> make_el2el_vc_self_submatrix
+            (double mu, double nu,
+             const Element_Struct_T &ele_s,
+             double beta,
+             bool is_dd_local,
+             il::io_t, Self_Block_Cache_T &cache);
+
+    // VC row & column entries of one element
+    void set_el_vc_border
+            (const Element_Struct_T &ele_s,
+             il::int_t source_elem,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &dof_hndl,
+             il::io_t, il::Array2D<double> &global_matrix);
+
     // Volume Control matrix assembly (additional row $ column)
     il::Array2D<double> make_3dbem_matrix_vc
             (double mu, double nu,
@@ -62,6 +158,79 @@ namespace hfp3d {
              const Num_Param_T &n_par,
              il::io_t, DoF_Handle_T &dof_hndl);
 
+    // The same as 2 nu-independent matrices (the kernels are affine in nu)
+    VC_Matrix_Nu_T make_3dbem_matrix_vc_nu
+            (const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             il::io_t, DoF_Handle_T &dof_hndl);
+
+    // VC matrix for given elastic constants from the nu-independent ones
+    il::Array2D<double> make_3dbem_matrix_vc
+            (double mu, double nu,
+             const VC_Matrix_Nu_T &vc_nu);
+
+    // VC matrix extension for a grown mesh (see grow_mesh_at_tip):
+    // only the rows & columns of new elements are calculated
+    il::Array2D<double> extend_3dbem_matrix_vc
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             const DoF_Handle_T &old_dof_hndl,
+             const il::Array2D<double> &old_matrix,
+             il::io_t, DoF_Handle_T &dof_hndl);
+
+/////// Elements of order p = 0, 1, 2 (see El_Order_T) ///////
+
+    // Element-to-element blocks (as make_el2el_vc_submatrices)
+    // for DD of order p (interpolated by the 2nd order SF)
+    // and tractions at the CP of order p (see el_cp_p)
+    template <int p>
+    il::Array<il::StaticArray2D
+            <double, El_Order_T<p>::ndpe, El_Order_T<p>::ndpe>>
+    make_el2el_vc_submatrices_p
+            (const Src_El_Prep_T &prep,
+             const Element_Struct_T &ele_s,
+             const il::Array<Element_Struct_T> &ele_l,
+             const il::Array<il::int_t> &t_el_l,
+             bool is_dd_local);
+
+    // VC matrix for elements of order p; if empty, the DoF handle
+    // is made by make_dof_h_crack(mesh, p, 0) for p < 2: n_par.tip_type
+    // is not used, as fixing the (linear) DD at the tip vertices
+    // means zero DD over the whole tip edge, which overestimates
+    // the pressure by 10-30%; p = 2 is make_3dbem_matrix_vc
+    template <int p>
+    il::Array2D<double> make_3dbem_matrix_vc_p
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             il::io_t, DoF_Handle_T &dof_hndl);
+
+    template <>
+    il::Array<il::StaticArray2D<double, 18, 18>>
+    make_el2el_vc_submatrices_p<2>
+            (const Src_El_Prep_T &prep,
+             const Element_Struct_T &ele_s,
+             const il::Array<Element_Struct_T> &ele_l,
+             const il::Array<il::int_t> &t_el_l,
+             bool is_dd_local);
+
+    template <>
+    il::Array2D<double> make_3dbem_matrix_vc_p<2>
+            (double mu, double nu,
+             const Mesh_Geom_T &mesh,
+             const Num_Param_T &n_par,
+             il::io_t, DoF_Handle_T &dof_hndl);
+
+    // RHS of the VC system from tractions at the CP of all elements
+    // (t_cp[18 * element + 3 * CP + component]) and the volume;
+    // the tractions at CP of a DoF shared by several elements
+    // (see make_dof_h_conforming) are summed, as the rows of the matrix
+    il::Array<double> make_vc_rhs_from_cp
+            (const DoF_Handle_T &dof_hndl,
+             const il::Array<double> &t_cp,
+             double volume);
+
     // Volume Control system modification (for DD increments)
     SAE_T mod_3dbem_system_vc
             (const il::Array2D<double> &orig_matrix,
@@ -69,6 +238,12 @@ namespace hfp3d {
              const DoF_Handle_T &dof_hndl,
              const il::Array<double> &delta_t,
              const double delta_v);
+
+    // dot(matrix, dd) for dd vanishing outside the active elements:
+    // only the columns with non-zero dd are used
+    il::Array<double> dot_nonzero_dd
+            (const il::Array2D<double> &matrix,
+             const il::Array<double> &dd);
 }
 
 #endif //INC_HFPX3D_MATRIX_ASM_H